@@ -0,0 +1,63 @@
+//! @file BinaryMechanism.h Precompiled binary representation of Solution objects
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BINARYMECHANISM_H
+#define CT_BINARYMECHANISM_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+
+//! Version of the binary mechanism format written by writeBinaryMechanism().
+//! Files written with a different version are rejected by
+//! newSolutionFromBinary().
+const int BINARY_MECHANISM_VERSION = 1;
+
+//! Write a precompiled binary representation of a Solution object
+/*!
+ * The file contains the elements and species of the phase, including the
+ * parameterizations of the species thermodynamic properties and transport
+ * data, the reactions of the kinetics manager, the polynomial fits generated
+ * by the transport manager, and the current state of the phase. All
+ * parameters are stored in SI units, after the input file has been processed
+ * and validated. The file can be loaded with newSolutionFromBinary() much
+ * faster than the original input file, since YAML parsing, unit conversion,
+ * the reaction balance and duplicate checks and the transport property fits
+ * are all skipped.
+ *
+ * The format uses the native byte order and is intended as a cache for a
+ * particular machine architecture and Cantera version, not as a portable or
+ * archival format.
+ *
+ * Supported are ideal gas phases with species thermo parameterizations that
+ * can be reported through SpeciesThermoInterpType::reportParameters(),
+ * GasKinetics with reactions using the Arrhenius, Blowers-Masel, falloff,
+ * pressure-dependent Arrhenius and Chebyshev rate types, and the
+ * mixture-averaged and multicomponent transport models. Other models raise a
+ * NotImplementedError.
+ *
+ * @param soln  Solution object to be written
+ * @param filename  Name of the output file; by convention, with the extension
+ *     `.ctb`.
+ */
+void writeBinaryMechanism(shared_ptr<Solution> soln, const std::string& filename);
+
+//! Create a Solution object from a file written by writeBinaryMechanism()
+/*!
+ * The file is memory-mapped where supported by the operating system, so that
+ * multiple processes loading the same file on one node share the file
+ * contents through the page cache. newSolution() calls this function for
+ * input files with the extension `.ctb`.
+ *
+ * @param filename  Name of the binary mechanism file
+ */
+shared_ptr<Solution> newSolutionFromBinary(const std::string& filename);
+
+}
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file ScopedTimer.h
+ *    Lightweight counters for profiling sections of code
+ *    (see \ref Cantera::ScopedTimer).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_SCOPEDTIMER_H
+#define CT_SCOPEDTIMER_H
+
+#include <chrono>
+#include <string>
+
+namespace Cantera
+{
+
+//! Call count, cache hits and cumulative wall clock time of a section of code
+//! @ingroup globalUtilFuncs
+struct ProfilingCounter
+{
+    explicit ProfilingCounter(const std::string& name_="")
+        : name(name_), calls(0), hits(0), time(0.0) {}
+
+    //! Reset all counters to zero
+    void reset() {
+        calls = 0;
+        hits = 0;
+        time = 0.0;
+    }
+
+    std::string name; //!< Name of the instrumented section
+    size_t calls; //!< Number of times the section was entered
+    size_t hits; //!< Number of calls which were short-circuited by a cache
+    double time; //!< Cumulative wall clock time spent in the section [s]
+};
+
+//! Timer which adds the time elapsed during its lifetime to a ProfilingCounter
+/*!
+ * If the counter is a null pointer, the timer does nothing, which allows
+ * instrumented code to be left in place with negligible overhead when
+ * profiling is disabled.
+ *
+ * @code
+ * {
+ *     ScopedTimer timer(m_profiling ? &counter : nullptr);
+ *     do_calculations();
+ * }
+ * @endcode
+ *
+ * @ingroup globalUtilFuncs
+ */
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(ProfilingCounter* counter) : m_counter(counter) {
+        if (m_counter) {
+            m_counter->calls++;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedTimer() {
+        if (m_counter) {
+            std::chrono::duration<double> dt = std::chrono::steady_clock::now()
+                                               - m_start;
+            m_counter->time += dt.count();
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    //! Record that the timed section was short-circuited by a cache
+    void hit() {
+        if (m_counter) {
+            m_counter->hits++;
+        }
+    }
+
+private:
+    ProfilingCounter* m_counter;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+}
+
+#endif
@@ -93,6 +93,25 @@ public:
     //! Overwrite source (only required if object is not created using newSolution)
     void setSource(const std::string& source);
 
+    //! Create a new Solution object that shares the mechanism of this object
+    /*!
+     * The new object uses the same Species and Reaction objects as this
+     * object, which avoids processing input data again and keeps a single copy
+     * of immutable mechanism data, i.e. species thermodynamic
+     * parameterizations and transport data as well as reaction definitions.
+     * The new object has its own ThermoPhase, Kinetics and Transport managers,
+     * which hold state information and work arrays, and is initialized to the
+     * current state of this object. Different clones can be used
+     * concurrently by different threads, provided that the shared Species and
+     * Reaction objects are not modified while clones are in use.
+     *
+     * Clones may be created concurrently by multiple threads, provided that
+     * this object is not modified at the same time. Transport property fits
+     * are evaluated separately for each clone. Phases with adjacent phases and
+     * phases derived from VPStandardStateTP are not supported.
+     */
+    shared_ptr<Solution> clone();
+
 protected:
     shared_ptr<ThermoPhase> m_thermo;  //!< ThermoPhase manager
     shared_ptr<Kinetics> m_kinetics;  //!< Kinetics manager
@@ -128,7 +147,9 @@ shared_ptr<Solution> newSolution(const std::string& infile, const std::string& n
 //! Create and initialize a new Solution manager from an input file
 /*!
  * This constructor wraps newPhase(), newKinetics() and
- * newTransportMgr() routines for initialization.
+ * newTransportMgr() routines for initialization. Precompiled binary mechanism
+ * files (extension `.ctb`) are loaded using newSolutionFromBinary(), in which
+ * case the remaining arguments are ignored.
  *
  * @param infile name of the input file
  * @param name   name of the phase in the file.
@@ -75,6 +75,12 @@ public:
         return m_A;
     }
 
+    //! Return the natural logarithm of the pre-exponential factor, or a
+    //! non-finite value if the pre-exponential factor is not positive
+    double logPreExponentialFactor() const {
+        return m_logA;
+    }
+
     //! Return the temperature exponent *b*
     double temperatureExponent() const {
         return m_b;
@@ -191,6 +197,28 @@ public:
     double ddTScaledFromStruct(const ArrheniusData& shared_data) const {
         return (m_Ea_R * shared_data.recipT + m_b) * shared_data.recipT;
     }
+
+    //! Get parameters used for vectorized evaluation of rate constants
+    /*!
+     *  Vectorized evaluators calculate rate constants as
+     *  \f$ k_f = A \exp(b x_1 - E x_2 - E_4 x_3) \f$, where the coordinates
+     *  \f$ x_i \f$ are provided by getExpCoordinates().
+     */
+    void getExpParameters(double& A, double& b, double& E, double& E4) const {
+        A = m_A;
+        b = m_b;
+        E = m_Ea_R;
+        E4 = 0.;
+    }
+
+    //! Get coordinates used for vectorized evaluation of rate constants
+    //! @see getExpParameters
+    static void getExpCoordinates(const ArrheniusData& shared_data,
+                                  double& x1, double& x2, double& x3) {
+        x1 = shared_data.logT;
+        x2 = shared_data.recipT;
+        x3 = 0.;
+    }
 };
 
 
@@ -255,6 +283,24 @@ public:
      */
     double ddTScaledFromStruct(const TwoTempPlasmaData& shared_data) const;
 
+    //! Get parameters used for vectorized evaluation of rate constants
+    //! @see Arrhenius3::getExpParameters
+    void getExpParameters(double& A, double& b, double& E, double& E4) const {
+        A = m_A;
+        b = m_b;
+        E = m_Ea_R;
+        E4 = m_E4_R;
+    }
+
+    //! Get coordinates used for vectorized evaluation of rate constants
+    //! @see Arrhenius3::getExpParameters
+    static void getExpCoordinates(const TwoTempPlasmaData& shared_data,
+                                  double& x1, double& x2, double& x3) {
+        x1 = shared_data.logTe;
+        x2 = shared_data.recipT;
+        x3 = shared_data.recipTe - shared_data.recipT;
+    }
+
     //! Return the electron activation energy *Ea* [J/kmol]
     double activationElectronEnergy() const {
         return m_E4_R * GasConstant;
@@ -350,6 +396,28 @@ public:
      */
     double ddTScaledFromStruct(const BlowersMaselData& shared_data) const;
 
+    //! Get parameters used for vectorized evaluation of rate constants
+    /*!
+     *  The activation energy is the effective value for the reaction enthalpy
+     *  set by the most recent call to updateFromStruct().
+     *  @see Arrhenius3::getExpParameters
+     */
+    void getExpParameters(double& A, double& b, double& E, double& E4) const {
+        A = m_A;
+        b = m_b;
+        E = effectiveActivationEnergy_R(m_deltaH_R);
+        E4 = 0.;
+    }
+
+    //! Get coordinates used for vectorized evaluation of rate constants
+    //! @see Arrhenius3::getExpParameters
+    static void getExpCoordinates(const BlowersMaselData& shared_data,
+                                  double& x1, double& x2, double& x3) {
+        x1 = shared_data.logT;
+        x2 = shared_data.recipT;
+        x3 = 0.;
+    }
+
     //! Return the effective activation energy (a function of the delta H of reaction)
     //! divided by the gas constant (i.e. the activation temperature) [K]
     double effectiveActivationEnergy_R(double deltaH_R) const {
@@ -46,6 +46,7 @@ public:
     virtual void resizeSpecies();
 
     virtual void setMultiplier(size_t i, double f);
+    virtual void setActiveReactions(const std::vector<bool>& active);
     virtual void invalidateCache();
 
     void addThirdBody(shared_ptr<Reaction> r);
@@ -58,6 +59,9 @@ protected:
     std::vector<unique_ptr<MultiRateBase>> m_bulk_rates;
     std::map<std::string, size_t> m_bulk_types; //!< Mapping of rate handlers
 
+    //! Indices of the profiling sections for the rate handlers
+    std::vector<size_t> m_bulk_prof;
+
     Rate1<Arrhenius2> m_rates; //!< @deprecated (legacy only)
     std::vector<size_t> m_revindex; //!< Indices of reversible reactions
     std::vector<size_t> m_irrev; //!< Indices of irreversible reactions
@@ -165,6 +165,16 @@ public:
         return pr * m_rc_high;
     }
 
+    //! Evaluate reaction rate for several states
+    //! @param nStates  number of states
+    //! @param T  temperatures [K]
+    //! @param logT  logarithms of temperatures
+    //! @param recipT  inverse temperatures [1/K]
+    //! @param conc3b  effective third-body concentrations [kmol/m^3]
+    //! @param[out] kf  rate constants
+    void evalBatch(size_t nStates, const double* T, const double* logT,
+                   const double* recipT, const double* conc3b, double* kf);
+
     void check(const std::string& equation, const AnyMap& node);
 
     //! Get flag indicating whether negative A values are permitted
@@ -50,17 +50,126 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(double* kfwd);
 
+    //! Calculate net production rates for several thermodynamic states
+    /*!
+     * Evaluates species net production rates for *nStates* independent states,
+     * for example the cells of a CFD simulation, where each state is specified
+     * by its temperature, pressure and species molar concentrations. Arrays use
+     * a structure-of-arrays layout, where values for all states are stored
+     * contiguously for each species, i.e. `conc[k * nStates + m]` is the
+     * concentration of species *k* in state *m*.
+     *
+     * For ideal gas phases, all steps are evaluated for all states at once
+     * without changing the state of the associated ThermoPhase object: rate
+     * constants (using the pressure of each state for pressure-dependent
+     * rates and the third-body concentrations for falloff rates), equilibrium
+     * constants, third-body concentrations, the law of mass action and the
+     * summation over reactions. Mechanisms with legacy reactions, quasi-steady
+     * species or rate types that do not support batch evaluation (see
+     * MultiRateBase::hasBatchEvaluation), as well as non-ideal phases, are
+     * evaluated state by state, where the pressure follows from the
+     * temperature and concentrations. The state of the ThermoPhase object is
+     * restored before returning in this case.
+     *
+     * @param nStates  Number of states
+     * @param T  Temperatures [K]; length nStates
+     * @param P  Pressures [Pa]; length nStates
+     * @param conc  Species molar concentrations [kmol/m^3]; length
+     *     nStates * nTotalSpecies()
+     * @param[out] wdot  Net production rates [kmol/m^3/s]; length
+     *     nStates * nTotalSpecies()
+     */
+    void getNetProductionRatesBatch(size_t nStates, const double* T,
+                                    const double* P, const double* conc,
+                                    double* wdot);
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
     virtual bool addReaction(shared_ptr<Reaction> r, bool resize=true);
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
+    virtual void resizeSpecies();
     virtual void invalidateCache();
     //! @}
 
     virtual void resizeReactions();
     void updateROP();
 
+    //! @name Tabulated Rate Coefficients
+    //! @{
+
+    //! Enable tabulation of temperature-dependent rate coefficients
+    /*!
+     * Forward rate constants of reactions with Arrhenius rate expressions and
+     * reciprocal equilibrium constants of reversible reactions are tabulated
+     * on a uniform temperature grid. Within the tabulated range, values are
+     * obtained by interpolating their logarithms linearly in 1/T, which is
+     * exact for rate expressions without temperature exponent. Outside of the
+     * range, values are evaluated directly.
+     *
+     * When the table is built, interpolated values are compared to values
+     * evaluated directly at the midpoint of each interval, and an exception is
+     * thrown if the relative error exceeds *rtol*. Tables are rebuilt
+     * automatically after reactions are added or modified; if species
+     * thermodynamic data are modified, this method needs to be called again.
+     * Only ideal gas phases are supported, as equilibrium constants in molar
+     * units are otherwise not a function of temperature only.
+     *
+     * @param Tmin  Lower bound of the tabulated temperature range [K]
+     * @param Tmax  Upper bound of the tabulated temperature range [K]
+     * @param dT  Maximum temperature spacing of the table [K]
+     * @param rtol  Maximum relative interpolation error
+     */
+    void setRateTable(double Tmin, double Tmax, double dT, double rtol=1e-4);
+
+    //! Disable tabulation of rate coefficients enabled by setRateTable()
+    void clearRateTable();
+
+    //! Return true if rate coefficients are tabulated
+    bool rateTableEnabled() const {
+        return m_table_nT > 0;
+    }
+
+    //! Get the parameters most recently passed to setRateTable(). Only
+    //! meaningful if rateTableEnabled() is `true`.
+    void getRateTable(double& Tmin, double& Tmax, double& dT,
+                      double& rtol) const;
+
+    //! @}
+
+    //! @name Quasi-steady-state species
+    //! @{
+
+    //! Treat the named species as quasi-steady.
+    /*!
+     * After the rates of progress are evaluated with the concentrations of the
+     * QSS species excluded, the QSS concentrations are found by Newton
+     * iteration on the subsystem of their net production rates, starting from
+     * the solution of the previous evaluation. Only the reactions involving
+     * QSS species take part in the iteration. Concentrations of QSS species
+     * taken from the phase are only used as third-body collision partners.
+     * Derivatives of the rates of progress are evaluated at the QSS
+     * concentrations, but do not include their dependence on the state.
+     */
+    virtual void setQuasiSteadySpecies(const std::vector<std::string>& names);
+
+    //! Set the relative and absolute (in kmol/m^3) convergence tolerances and
+    //! the maximum number of iterations used to determine the concentrations
+    //! of QSS species.
+    void setQuasiSteadyTolerances(double rtol, double atol, size_t maxIter=50);
+
+    //! Get the settings set by setQuasiSteadyTolerances()
+    void getQuasiSteadyTolerances(double& rtol, double& atol,
+                                  size_t& maxIter) const;
+
+    //! Number of Newton iterations used in the last determination of the
+    //! QSS concentrations
+    size_t quasiSteadyIterations() const {
+        return m_qss_niter;
+    }
+
+    //! @}
+
     virtual void getDerivativeSettings(AnyMap& settings) const;
     virtual void setDerivativeSettings(const AnyMap& settings);
     virtual void getFwdRateConstants_ddT(double* dkfwd);
@@ -138,6 +247,23 @@ protected:
     Eigen::SparseMatrix<double> process_ddX(StoichManagerN& stoich,
                                             const vector_fp& in);
 
+    //! Build tables of rate coefficients requested by setRateTable()
+    void buildRateTable();
+
+    //! Interpolate tabulated rate coefficients
+    //! @param T  temperature [K]; needs to be within the tabulated range
+    //! @param kf  forward rate constants; only tabulated entries are updated
+    //! @param rkcn  reciprocal equilibrium constants of reversible reactions
+    void evalRateTable(double T, double* kf, double* rkcn);
+
+    //! Set up the reactions involving QSS species
+    void buildQuasiSteady();
+
+    //! Determine the QSS concentrations and update the rates of progress of
+    //! the reactions involving QSS species. On entry, these rates of progress
+    //! exclude the concentrations of QSS species.
+    void solveQuasiSteady();
+
     //! Helper function ensuring that all rate derivatives can be calculated
     //! @param name  method name used for error output
     //! @throw  CanteraError if legacy rates are present
@@ -189,6 +315,79 @@ protected:
     vector_fp m_sbuf0;
     vector_fp m_state;
 
+    //! @name Buffers used by getNetProductionRatesBatch
+    //!@{
+    vector_fp m_batch_ropf; //!< forward / net rates of progress
+    vector_fp m_batch_ropr; //!< reverse rates of progress
+    vector_fp m_batch_rkcn; //!< reciprocal equilibrium constants
+    vector_fp m_batch_concm; //!< third-body concentrations
+    vector_fp m_batch_grt; //!< reference state Gibbs functions of the species
+    vector_fp m_batch_ctot; //!< total molar concentrations
+    //!@}
+
+    //! @name Tabulated rate coefficients (see setRateTable)
+    //!@{
+    double m_table_Tmin; //!< Lower bound of tabulated temperature range
+    double m_table_Tmax; //!< Upper bound of tabulated temperature range
+    double m_table_dT; //!< Temperature spacing
+    double m_table_dTmax; //!< Maximum temperature spacing set by the user
+    double m_table_rtol; //!< Relative error tolerance
+    size_t m_table_nT; //!< Number of temperatures (zero if disabled)
+    bool m_table_ok; //!< False if tables need to be rebuilt
+    bool m_table_used; //!< True if tables were used for the last update
+    size_t m_table_evaluator; //!< Index of tabulated evaluator in #m_bulk_rates
+    std::vector<size_t> m_table_rxn; //!< Reactions with tabulated rate constants
+    vector_fp m_table_sign; //!< Signs of tabulated rate constants
+    //! Logarithms of absolute values of tabulated rate constants; the value for
+    //! reaction `m_table_rxn[i]` at temperature `j` is stored at `j * n + i`
+    vector_fp m_table_logkf;
+    //! Logarithms of tabulated reciprocal equilibrium constants, using the same
+    //! layout as #m_table_logkf for reactions in #m_revindex
+    vector_fp m_table_logkc;
+    Eigen::ArrayXd m_table_work; //!< Work array for interpolated values
+    //!@}
+
+    //! @name Quasi-steady-state species (see setQuasiSteadySpecies)
+    //!@{
+
+    //! Participation of QSS species in a single reaction
+    struct QuasiSteadyReaction {
+        size_t rxn; //!< Reaction index
+        //! Indices (in #m_qss) and reaction orders of QSS reactants
+        std::vector<std::pair<size_t, double>> fwd;
+        //! Indices (in #m_qss) and reaction orders of QSS products of reversible
+        //! reactions
+        std::vector<std::pair<size_t, double>> rev;
+        //! Indices (in #m_qss) and net stoichiometric coefficients
+        std::vector<std::pair<size_t, double>> net;
+        double ropf; //!< Forward rate of progress excluding QSS species
+        double ropr; //!< Reverse rate of progress excluding QSS species
+    };
+
+    std::vector<QuasiSteadyReaction> m_qss_rxns;
+    vector_fp m_qss_conc; //!< QSS concentrations; initial guess for the next update
+    double m_qss_rtol; //!< Relative convergence tolerance
+    double m_qss_atol; //!< Absolute convergence tolerance [kmol/m^3]
+    size_t m_qss_maxiter; //!< Maximum number of Newton iterations
+    size_t m_qss_niter; //!< Number of iterations used in the last update
+    bool m_qss_ok; //!< False if #m_qss_rxns needs to be rebuilt
+    Eigen::VectorXd m_qss_resid; //!< Net production rates of QSS species
+    Eigen::MatrixXd m_qss_jac; //!< Jacobian of #m_qss_resid
+    //!@}
+
+    //! @name Indices of profiling sections (see Kinetics::profilingReport())
+    //!@{
+    size_t m_prof_updateROP;
+    size_t m_prof_rates_T;
+    size_t m_prof_rates_C;
+    size_t m_prof_updateKc;
+    size_t m_prof_rateTable;
+    size_t m_prof_thirdBodies;
+    size_t m_prof_falloff;
+    size_t m_prof_stoich;
+    size_t m_prof_qss;
+    //!@}
+
     //! Derivative settings
     bool m_jac_skip_third_bodies;
     bool m_jac_skip_falloff;
@@ -220,6 +419,17 @@ protected:
 
     //! Update the equilibrium constants in molar units.
     void updateKc();
+
+    //! Evaluate the reciprocal equilibrium constants in molar units for
+    //! several states of an ideal gas, storing them in #m_batch_rkcn
+    //! @param nStates  number of states
+    //! @param T  temperatures [K]
+    void updateKcBatch(size_t nStates, const double* T);
+
+    //! Update the standard chemical potentials #m_grt and the standard Gibbs
+    //! free energies of reaction #m_delta_gibbs0 at the current temperature,
+    //! without changing the equilibrium constants
+    void updateDeltaGibbs0();
 };
 
 }
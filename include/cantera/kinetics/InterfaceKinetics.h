@@ -406,12 +406,9 @@ protected:
      */
     std::vector<size_t> m_revindex;
 
-    //! Templated class containing the vector of reactions for this interface
-    /*!
-     *  The templated class is described in RateCoeffMgr.h
-     *  The class SurfaceArrhenius is described in RxnRates.h
-     */
-    Rate1<SurfaceArrhenius> m_rates;
+    //! Evaluator for the rate constants of the reactions of this interface
+    //! which are not Blowers-Masel reactions
+    SurfaceArrheniusBatchEvaluator m_rates;
 
     //! Templated class containing the vector of surface Blowers Masel reactions for this interface
     /*!
@@ -646,21 +643,34 @@ protected:
      */
     vector_int m_phaseIsStable;
 
-    //! Vector of vector of booleans indicating whether a phase participates in
-    //! a reaction as a reactant
-    /*!
-     *  m_rxnPhaseIsReactant[j][p] indicates whether a species in phase p
-     *  participates in reaction j as a reactant.
-     */
-    std::vector<std::vector<bool> > m_rxnPhaseIsReactant;
+    //! Number of 64-bit words in each of the bit sets of phases used by
+    //! #m_rxnPhaseIsReactant, #m_rxnPhaseIsProduct, #m_phaseMissing and
+    //! #m_phaseUnstable. Phase `p` corresponds to bit `p % 64` of word `p / 64`.
+    size_t m_phaseWords;
 
-    //! Vector of vector of booleans indicating whether a phase participates in a
-    //! reaction as a product
+    //! Bit sets of the phases participating in each reaction as reactants
     /*!
-     *  m_rxnPhaseIsReactant[j][p] indicates whether a species in phase p
-     *  participates in reaction j as a product.
+     *  The bit set for reaction `j` is stored in the #m_phaseWords words
+     *  starting at `j * m_phaseWords`.
      */
-    std::vector<std::vector<bool> > m_rxnPhaseIsProduct;
+    std::vector<uint64_t> m_rxnPhaseIsReactant;
+
+    //! Bit sets of the phases participating in each reaction as products
+    //! @see m_rxnPhaseIsReactant
+    std::vector<uint64_t> m_rxnPhaseIsProduct;
+
+    //! Bit set of the phases which don't exist; see setPhaseExistence()
+    std::vector<uint64_t> m_phaseMissing;
+
+    //! Bit set of the phases which are not stable; see setPhaseStability()
+    std::vector<uint64_t> m_phaseUnstable;
+
+    //! Set or clear the bit for phase *p* in the bit set *bits*
+    void setPhaseBit(std::vector<uint64_t>& bits, size_t p, bool value);
+
+    //! Set the bits of the phases of the reactants and products of reaction
+    //! *i* in #m_rxnPhaseIsReactant and #m_rxnPhaseIsProduct
+    void setReactionPhases(size_t i, const Reaction& r);
 
     //! Values used for converting sticking coefficients into rate constants
     struct StickData {
@@ -677,6 +687,15 @@ protected:
 
     int m_ioFlag;
 
+    //! @name Indices of profiling sections (see Kinetics::profilingReport())
+    //!@{
+    size_t m_prof_updateROP;
+    size_t m_prof_rates_T;
+    size_t m_prof_rates_C;
+    size_t m_prof_updateKc;
+    size_t m_prof_stoich;
+    //!@}
+
     //! Number of dimensions of reacting phase (2 for InterfaceKinetics, 1 for
     //! EdgeKinetics)
     size_t m_nDim;
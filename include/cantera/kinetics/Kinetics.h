@@ -13,6 +13,7 @@
 
 #include "StoichManager.h"
 #include "cantera/base/ValueCache.h"
+#include "cantera/base/ScopedTimer.h"
 #include "cantera/kinetics/ReactionFactory.h"
 
 namespace Cantera
@@ -1177,6 +1178,99 @@ public:
 
     virtual void invalidateCache() {};
 
+    //! Set the reactions which are included in the evaluation of rates of
+    //! progress.
+    /*!
+     * Inactive reactions have zero rates of progress, and the evaluation of
+     * their rate constants is skipped. Unlike setting a multiplier to zero,
+     * this leaves the multipliers available for sensitivity analysis. Used for
+     * adaptive mechanism reduction; see DirectedRelationGraph.
+     *
+     * @param active  vector of length nReactions(), where `false` deactivates
+     *     the corresponding reaction. An empty vector activates all reactions.
+     */
+    virtual void setActiveReactions(const std::vector<bool>& active) {
+        throw NotImplementedError("Kinetics::setActiveReactions",
+            "Not applicable/implemented for Kinetics object of type '{}'",
+            kineticsType());
+    }
+
+    //! Flags indicating which reactions are active; empty if all reactions
+    //! are active. @see setActiveReactions()
+    const std::vector<bool>& activeReactions() const {
+        return m_active;
+    }
+
+    //! Treat the named species as quasi-steady.
+    /*!
+     * The concentrations of quasi-steady-state (QSS) species are not taken
+     * from the phase, but are determined from the algebraic condition that
+     * their net production rates vanish, and are updated with the rates of
+     * progress. Reactors may remove QSS species from their state vectors (see
+     * IdealGasConstPressureReactor), which eliminates the fastest time scales
+     * of the governing equations.
+     *
+     * @param names  Names of the QSS species. An empty vector disables the
+     *     QSS approximation.
+     */
+    virtual void setQuasiSteadySpecies(const std::vector<std::string>& names) {
+        throw NotImplementedError("Kinetics::setQuasiSteadySpecies",
+            "Not applicable/implemented for Kinetics object of type '{}'",
+            kineticsType());
+    }
+
+    //! Kinetics species indices of the quasi-steady species; empty if the
+    //! QSS approximation is not used. @see setQuasiSteadySpecies()
+    const std::vector<size_t>& quasiSteadySpecies() const {
+        return m_qss;
+    }
+
+    //! Enable or disable the fused representation of the reaction orders and
+    //! net stoichiometric coefficients (see StoichManagerFused). When enabled,
+    //! the forward and reverse rates of progress are multiplied by the
+    //! concentration products in a single pass, and the net production rates
+    //! are computed as one sparse matrix-vector product, which is faster for
+    //! mechanisms with many reactions. Results may differ from the default
+    //! implementation by round-off error. Disabled by default.
+    void setFusedStoichiometry(bool fused) {
+        m_fusedStoich = fused;
+    }
+
+    //! True if the fused representation of the reaction orders is used.
+    //! @see setFusedStoichiometry()
+    bool fusedStoichiometry() const {
+        return m_fusedStoich;
+    }
+
+    //! @}
+    //! @name Profiling
+    //! @{
+
+    //! Enable or disable the collection of call counts, cache hits and wall
+    //! clock times for the steps of the evaluation of the rates of progress.
+    //! Profiling is disabled by default. Enabling it resets all counters.
+    void setProfiling(bool enable);
+
+    //! True if profiling information is being collected
+    bool profiling() const {
+        return m_profiling;
+    }
+
+    //! Reset all profiling counters to zero
+    void resetProfiling();
+
+    //! Return the collected profiling information
+    /*!
+     * The returned AnyMap contains one entry for each instrumented section of
+     * the kinetics manager, with the number of `calls`, the number of
+     * `cache-hits` (calls where some or all of the work was skipped because
+     * cached values were still valid), and the cumulative wall clock `time` in
+     * seconds. Times of nested sections are included in the time of the
+     * enclosing section, for example the time for `updateROP` includes the
+     * time spent in `update_rates_T`.
+     */
+    AnyMap profilingReport() const;
+
     //! @}
     //! Check for unmarked duplicate reactions and unmatched marked duplicates
     /**
@@ -1266,8 +1360,15 @@ protected:
 
     //! Net stoichiometry (products - reactants)
     Eigen::SparseMatrix<double> m_stoichMatrix;
+
+    //! Fused representation of the reaction orders and net stoichiometry,
+    //! used if #m_fusedStoich is `true`
+    StoichManagerFused m_stoichFused;
     //! @}
 
+    //! @see fusedStoichiometry()
+    bool m_fusedStoich;
+
     //! Boolean indicating whether Kinetics object is fully configured
     bool m_ready;
 
@@ -1279,6 +1380,14 @@ protected:
     /// progress vector. It is initialized to one.
     vector_fp m_perturb;
 
+    //! Flags indicating which reactions are active; empty if all reactions
+    //! are active. @see setActiveReactions()
+    std::vector<bool> m_active;
+
+    //! Kinetics species indices of the quasi-steady species.
+    //! @see setQuasiSteadySpecies()
+    std::vector<size_t> m_qss;
+
     //! Vector of Reaction objects represented by this Kinetics manager
     std::vector<shared_ptr<Reaction> > m_reactions;
 
@@ -1356,6 +1465,21 @@ protected:
 
     //! reference to Solution
     std::weak_ptr<Solution> m_root;
+
+    //! Register a section of code for profiling and return its index
+    size_t addProfilingSection(const std::string& name);
+
+    //! Counter for profiling section *i*, or a null pointer if profiling is
+    //! disabled. To be used with ScopedTimer.
+    ProfilingCounter* profiler(size_t i) {
+        return m_profiling ? &m_profile[i] : nullptr;
+    }
+
+    //! @see profiling()
+    bool m_profiling;
+
+    //! Counters for all profiling sections
+    std::vector<ProfilingCounter> m_profile;
 };
 
 }
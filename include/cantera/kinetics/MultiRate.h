@@ -9,20 +9,36 @@
 #define CT_MULTIRATE_H
 
 #include "ReactionRate.h"
+#include "ReactionData.h"
 #include "MultiRateBase.h"
 #include "cantera/base/utilities.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
 
+//! Placeholder used by MultiRate for rate types that are evaluated one
+//! reaction at a time.
+struct NoBatchEvaluator {};
+
 //! A class template handling ReactionRate specializations.
-template <class RateType, class DataType>
+/*!
+ *  If `BatchType` is specified, rate constants are not evaluated by the
+ *  individual ReactionRate objects, but by a batch evaluator holding the
+ *  parameters of all rates in contiguous arrays. A batch evaluator provides the
+ *  methods `clear()`, `add(size_t, const RateType&)`, `update(const DataType&)`,
+ *  `getRateConstants(const DataType&, double*)` and
+ *  `evalRate(size_t, const DataType&)`; see PlogBatchEvaluator for an example.
+ */
+template <class RateType, class DataType, class BatchType=NoBatchEvaluator>
 class MultiRate final : public MultiRateBase
 {
     CT_DEFINE_HAS_MEMBER(has_update, updateFromStruct)
     CT_DEFINE_HAS_MEMBER(has_ddT, ddTScaledFromStruct)
     CT_DEFINE_HAS_MEMBER(has_ddP, perturbPressure)
     CT_DEFINE_HAS_MEMBER(has_ddM, perturbThirdBodies)
+    CT_DEFINE_HAS_MEMBER(has_exp, getExpParameters)
+    CT_DEFINE_HAS_MEMBER(has_batch, evalBatch)
 
 public:
     virtual std::string type() override {
@@ -36,7 +52,12 @@ public:
     virtual void add(const size_t rxn_index, ReactionRate& rate) override {
         m_indices[rxn_index] = m_rxn_rates.size();
         m_rxn_rates.emplace_back(rxn_index, dynamic_cast<RateType&>(rate));
+        if (!m_active.empty()) {
+            m_active.push_back(true);
+        }
         m_shared.invalidateCache();
+        m_exp_ok = false;
+        m_batch_ok = false;
     }
 
     virtual bool replace(const size_t rxn_index, ReactionRate& rate) override {
@@ -54,6 +75,8 @@ public:
         if (m_indices.find(rxn_index) != m_indices.end()) {
             size_t j = m_indices[rxn_index];
             m_rxn_rates.at(j).second = dynamic_cast<RateType&>(rate);
+            m_exp_ok = false;
+            m_batch_ok = false;
             return true;
         }
         return false;
@@ -64,10 +87,35 @@ public:
         m_shared.invalidateCache();
     }
 
-    virtual void getRateConstants(double* kf) override {
-        for (auto& rxn : m_rxn_rates) {
-            kf[rxn.first] = rxn.second.evalFromStruct(m_shared);
+    virtual void setActiveReactions(const std::vector<bool>& active) override {
+        m_active.clear();
+        if (!active.empty()) {
+            m_active.resize(m_rxn_rates.size());
+            for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+                m_active[i] = active.at(m_rxn_rates[i].first);
+            }
         }
+        m_shared.invalidateCache();
+        m_exp_ok = false;
+        m_batch_ok = false;
+    }
+
+    virtual void getRateConstants(double* kf) override {
+        // call helper function: implementation depends on whether
+        // ReactionRate::getExpParameters is defined
+        _getRateConstants(kf);
+    }
+
+    virtual bool hasBatchEvaluation() const override {
+        return _hasBatchEvaluation();
+    }
+
+    virtual void getRateConstantsBatch(size_t nStates, const double* T,
+                                       const double* P, const double* concm,
+                                       double* kf) override
+    {
+        // call helper function: implementation depends on the rate type
+        _getRateConstantsBatch(nStates, T, P, concm, kf);
     }
 
     virtual void processRateConstants_ddT(double* rop,
@@ -125,23 +173,250 @@ public:
     }
 
 protected:
+    //! Helper function to evaluate rate constants for rate types that use a
+    //! batch evaluator.
+    template <typename B=BatchType,
+        typename std::enable_if<!std::is_same<B, NoBatchEvaluator>::value,
+                                bool>::type = true>
+    void _getRateConstants(double* kf) {
+        _checkBatch();
+        m_batch.getRateConstants(m_shared, kf);
+    }
+
+    //! Helper function to evaluate rate constants for rate types that implement
+    //! the `getExpParameters` method.
+    /*!
+     *  Rate parameters are stored in contiguous arrays, which allows for the
+     *  exponential to be evaluated by a vectorized kernel (Eigen selects SSE,
+     *  AVX or AVX-512 instructions based on compiler flags, with a scalar
+     *  fallback). Results are scattered to the full rate vector afterwards.
+     */
+    template <typename T=RateType, typename B=BatchType,
+        typename std::enable_if<has_exp<T>::value &&
+            std::is_same<B, NoBatchEvaluator>::value, bool>::type = true>
+    void _getRateConstants(double* kf) {
+        _checkExp();
+        size_t n = m_exp_index.size();
+        double x1, x2, x3;
+        RateType::getExpCoordinates(m_shared, x1, x2, x3);
+        m_exp_kf = m_exp_A * (m_exp_b * x1 - m_exp_E * x2 - m_exp_E4 * x3).exp();
+        for (size_t i = 0; i < n; i++) {
+            kf[m_exp_index[i]] = m_exp_kf[i];
+        }
+    }
+
+    //! Collect the parameters of the active rates in the contiguous arrays used
+    //! for vectorized evaluation, if rates were added or modified.
+    template <typename T=RateType,
+        typename std::enable_if<has_exp<T>::value, bool>::type = true>
+    void _checkExp() {
+        if (m_exp_ok) {
+            return;
+        }
+        // collect positions of active rates
+        m_exp_index.clear();
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            if (_active(i)) {
+                m_exp_index.push_back(i);
+            }
+        }
+        size_t n = m_exp_index.size();
+        m_exp_A.resize(n);
+        m_exp_b.resize(n);
+        m_exp_E.resize(n);
+        m_exp_E4.resize(n);
+        m_exp_kf.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            auto& rxn = m_rxn_rates[m_exp_index[i]];
+            m_exp_index[i] = rxn.first;
+            rxn.second.getExpParameters(
+                m_exp_A[i], m_exp_b[i], m_exp_E[i], m_exp_E4[i]);
+        }
+        m_exp_ok = true;
+    }
+
+    //! Helper function for rate types that do not implement `getExpParameters`
+    template <typename T=RateType, typename B=BatchType,
+        typename std::enable_if<!has_exp<T>::value &&
+            std::is_same<B, NoBatchEvaluator>::value, bool>::type = true>
+    void _getRateConstants(double* kf) {
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            if (_active(i)) {
+                kf[m_rxn_rates[i].first] = m_rxn_rates[i].second.evalFromStruct(m_shared);
+            }
+        }
+    }
+
+    //! Helper function indicating whether rate constants can be evaluated for
+    //! several states; this is the case for Arrhenius-type rates that depend on
+    //! temperature only, rate types implementing `evalBatch`, and rate types
+    //! that use a batch evaluator.
+    template <typename R=RateType, typename D=DataType, typename B=BatchType>
+    bool _hasBatchEvaluation() const {
+        return (has_exp<R>::value && std::is_same<D, ArrheniusData>::value)
+            || has_batch<R>::value || !std::is_same<B, NoBatchEvaluator>::value;
+    }
+
+    //! Helper function to evaluate rate constants for several states for
+    //! Arrhenius-type rates that depend on temperature only. The exponentials
+    //! are evaluated by a vectorized kernel over all states for each rate.
+    template <typename R=RateType, typename D=DataType, typename B=BatchType,
+        typename std::enable_if<has_exp<R>::value &&
+            std::is_same<D, ArrheniusData>::value &&
+            std::is_same<B, NoBatchEvaluator>::value, bool>::type = true>
+    void _getRateConstantsBatch(size_t nStates, const double* T,
+                                const double* P, const double* concm, double* kf)
+    {
+        _checkExp();
+        Eigen::Map<const Eigen::ArrayXd> temp(T, nStates);
+        m_batch_logT = temp.log();
+        m_batch_recipT = temp.inverse();
+        for (size_t i = 0; i < m_exp_index.size(); i++) {
+            Eigen::Map<Eigen::ArrayXd> k(kf + m_exp_index[i] * nStates, nStates);
+            k = m_exp_A[i] *
+                (m_exp_b[i] * m_batch_logT - m_exp_E[i] * m_batch_recipT).exp();
+        }
+    }
+
+    //! Helper function to evaluate rate constants for several states for rate
+    //! types that implement the `evalBatch` method.
+    template <typename R=RateType, typename B=BatchType,
+        typename std::enable_if<has_batch<R>::value &&
+            std::is_same<B, NoBatchEvaluator>::value, bool>::type = true>
+    void _getRateConstantsBatch(size_t nStates, const double* T,
+                                const double* P, const double* concm, double* kf)
+    {
+        Eigen::Map<const Eigen::ArrayXd> temp(T, nStates);
+        m_batch_logT = temp.log();
+        m_batch_recipT = temp.inverse();
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            if (_active(i)) {
+                size_t j = m_rxn_rates[i].first * nStates;
+                m_rxn_rates[i].second.evalBatch(nStates, T, m_batch_logT.data(),
+                    m_batch_recipT.data(), concm + j, kf + j);
+            }
+        }
+    }
+
+    //! Helper function to evaluate rate constants for several states for rate
+    //! types that use a batch evaluator. The pressure-dependent parts of the
+    //! batch evaluator are updated for each state, and restored for the current
+    //! state of #m_shared afterwards.
+    template <typename B=BatchType,
+        typename std::enable_if<!std::is_same<B, NoBatchEvaluator>::value,
+                                bool>::type = true>
+    void _getRateConstantsBatch(size_t nStates, const double* T,
+                                const double* P, const double* concm, double* kf)
+    {
+        _checkBatch();
+        size_t nRxn = 0;
+        for (const auto& rxn : m_rxn_rates) {
+            nRxn = std::max(nRxn, rxn.first + 1);
+        }
+        m_batch_kf.resize(nRxn);
+        for (size_t m = 0; m < nStates; m++) {
+            m_batch_shared.update(T[m], P[m]);
+            m_batch.update(m_batch_shared);
+            m_batch.getRateConstants(m_batch_shared, m_batch_kf.data());
+            for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+                if (_active(i)) {
+                    size_t j = m_rxn_rates[i].first;
+                    kf[j * nStates + m] = m_batch_kf[j];
+                }
+            }
+        }
+        m_batch.update(m_shared);
+    }
+
+    //! Helper function for rate types that cannot be evaluated for several
+    //! states (see _hasBatchEvaluation())
+    template <typename R=RateType, typename D=DataType, typename B=BatchType,
+        typename std::enable_if<
+            !(has_exp<R>::value && std::is_same<D, ArrheniusData>::value) &&
+            !has_batch<R>::value && std::is_same<B, NoBatchEvaluator>::value,
+            bool>::type = true>
+    void _getRateConstantsBatch(size_t nStates, const double* T,
+                                const double* P, const double* concm, double* kf)
+    {
+        throw NotImplementedError("MultiRate::getRateConstantsBatch",
+            "Not implemented for rate type '{}'.", type());
+    }
+
+    //! Helper function to process updates for rate types that use a batch
+    //! evaluator. Individual rate objects are only updated by evalSingle().
+    template <typename B=BatchType,
+        typename std::enable_if<!std::is_same<B, NoBatchEvaluator>::value,
+                                bool>::type = true>
+    void _update() {
+        _checkBatch();
+        m_batch.update(m_shared);
+    }
+
     //! Helper function to process updates for rate types that implement the
     //! `updateFromStruct` method.
-    template <typename T=RateType,
-        typename std::enable_if<has_update<T>::value, bool>::type = true>
+    template <typename T=RateType, typename B=BatchType,
+        typename std::enable_if<has_update<T>::value &&
+            std::is_same<B, NoBatchEvaluator>::value, bool>::type = true>
     void _update() {
-        for (auto& rxn : m_rxn_rates) {
-            rxn.second.updateFromStruct(m_shared);
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            if (_active(i)) {
+                m_rxn_rates[i].second.updateFromStruct(m_shared);
+            }
         }
+        m_exp_ok = false;
     }
 
     //! Helper function for rate types that do not implement `updateFromStruct`.
     //! Does nothing, but exists to allow generic implementations of update().
-    template <typename T=RateType,
-        typename std::enable_if<!has_update<T>::value, bool>::type = true>
+    template <typename T=RateType, typename B=BatchType,
+        typename std::enable_if<!has_update<T>::value &&
+            std::is_same<B, NoBatchEvaluator>::value, bool>::type = true>
     void _update() {
     }
 
+    //! True if the rate constant of the `i`-th rate is evaluated
+    bool _active(size_t i) const {
+        return m_active.empty() || m_active[i];
+    }
+
+    //! Rebuild the contiguous parameter arrays of the batch evaluator after
+    //! rates were added or replaced.
+    template <typename B=BatchType,
+        typename std::enable_if<!std::is_same<B, NoBatchEvaluator>::value,
+                                bool>::type = true>
+    void _checkBatch() {
+        if (!m_batch_ok) {
+            m_batch.clear();
+            m_batch_pos.assign(m_rxn_rates.size(), npos);
+            size_t pos = 0;
+            for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+                if (_active(i)) {
+                    m_batch.add(m_rxn_rates[i].first, m_rxn_rates[i].second);
+                    m_batch_pos[i] = pos++;
+                }
+            }
+            m_batch_ok = true;
+        }
+    }
+
+    //! Helper function to evaluate the rate constant of the `i`-th rate handled
+    //! by a batch evaluator at the current state.
+    template <typename B=BatchType,
+        typename std::enable_if<!std::is_same<B, NoBatchEvaluator>::value,
+                                bool>::type = true>
+    double _evalRate(size_t i) {
+        return m_batch.evalRate(m_batch_pos[i], m_shared);
+    }
+
+    //! Helper function to evaluate the rate constant of the `i`-th rate at the
+    //! current state.
+    template <typename B=BatchType,
+        typename std::enable_if<std::is_same<B, NoBatchEvaluator>::value,
+                                bool>::type = true>
+    double _evalRate(size_t i) {
+        return m_rxn_rates[i].second.evalFromStruct(m_shared);
+    }
+
     //! Helper function to update a single rate that has an `updateFromStruct method`.
     template <typename T=RateType,
         typename std::enable_if<has_update<T>::value, bool>::type = true>
@@ -177,10 +452,13 @@ protected:
         _update();
 
         // apply numerical derivative
-        for (auto& rxn : m_rxn_rates) {
-            if (kf[rxn.first] != 0.) {
-                double k1 = rxn.second.evalFromStruct(m_shared);
-                rop[rxn.first] *= dTinv * (k1 / kf[rxn.first] - 1.);
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            size_t j = m_rxn_rates[i].first;
+            if (!_active(i)) {
+                rop[j] = 0.;
+            } else if (kf[j] != 0.) {
+                double k1 = _evalRate(i);
+                rop[j] *= dTinv * (k1 / kf[j] - 1.);
             } // else not needed: derivative is already zero
         }
 
@@ -198,13 +476,14 @@ protected:
         m_shared.perturbThirdBodies(deltaM);
         _update();
 
-        for (auto& rxn : m_rxn_rates) {
-            if (kf[rxn.first] != 0. && m_shared.conc_3b[rxn.first] > 0.) {
-                double k1 = rxn.second.evalFromStruct(m_shared);
-                rop[rxn.first] *= dMinv * (k1 / kf[rxn.first] - 1.);
-                rop[rxn.first] /= m_shared.conc_3b[rxn.first];
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            size_t j = m_rxn_rates[i].first;
+            if (_active(i) && kf[j] != 0. && m_shared.conc_3b[j] > 0.) {
+                double k1 = _evalRate(i);
+                rop[j] *= dMinv * (k1 / kf[j] - 1.);
+                rop[j] /= m_shared.conc_3b[j];
             } else {
-                rop[rxn.first] = 0.;
+                rop[j] = 0.;
             }
         }
 
@@ -235,10 +514,13 @@ protected:
         m_shared.perturbPressure(deltaP);
         _update();
 
-        for (auto& rxn : m_rxn_rates) {
-            if (kf[rxn.first] != 0.) {
-                double k1 = rxn.second.evalFromStruct(m_shared);
-                rop[rxn.first] *= dPinv * (k1 / kf[rxn.first] - 1.);
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            size_t j = m_rxn_rates[i].first;
+            if (!_active(i)) {
+                rop[j] = 0.;
+            } else if (kf[j] != 0.) {
+                double k1 = _evalRate(i);
+                rop[j] *= dPinv * (k1 / kf[j] - 1.);
             } // else not needed: derivative is already zero
         }
 
@@ -260,6 +542,37 @@ protected:
     std::vector<std::pair<size_t, RateType>> m_rxn_rates;
     std::map<size_t, size_t> m_indices; //! Mapping of indices
     DataType m_shared;
+
+    //! @name Contiguous storage used for vectorized rate evaluation
+    //! Only used for rate types that implement `getExpParameters`.
+    //!@{
+    bool m_exp_ok = false; //!< Flag indicating whether arrays are up to date
+    std::vector<size_t> m_exp_index; //!< Reaction indices
+    Eigen::ArrayXd m_exp_A; //!< Pre-exponential factors
+    Eigen::ArrayXd m_exp_b; //!< Temperature exponents
+    Eigen::ArrayXd m_exp_E; //!< Activation energies (temperature units)
+    Eigen::ArrayXd m_exp_E4; //!< Secondary activation energies (temperature units)
+    Eigen::ArrayXd m_exp_kf; //!< Work array for rate constants
+    //!@}
+
+    //! @name Work arrays used by getRateConstantsBatch()
+    //!@{
+    Eigen::ArrayXd m_batch_logT; //!< Logarithms of temperatures
+    Eigen::ArrayXd m_batch_recipT; //!< Inverse temperatures
+    //! Shared data for a single state; only used if `BatchType` is specified
+    DataType m_batch_shared;
+    vector_fp m_batch_kf; //!< Rate constants for a single state
+    //!@}
+
+    //! Batch evaluator; only used if `BatchType` is specified
+    BatchType m_batch;
+    bool m_batch_ok = false; //!< Flag indicating whether #m_batch is up to date
+    //! Position of each rate within #m_batch; `npos` for inactive rates
+    std::vector<size_t> m_batch_pos;
+
+    //! Flags indicating which rate constants are evaluated; empty if all rate
+    //! constants are evaluated. @see setActiveReactions()
+    std::vector<bool> m_active;
 };
 
 }
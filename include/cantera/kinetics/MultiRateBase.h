@@ -46,10 +46,36 @@ public:
     //! @param n_reactions  number of reactions
     virtual void resize(size_t n_species, size_t n_reactions) = 0;
 
+    //! Set the reactions for which rate constants are evaluated
+    //! @param active  vector indexed by reaction, where `false` indicates that
+    //!     the rate constant is not needed; an empty vector selects all reactions
+    virtual void setActiveReactions(const std::vector<bool>& active) = 0;
+
     //! Evaluate all rate constants handled by the evaluator
     //! @param kf  array of rate constants
     virtual void getRateConstants(double* kf) = 0;
 
+    //! Return `true` if getRateConstantsBatch() is implemented for the rate
+    //! type handled by the evaluator
+    virtual bool hasBatchEvaluation() const = 0;
+
+    //! Evaluate all rate constants handled by the evaluator for *nStates*
+    //! independent states.
+    //! Arrays use a structure-of-arrays layout, where values for all states are
+    //! stored contiguously for each reaction, i.e. `kf[i * nStates + m]` is the
+    //! rate constant of reaction *i* in state *m*. Entries of reactions not
+    //! handled by the evaluator are not modified. The rate constants evaluated
+    //! by getRateConstants() for the current state are not affected.
+    //! @param nStates  number of states
+    //! @param T  temperatures [K]; length nStates
+    //! @param P  pressures [Pa]; length nStates
+    //! @param concm  effective third-body concentrations [kmol/m^3], using the
+    //!     same layout as *kf*
+    //! @param kf  array of rate constants
+    virtual void getRateConstantsBatch(size_t nStates, const double* T,
+                                       const double* P, const double* concm,
+                                       double* kf) = 0;
+
     //! Evaluate all rate constant temperature derivatives handled by the evaluator;
     //! which are multiplied with the array of rate-of-progress variables.
     //! Depending on the implementation of a rate object, either an exact derivative or
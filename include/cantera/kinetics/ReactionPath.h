@@ -329,6 +329,113 @@ protected:
     std::map<std::string, size_t> m_enamemap;
 };
 
+
+//! Directed relation graph used to identify the species and reactions that are
+//! relevant for a set of target species at the current state.
+/*!
+ * The direct interaction coefficient \f$ r_{AB} \f$ measures the error
+ * introduced in the net production rate of species *A* by removing species *B*.
+ * Two definitions are supported:
+ *
+ *  - `"DRG"` (Lu & Law, Proc. Combust. Inst. 30, 2005):
+ *    \f[ r_{AB} = \frac{\sum_i |\nu_{A,i} \omega_i \delta_{B,i}|}
+ *                       {\sum_i |\nu_{A,i} \omega_i|} \f]
+ *  - `"DRGEP"` (Pepiot-Desjardins & Pitsch, Combust. Flame 154, 2008):
+ *    \f[ r_{AB} = \frac{|\sum_i \nu_{A,i} \omega_i \delta_{B,i}|}
+ *                       {\max(P_A, C_A)} \f]
+ *
+ * where \f$ \nu_{A,i} \f$ is the net stoichiometric coefficient of *A* in
+ * reaction *i*, \f$ \omega_i \f$ is the net rate of progress, \f$
+ * \delta_{B,i} \f$ is one if *B* participates in reaction *i* and zero
+ * otherwise, and \f$ P_A \f$ and \f$ C_A \f$ are the production and
+ * consumption rates of *A*.
+ *
+ * The importance \f$ R_B \f$ of each species is the maximum over all paths
+ * from any of the target species to *B* of the minimum (DRG) or the product
+ * (DRGEP) of the interaction coefficients along the path, where target species
+ * have an importance of one. It is found with a variant of Dijkstra's algorithm.
+ * For a threshold \f$ \epsilon \f$, species with \f$ R_B < \epsilon \f$ and
+ * all reactions involving them can be removed from the mechanism.
+ */
+class DirectedRelationGraph
+{
+public:
+    //! Constructor
+    //! @param kin  Kinetics manager containing the reactions to be analyzed
+    //! @param method  Definition of interaction coefficients, either `"DRG"` or
+    //!     `"DRGEP"`
+    DirectedRelationGraph(Kinetics& kin, const std::string& method="DRGEP");
+
+    //! Definition of interaction coefficients, either `"DRG"` or `"DRGEP"`
+    const std::string& method() const {
+        return m_method;
+    }
+
+    //! Set the target species, which are always retained
+    void setTargets(const std::vector<std::string>& species);
+
+    //! Indices of the target species
+    const std::vector<size_t>& targets() const {
+        return m_targets;
+    }
+
+    //! Update the interaction coefficients and species importances for the
+    //! current state of the kinetics manager. Rates of progress are evaluated
+    //! with all reactions active.
+    void update();
+
+    //! Update the interaction coefficients and species importances for the
+    //! given net rates of progress (length Kinetics::nReactions())
+    void update(const double* ropnet);
+
+    //! Direct interaction coefficient of species *kA* with species *kB*
+    double interactionCoefficient(size_t kA, size_t kB) const;
+
+    //! Importance of species *k* for the target species
+    double importance(size_t k) const {
+        return m_importance[k];
+    }
+
+    //! Number of species with an importance of at least *threshold*
+    size_t nActiveSpecies(double threshold) const;
+
+    //! Get the reactions whose participants all have an importance of at least
+    //! *threshold*
+    //! @param threshold  Minimum importance of retained species
+    //! @param[out] active  Vector of length Kinetics::nReactions(), where `true`
+    //!     marks retained reactions
+    void getActiveReactions(double threshold, std::vector<bool>& active) const;
+
+protected:
+    Kinetics* m_kin; //!< Analyzed kinetics manager
+    std::string m_method; //!< Definition of interaction coefficients
+    std::vector<size_t> m_targets; //!< Indices of target species
+
+    //! Species participating in each reaction and their net stoichiometric
+    //! coefficients. Participants of reaction *i* are found at positions
+    //! `m_part0[i]` to `m_part0[i+1]`.
+    std::vector<size_t> m_part0;
+    std::vector<size_t> m_partSpecies; //!< Participating species
+    vector_fp m_partNu; //!< Net stoichiometric coefficients
+
+    //! Edges (A, B) of the graph in compressed sparse row format, where the
+    //! edges starting at species *A* are found at positions `m_edge0[A]` to
+    //! `m_edge0[A+1]`
+    std::vector<size_t> m_edge0;
+    std::vector<size_t> m_edgeTarget; //!< Species *B* of each edge
+
+    //! Edge corresponding to each ordered pair of participants of each
+    //! reaction, in the order of the loops in update(const double*)
+    std::vector<size_t> m_pairEdge;
+
+    vector_fp m_num; //!< Numerators of the interaction coefficients
+    vector_fp m_coeffs; //!< Direct interaction coefficients of each edge
+    vector_fp m_prod; //!< Production rates (DRGEP) or sums of magnitudes (DRG)
+    vector_fp m_cons; //!< Consumption rates (DRGEP only)
+    vector_fp m_importance; //!< Overall importance of each species
+    vector_fp m_ropnet; //!< Work array for net rates of progress
+};
+
 }
 
 #endif
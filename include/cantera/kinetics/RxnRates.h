@@ -14,6 +14,7 @@
 #include "cantera/kinetics/reaction_defs.h"
 #include "cantera/kinetics/Arrhenius.h"
 #include "MultiRate.h"
+#include "cantera/numerics/eigen_sparse.h"
 #include "cantera/base/Array.h"
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/global.h"
@@ -187,6 +188,80 @@ protected:
     doublereal m_acov, m_ecov, m_mcov;
     std::vector<size_t> m_sp, m_msp;
     vector_fp m_ac, m_ec, m_mc;
+
+    friend class SurfaceArrheniusBatchEvaluator;
+};
+
+//! Evaluates rate constants of all SurfaceArrhenius rates of an
+//! InterfaceKinetics object at once.
+/*!
+ * This class is a replacement for `Rate1<SurfaceArrhenius>`. The Arrhenius
+ * parameters of all rates are stored in contiguous arrays, and the coverage
+ * dependencies are stored in sparse matrices with one row per rate and one
+ * column per surface species. The coverage-dependent modifications of the
+ * pre-exponential factors and activation energies are computed for all rates
+ * by sparse matrix-vector products with the coverages and their logarithms,
+ * and the rate constants are then evaluated with a single vectorized
+ * expression. The arrays are rebuilt when rates are installed or replaced.
+ */
+class SurfaceArrheniusBatchEvaluator
+{
+public:
+    SurfaceArrheniusBatchEvaluator() : m_ok(false), m_nsp(0) {}
+
+    //! Install the rate for the reaction with index *rxnNumber*
+    void install(size_t rxnNumber, const SurfaceArrhenius& rate);
+
+    //! Replace the rate for the reaction with index *rxnNumber*
+    void replace(size_t rxnNumber, const SurfaceArrhenius& rate);
+
+    //! Number of rates
+    size_t nReactions() const {
+        return m_rates.size();
+    }
+
+    //! Update the coverage-dependent parts of the rate constants for the
+    //! surface species coverages *theta*
+    void update_C(const double* theta);
+
+    //! Write the rate constants into *values*, which is indexed by reaction
+    void update(double T, double logT, double* values);
+
+    //! Effective pre-exponential factor of reaction *irxn*, accounting for
+    //! the coverage dependence
+    double effectivePreExponentialFactor(size_t irxn);
+
+    //! Effective activation energy divided by the gas constant of reaction
+    //! *irxn*, accounting for the coverage dependence
+    double effectiveActivationEnergy_R(size_t irxn);
+
+    //! Temperature exponent of reaction *irxn*
+    double effectiveTemperatureExponent(size_t irxn);
+
+protected:
+    //! Build the parameter arrays and coverage dependence matrices
+    void build();
+
+    //! Index of the rate for reaction *irxn*
+    size_t rateIndex(size_t irxn) const;
+
+    std::vector<SurfaceArrhenius> m_rates; //!< Rates in order of installation
+    std::vector<size_t> m_rxn; //!< Reaction indices
+    std::map<size_t, size_t> m_indices; //!< Map reaction index to rate index
+    bool m_ok; //!< `true` if the arrays are up to date
+
+    size_t m_nsp; //!< Number of surface species with coverage dependencies
+    Eigen::ArrayXd m_A, m_b, m_E; //!< Arrhenius parameters
+    //! Coverage dependence of log10 of the pre-exponential factors
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_acov_coeffs;
+    //! Coverage dependence of the activation energies
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_ecov_coeffs;
+    //! Power-law coverage dependence of the rates
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_mcov_coeffs;
+    Eigen::VectorXd m_theta; //!< Coverages
+    Eigen::VectorXd m_logTheta; //!< Logarithms of the coverages
+    Eigen::VectorXd m_acov, m_ecov, m_mcov; //!< Current coverage terms
+    Eigen::ArrayXd m_kf; //!< Work array for the rate constants
 };
 
 
@@ -197,6 +272,154 @@ typedef Arrhenius2 Arrhenius;
 #endif
 
 
+class PlogRate;
+class ChebyshevRate;
+
+//! Evaluates rate constants of all PlogRate objects handled by a MultiRate
+//! object at once.
+/*!
+ * The pressure grids and Arrhenius parameters of all rates are stored in
+ * contiguous arrays. Rates that share the same pressure grid, which is common
+ * in mechanisms generated from a single master equation calculation, also
+ * share the search for the interpolation interval, which is only repeated when
+ * the pressure changes. For each reaction, the parameters of the Arrhenius
+ * expressions at the lower and upper interpolation pressures are then gathered
+ * into arrays, so the temperature-dependent part can be evaluated for all
+ * reactions with a single vectorized expression.
+ */
+class PlogBatchEvaluator
+{
+public:
+    PlogBatchEvaluator() : m_logP(NAN), m_grid0(1, 0) {}
+
+    //! Remove all rates
+    void clear();
+
+    //! Add a rate for the reaction with index `rxn_index`
+    void add(size_t rxn_index, const PlogRate& rate);
+
+    //! Update the interpolation intervals if the pressure has changed
+    void update(const PlogData& shared_data);
+
+    //! Evaluate rate constants, where `kf` is indexed by reaction
+    void getRateConstants(const PlogData& shared_data, double* kf);
+
+    //! Evaluate the rate constant of the `i`-th rate added
+    double evalRate(size_t i, const PlogData& shared_data);
+
+protected:
+    double m_logP; //!< log(p) used for the current interpolation intervals
+
+    //! @name Rate parameters
+    //!@{
+    std::vector<size_t> m_index; //!< Reaction indices
+    std::vector<size_t> m_grid; //!< Pressure grid used by each rate
+    std::vector<size_t> m_node0; //!< Offset of each rate within #m_nodes
+    //! Ranges of Arrhenius expressions (within #m_A, #m_b and #m_E) belonging to
+    //! each interpolation pressure of each rate
+    std::vector<std::pair<size_t, size_t>> m_nodes;
+    vector_fp m_A; //!< Pre-exponential factors
+    vector_fp m_logA; //!< Logarithms of pre-exponential factors
+    vector_fp m_b; //!< Temperature exponents
+    vector_fp m_E; //!< Activation energies (temperature units)
+    //!@}
+
+    //! @name Distinct pressure grids
+    //!@{
+    std::map<vector_fp, size_t> m_gridIndex; //!< Mapping of grids to indices
+    //! Offsets of the grids within #m_gridLogP, where grid `g` spans the range
+    //! from `m_grid0[g]` to `m_grid0[g+1]`
+    std::vector<size_t> m_grid0;
+    vector_fp m_gridLogP; //!< Concatenated log(p) values of all grids
+    std::vector<size_t> m_gridLow; //!< Index of lower interpolation pressure
+    vector_fp m_gridFrac; //!< Interpolation weight of upper pressure
+    //!@}
+
+    //! @name Parameters at the current interpolation pressures
+    //! Values for suffix `1` and `2` refer to the lower and upper interpolation
+    //! pressures, respectively.
+    //!@{
+    Eigen::ArrayXd m_logA1, m_b1, m_E1, m_logA2, m_b2, m_E2;
+    std::vector<size_t> m_low; //!< Node within #m_nodes at lower pressure
+    Eigen::ArrayXd m_frac; //!< Interpolation weights
+    Eigen::ArrayXd m_logk1, m_logk2; //!< Work arrays
+    Eigen::ArrayXd m_kf; //!< Work array for rate constants
+    //! Rates with more than one Arrhenius expression at either of the current
+    //! interpolation pressures, which are evaluated separately
+    std::vector<size_t> m_multi;
+    //!@}
+
+    //! Logarithm of the sum of the Arrhenius expressions in node `j`
+    double evalNode(size_t j, double logT, double recipT) const;
+};
+
+//! Evaluates rate constants of all ChebyshevRate objects handled by a
+//! MultiRate object at once.
+/*!
+ * Rates with the same temperature and pressure ranges and the same number of
+ * coefficients are grouped, and the coefficients of each group are stored in
+ * one matrix. For each group, the Chebyshev polynomials of the reduced pressure
+ * and reduced temperature are evaluated only once and applied to all rates of
+ * the group using matrix-vector products. The pressure-dependent part is only
+ * recalculated when the pressure changes.
+ */
+class ChebyshevBatchEvaluator
+{
+public:
+    ChebyshevBatchEvaluator() : m_log10P(NAN) {}
+
+    //! Remove all rates
+    void clear();
+
+    //! Add a rate for the reaction with index `rxn_index`
+    void add(size_t rxn_index, const ChebyshevRate& rate);
+
+    //! Update the pressure-dependent parts if the pressure has changed
+    void update(const ChebyshevData& shared_data);
+
+    //! Evaluate rate constants, where `kf` is indexed by reaction
+    void getRateConstants(const ChebyshevData& shared_data, double* kf);
+
+    //! Evaluate the rate constant of the `i`-th rate added
+    double evalRate(size_t i, const ChebyshevData& shared_data);
+
+protected:
+    //! Rates sharing temperature and pressure ranges and number of coefficients
+    struct Group {
+        double TrNum, TrDen; //!< terms appearing in the reduced temperature
+        double PrNum, PrDen; //!< terms appearing in the reduced pressure
+        size_t nT, nP; //!< number of coefficients in T and P directions
+        std::vector<size_t> index; //!< Reaction indices
+        //! Coefficients, where row `t * n + i` holds the coefficients of the
+        //! `t`-th temperature polynomial for the `i`-th of `n` rates
+        Eigen::MatrixXd coeffs;
+        //! Dot products of #coeffs with the reduced pressure polynomials, where
+        //! column `t` corresponds to the `t`-th temperature polynomial
+        Eigen::MatrixXd dotProd;
+        Eigen::VectorXd logk; //!< Work array for rate constants
+    };
+
+    //! Evaluate Chebyshev polynomials of the first kind of degree 0 to
+    //! `out.size() - 1` at `x`
+    static void chebyshev(double x, Eigen::VectorXd& out);
+
+    double m_log10P; //!< log10(p) used for the current dot products
+    std::vector<Group> m_groups;
+    std::map<std::tuple<double, double, double, double, size_t, size_t>,
+             size_t> m_groupIndex; //!< Mapping of group parameters to index
+    //! Group and position within group for each rate
+    std::vector<std::pair<size_t, size_t>> m_position;
+    Eigen::VectorXd m_phiT; //!< Work array for temperature polynomials
+    Eigen::VectorXd m_phiP; //!< Work array for pressure polynomials
+    //! Coefficients collected by add() before the group matrices are assembled
+    std::vector<std::vector<Array2D>> m_pending;
+    bool m_ready = true; //!< Flag indicating whether group matrices are assembled
+
+    //! Assemble the coefficient matrices of all groups
+    void finalize();
+};
+
+
 //! Pressure-dependent reaction rate expressed by logarithmically interpolating
 //! between Arrhenius rate expressions at various pressures.
 /*!
@@ -232,7 +455,8 @@ public:
     }
 
     unique_ptr<MultiRateBase> newMultiRate() const {
-        return unique_ptr<MultiRateBase>(new MultiRate<PlogRate, PlogData>);
+        return unique_ptr<MultiRateBase>(
+            new MultiRate<PlogRate, PlogData, PlogBatchEvaluator>);
     }
 
     //! Identifier of reaction rate type
@@ -366,6 +590,8 @@ public:
     std::multimap<double, Arrhenius3> getRates() const;
 
 protected:
+    friend class PlogBatchEvaluator;
+
     //! log(p) to (index range) in the rates_ vector
     std::map<double, std::pair<size_t, size_t>> pressures_;
 
@@ -442,7 +668,8 @@ public:
 
     unique_ptr<MultiRateBase> newMultiRate() const {
         return unique_ptr<MultiRateBase>(
-            new MultiRate<ChebyshevRate, ChebyshevData>);
+            new MultiRate<ChebyshevRate, ChebyshevData,
+                          ChebyshevBatchEvaluator>);
     }
 
     const std::string type() const { return "Chebyshev"; }
@@ -147,6 +147,14 @@ public:
         R[m_rxn] *= S[m_ic0];
     }
 
+    void multiply(const double* S, double* R, size_t nStates) const {
+        const double* s0 = S + m_ic0 * nStates;
+        double* r = R + m_rxn * nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            r[m] *= s0[m];
+        }
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0];
     }
@@ -209,6 +217,16 @@ public:
         }
     }
 
+    void multiply(const double* S, double* R, size_t nStates) const {
+        const double* s0 = S + m_ic0 * nStates;
+        const double* s1 = S + m_ic1 * nStates;
+        double* r = R + m_rxn * nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            bool zero = (s0[m] < 0 && s1[m] < 0);
+            r[m] = zero ? 0.0 : r[m] * s0[m] * s1[m];
+        }
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1];
     }
@@ -280,6 +298,18 @@ public:
         }
     }
 
+    void multiply(const double* S, double* R, size_t nStates) const {
+        const double* s0 = S + m_ic0 * nStates;
+        const double* s1 = S + m_ic1 * nStates;
+        const double* s2 = S + m_ic2 * nStates;
+        double* r = R + m_rxn * nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            bool zero = (s0[m] < 0 && (s1[m] < 0 || s2[m] < 0)) ||
+                        (s1[m] < 0 && s2[m] < 0);
+            r[m] = zero ? 0.0 : r[m] * s0[m] * s1[m] * s2[m];
+        }
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1] + S[m_ic2];
     }
@@ -365,6 +395,19 @@ public:
         }
     }
 
+    void multiply(const double* input, double* output, size_t nStates) const {
+        double* r = output + m_rxn * nStates;
+        for (size_t n = 0; n < m_n; n++) {
+            double order = m_order[n];
+            if (order != 0.0) {
+                const double* c = input + m_ic[n] * nStates;
+                for (size_t m = 0; m < nStates; m++) {
+                    r[m] = (c[m] > 0.0) ? r[m] * std::pow(c[m], order) : 0.0;
+                }
+            }
+        }
+    }
+
     void incrementSpecies(const doublereal* input,
                           doublereal* output) const {
         doublereal x = input[m_rxn];
@@ -491,6 +534,16 @@ inline static void _multiply(InputIter begin, InputIter end,
     }
 }
 
+template<class InputIter>
+inline static void _multiply(InputIter begin, InputIter end,
+                             const double* input, double* output,
+                             size_t nStates)
+{
+    for (; begin != end; ++begin) {
+        begin->multiply(input, output, nStates);
+    }
+}
+
 template<class InputIter, class Vec1, class Vec2>
 inline static void _incrementSpecies(InputIter begin,
                                      InputIter end, const Vec1& input, Vec2& output)
@@ -740,6 +793,20 @@ public:
         _multiply(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
+    //! Multiply rates of progress for several states by the concentration
+    //! dependence of the law of mass action.
+    /*!
+     *  Arrays use a structure-of-arrays layout, where `input[k * nStates + m]`
+     *  is the concentration of species *k* in state *m* and
+     *  `output[i * nStates + m]` is the rate for reaction *i* in state *m*.
+     */
+    void multiply(const double* input, double* output, size_t nStates) const {
+        _multiply(m_c1_list.begin(), m_c1_list.end(), input, output, nStates);
+        _multiply(m_c2_list.begin(), m_c2_list.end(), input, output, nStates);
+        _multiply(m_c3_list.begin(), m_c3_list.end(), input, output, nStates);
+        _multiply(m_cn_list.begin(), m_cn_list.end(), input, output, nStates);
+    }
+
     void incrementSpecies(const doublereal* input, doublereal* output) const {
         _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
@@ -832,6 +899,243 @@ private:
     vector_fp m_values;
 };
 
+
+
+//! Fused evaluation of the concentration dependence of rates of progress
+/*!
+ * This class is an alternative to the pair of StoichManagerN objects holding
+ * the reactants and the products of reversible reactions for the purpose of
+ * computing the concentration dependence of the rates of progress. Instead of
+ * separate lists for each type of reaction and direction, the species of
+ * both directions of each reaction are stored together, so multiply()
+ * updates the forward and reverse rates of progress of all reactions in a
+ * single pass over the reactions.
+ *
+ * Reaction directions that StoichManagerN handles with the C1, C2 and C3
+ * classes are stored as rows of exactly three species indices, where species
+ * are repeated according to their orders and unused entries refer to an
+ * additional slot with a concentration of one. The concentration products for
+ * these rows are computed by multiplication without branches, with the same
+ * handling of negative concentrations as classes C2 and C3. All other
+ * reaction directions are stored in compressed sparse row (CSR) format, and
+ * their concentration products are computed as the exponential of the sum of
+ * the orders times the logarithms of the concentrations. The logarithm of the
+ * concentration of each species participating in such a reaction is evaluated
+ * once per call, instead of calling `pow` for each term.
+ *
+ * In addition, the class stores the net stoichiometric coefficient matrix in
+ * row-major (CSR) form, so that the net production rates of all species are
+ * computed as a single sparse matrix-vector product.
+ *
+ * @ingroup Stoichiometry
+ */
+class StoichManagerFused
+{
+public:
+    StoichManagerFused() : m_ready(true) {
+        m_ptr.push_back(0);
+    }
+
+    //! Add the reaction orders for reaction `rxn`.
+    /*!
+     * Reactions have to be added in order of their indices.
+     *
+     * @param rxn  Reaction index
+     * @param rk  Indices of the species in the reactant-side rate expression
+     * @param rorder  Orders for the species in `rk`
+     * @param rstoich  Stoichiometric coefficients for the species in `rk`
+     * @param pk  Indices of the product species, for reversible reactions.
+     *     Empty for irreversible reactions.
+     * @param pstoich  Stoichiometric coefficients (and orders) for the species
+     *     in `pk`
+     */
+    void add(size_t rxn, const std::vector<size_t>& rk, const vector_fp& rorder,
+             const vector_fp& rstoich, const std::vector<size_t>& pk,
+             const vector_fp& pstoich) {
+        if (rxn != m_fwd.size() / 3) {
+            throw CanteraError("StoichManagerFused::add", "Reactions must be "
+                "added in order: expected index {} but got {}.",
+                m_fwd.size() / 3, rxn);
+        }
+        addTerms(rxn, rk, rorder, rstoich, m_fwd);
+        addTerms(rxn, pk, pstoich, pstoich, m_rev);
+        m_ready = false;
+    }
+
+    //! Set the net stoichiometric coefficient matrix
+    /*!
+     * @param netStoich  Matrix of net stoichiometric coefficients, with one row
+     *     for each species and one column for each reaction.
+     */
+    void resizeCoeffs(const Eigen::SparseMatrix<double>& netStoich) {
+        size_t nSpc = netStoich.rows();
+        // interleave forward and reverse directions, and replace placeholders
+        // with the slot with unit concentration
+        size_t nRxn = m_fwd.size() / 3;
+        m_rows.resize(6 * nRxn);
+        for (size_t i = 0; i < nRxn; i++) {
+            for (size_t n = 0; n < 3; n++) {
+                int kf = m_fwd[3 * i + n];
+                int kr = m_rev[3 * i + n];
+                m_rows[6 * i + n] = (kf < 0) ? static_cast<int>(nSpc) : kf;
+                m_rows[6 * i + 3 + n] = (kr < 0) ? static_cast<int>(nSpc) : kr;
+            }
+        }
+        m_netStoich = netStoich;
+        m_conc.assign(nSpc + 1, 1.0);
+        m_logConc.resize(nSpc, 0.0);
+        m_ready = true;
+    }
+
+    //! Multiply the forward and reverse rates of progress by the concentration
+    //! dependence of the law of mass action.
+    /*!
+     * @param conc  Species concentrations (or activity concentrations)
+     * @param ropf  Forward rates of progress; on input, the forward rate
+     *     constants
+     * @param ropr  Reverse rates of progress; on input, the reverse rate
+     *     constants
+     */
+    void multiply(const double* conc, double* ropf, double* ropr) {
+        checkReady("multiply");
+        size_t nSpc = m_logConc.size();
+        std::copy(conc, conc + nSpc, m_conc.begin());
+        const double* c = m_conc.data();
+        const int* k = m_rows.data();
+        size_t nRxn = m_rows.size() / 6;
+        for (size_t i = 0; i < nRxn; i++) {
+            ropf[i] *= product3(c, k + 6 * i);
+            ropr[i] *= product3(c, k + 6 * i + 3);
+        }
+
+        if (m_rxn.empty()) {
+            return;
+        }
+        for (size_t k : m_logSpecies) {
+            m_logConc[k] = (conc[k] > 0.0) ? std::log(conc[k]) : 0.0;
+        }
+        for (size_t j = 0; j < m_rxn.size(); j++) {
+            double* rop = (m_rxn[j] < 0) ? ropr + (-1 - m_rxn[j]) : ropf + m_rxn[j];
+            double logProd = 0.0;
+            bool positive = true;
+            for (int n = m_ptr[j]; n < m_ptr[j+1]; n++) {
+                int k = m_species[n];
+                if (!(conc[k] > 0.0)) {
+                    positive = false;
+                    break;
+                }
+                logProd += m_order[n] * m_logConc[k];
+            }
+            *rop = positive ? *rop * std::exp(logProd) : 0.0;
+        }
+    }
+
+    //! Calculate the net production rates of all species
+    /*!
+     * @param ropnet  Net rates of progress
+     * @param wdot  Output array of net production rates; length equal to the
+     *     number of species
+     */
+    void netProductionRates(const double* ropnet, double* wdot) const {
+        checkReady("netProductionRates");
+        Eigen::Map<Eigen::VectorXd>(wdot, m_netStoich.rows()) =
+            m_netStoich * Eigen::Map<const Eigen::VectorXd>(ropnet,
+                                                            m_netStoich.cols());
+    }
+
+private:
+    //! Append the terms for one direction of reaction `rxn` to `rows`, or to
+    //! the CSR list if the concentration product requires logarithms.
+    void addTerms(size_t rxn, const std::vector<size_t>& k, const vector_fp& order,
+                  const vector_fp& stoich, std::vector<int>& rows) {
+        // Use the same classification as StoichManagerN::add
+        bool general = k.size() > 3;
+        std::vector<size_t> kRep;
+        for (size_t n = 0; n < k.size(); n++) {
+            if (fmod(stoich[n], 1.0) || stoich[n] != order[n]) {
+                general = true;
+            }
+            for (size_t i = 0; i < stoich[n]; i++) {
+                kRep.push_back(k[n]);
+            }
+        }
+        if (general || kRep.size() > 3) {
+            kRep.clear();
+            m_rxn.push_back((&rows == &m_fwd) ? static_cast<int>(rxn)
+                                              : -1 - static_cast<int>(rxn));
+            for (size_t n = 0; n < k.size(); n++) {
+                if (order[n] != 0.0) {
+                    m_species.push_back(static_cast<int>(k[n]));
+                    m_order.push_back(order[n]);
+                    if (std::find(m_logSpecies.begin(), m_logSpecies.end(),
+                                  k[n]) == m_logSpecies.end()) {
+                        m_logSpecies.push_back(k[n]);
+                    }
+                }
+            }
+            m_ptr.push_back(static_cast<int>(m_species.size()));
+        }
+        for (size_t n = 0; n < 3; n++) {
+            rows.push_back(n < kRep.size() ? static_cast<int>(kRep[n]) : -1);
+        }
+    }
+
+    //! Product of the concentrations of the three species starting at `k`.
+    //! Products are set to zero if more than one of the concentrations is
+    //! negative, as in classes C2 and C3.
+    static double product3(const double* conc, const int* k) {
+        double c0 = conc[k[0]];
+        double c1 = conc[k[1]];
+        double c2 = conc[k[2]];
+        if (std::min(c0, std::min(c1, c2)) >= 0.0) {
+            return c0 * c1 * c2;
+        }
+        return ((c0 < 0) + (c1 < 0) + (c2 < 0) > 1) ? 0.0 : c0 * c1 * c2;
+    }
+
+    void checkReady(const std::string& method) const {
+        if (!m_ready) {
+            throw CanteraError("StoichManagerFused::" + method, "The object "
+                "is not fully configured; make sure to call resizeCoeffs().");
+        }
+    }
+
+    bool m_ready; //!< Boolean flag indicating whether object is fully configured
+
+    //! Species indices for the forward direction of each reaction, three per
+    //! reaction, where `-1` marks unused entries
+    std::vector<int> m_fwd;
+
+    //! Species indices for the reverse direction of each reaction, three per
+    //! reaction, where `-1` marks unused entries
+    std::vector<int> m_rev;
+
+    //! Species indices for the forward and reverse directions of each
+    //! reaction, six per reaction, where unused entries refer to the slot with
+    //! unit concentration
+    std::vector<int> m_rows;
+
+    //! Reaction directions stored in CSR format: reaction index for the
+    //! forward direction, or `-1 - index` for the reverse direction
+    std::vector<int> m_rxn;
+
+    //! Start of the terms for each reaction direction in #m_rxn; terms for
+    //! entry `j` are `m_ptr[j]` to `m_ptr[j+1] - 1`
+    std::vector<int> m_ptr;
+
+    std::vector<int> m_species; //!< Species index for each CSR term
+    vector_fp m_order; //!< Order for each CSR term
+
+    //! Species for which logarithms of the concentration are needed
+    std::vector<size_t> m_logSpecies;
+    vector_fp m_logConc; //!< Logarithms of the species concentrations
+
+    //! Species concentrations, followed by a slot with unit concentration
+    vector_fp m_conc;
+
+    //! Net stoichiometric coefficients (species x reactions)
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_netStoich;
+};
 }
 
 #endif
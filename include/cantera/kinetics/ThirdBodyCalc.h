@@ -159,6 +159,41 @@ public:
         }
     }
 
+    //! Update third-body concentrations for several states
+    /*!
+     *  Arrays use a structure-of-arrays layout, i.e. `conc[k * nStates + m]`
+     *  is the concentration of species *k* and `concm[i * nStates + m]` the
+     *  third-body concentration of reaction *i* in state *m*.
+     */
+    void update(const double* conc, const double* ctot, double* concm,
+                size_t nStates) const {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            double* cm = concm + m_reaction_index[i] * nStates;
+            double dflt = m_default[i];
+            for (size_t m = 0; m < nStates; m++) {
+                cm[m] = dflt * ctot[m];
+            }
+            for (size_t j = 0; j < m_species[i].size(); j++) {
+                const double* c = conc + m_species[i][j] * nStates;
+                double eff = m_eff[i][j];
+                for (size_t m = 0; m < nStates; m++) {
+                    cm[m] += eff * c[m];
+                }
+            }
+        }
+    }
+
+    //! Multiply output with effective third-body concentration for several
+    //! states, using the layout described for update()
+    void multiply(double* output, const double* concm, size_t nStates) const {
+        for (size_t i = 0; i < m_mass_action_index.size(); i++) {
+            size_t ix = m_reaction_index[m_mass_action_index[i]] * nStates;
+            for (size_t m = 0; m < nStates; m++) {
+                output[ix + m] *= concm[ix + m];
+            }
+        }
+    }
+
     //! Calculate derivatives with respect to species concentrations.
     /*!
      *  @param product   Product of law of mass action and rate terms.
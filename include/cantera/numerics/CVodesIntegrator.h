@@ -61,6 +61,13 @@ public:
         m_mupper = N_Upper;
         m_mlower = N_Lower;
     }
+    virtual bool rootFound() const {
+        return m_root_found;
+    }
+    virtual double rootTime() const {
+        return m_time;
+    }
+    virtual void getRootInfo(int* info);
     virtual int nSensParams() {
         return static_cast<int>(m_np);
     }
@@ -107,6 +114,8 @@ private:
     N_Vector* m_yS;
     size_t m_np;
     int m_mupper, m_mlower;
+    size_t m_nroots; //!< Number of root functions
+    bool m_root_found; //!< `true` if the last call to CVode returned at a root
 
     //! Indicates whether the sensitivities stored in m_yS have been updated
     //! for at the current integrator time.
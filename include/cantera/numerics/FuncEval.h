@@ -11,6 +11,7 @@
 #include "cantera/base/ct_defs.h"
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/global.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -49,6 +50,112 @@ public:
      */
     int eval_nothrow(double t, double* y, double* ydot);
 
+    //! Evaluate the Jacobian of the right-hand-side function as a dense matrix.
+    /*!
+     * Used by integrators configured to use a dense direct linear solver with
+     * a Jacobian provided by this object (problem type `DENSE + JAC`).
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq(). Elements may be perturbed
+     *     during the evaluation, but are restored before returning.
+     * @param[in] ydot right-hand side evaluated at *t* and *y*, length neq()
+     * @param[out] jac Jacobian matrix d(ydot)/dy in column-major order, size
+     *     neq() by neq()
+     */
+    virtual void evalDenseJacobian(double t, double* y, const double* ydot,
+                                   double* jac) {
+        throw NotImplementedError("FuncEval::evalDenseJacobian");
+    }
+
+    //! Evaluate the dense Jacobian using return code to indicate status.
+    //! @see eval_nothrow() for the meaning of the return values.
+    int evalDenseJacobian_nothrow(double t, double* y, const double* ydot,
+                                  double* jac);
+
+    //! Evaluate the Jacobian of the right-hand-side function as a sparse matrix.
+    /*!
+     * Used by integrators configured to use a sparse direct linear solver
+     * (problem type `SPARSE + JAC`). The returned matrix may be an
+     * approximation of the exact Jacobian, since it is only used to form the
+     * Newton iteration matrix.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[out] jac Jacobian matrix d(ydot)/dy, size neq() by neq()
+     */
+    virtual void evalSparseJacobian(double t, double* y,
+                                    Eigen::SparseMatrix<double>& jac) {
+        throw NotImplementedError("FuncEval::evalSparseJacobian");
+    }
+
+    //! Evaluate the sparse Jacobian using return code to indicate status.
+    /*!
+     * Errors are handled in the same way as for eval_nothrow().
+     *  @returns 0 for a successful evaluation; 1 after a potentially-
+     *      recoverable error; -1 after an unrecoverable error.
+     */
+    int evalSparseJacobian_nothrow(double t, double* y,
+                                   Eigen::SparseMatrix<double>& jac);
+
+    //! Prepare the preconditioner for the current state.
+    /*!
+     * Called by iterative linear solvers (problem type `GMRES + JAC`) to
+     * set up an approximation *P* of the Newton iteration matrix
+     * \f$ I - \gamma J \f$, which is subsequently used by
+     * preconditionerSolve().
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] gamma scaling factor of the Jacobian in the Newton matrix
+     * @param[in] jacOk `true` if the integrator allows the Jacobian from the
+     *     previous call to be reused, in which case only *gamma* may change
+     * @returns `true` if the Jacobian was evaluated for the current state;
+     *     `false` if a previously evaluated Jacobian was reused
+     */
+    virtual bool preconditionerSetup(double t, double* y, double gamma,
+                                     bool jacOk=false) {
+        throw NotImplementedError("FuncEval::preconditionerSetup");
+    }
+
+    //! Solve the linear system \f$ P z = r \f$ using the preconditioner
+    //! prepared by the last call to preconditionerSetup().
+    /*!
+     * @param[in] rhs right-hand side vector *r*, length neq()
+     * @param[out] output solution vector *z*, length neq()
+     */
+    virtual void preconditionerSolve(double* rhs, double* output) {
+        throw NotImplementedError("FuncEval::preconditionerSolve");
+    }
+
+    //! Set up the preconditioner using return code to indicate status.
+    //! On return, *jacCurrent* is the value returned by preconditionerSetup().
+    //! @see eval_nothrow() for the meaning of the return values.
+    int preconditionerSetup_nothrow(double t, double* y, double gamma,
+                                    bool jacOk, bool& jacCurrent);
+
+    //! Apply the preconditioner using return code to indicate status.
+    //! @see eval_nothrow() for the meaning of the return values.
+    int preconditionerSolve_nothrow(double* rhs, double* output);
+
+    //! Number of root functions, whose roots are located by integrators
+    //! which support root finding
+    virtual size_t nRootFunctions() {
+        return 0;
+    }
+
+    //! Evaluate the root functions.
+    /*!
+     * The integrator locates the times where any of the root functions
+     * changes sign.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[out] gout values of the root functions, length nRootFunctions()
+     */
+    virtual void evalRootFunctions(double t, double* y, double* gout) {
+        throw NotImplementedError("FuncEval::evalRootFunctions");
+    }
+
+    //! Evaluate the root functions using return code to indicate status.
+    //! @see eval_nothrow() for the meaning of the return values.
+    int evalRootFunctions_nothrow(double t, double* y, double* gout);
+
     //! Fill in the vector *y* with the current state of the system
     virtual void getState(double* y) {
         throw NotImplementedError("FuncEval::getState");
@@ -89,6 +196,14 @@ public:
     vector_fp m_paramScales;
 
 protected:
+    //! Call *func*, catching any exceptions and converting them to the return
+    //! codes used by the `_nothrow` methods. Errors are stored or printed
+    //! depending on the setting of suppressErrors().
+    //! @param func  function to call
+    //! @param name  name of the calling method, used in error messages
+    template <class F>
+    int callNoThrow(const F& func, const std::string& name);
+
     // If true, errors are accumulated in m_errors. Otherwise, they are printed
     bool m_suppress_errors;
 
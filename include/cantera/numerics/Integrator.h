@@ -24,6 +24,7 @@ const int NOJAC = 4;
 const int JAC = 8;
 const int GMRES = 16;
 const int BAND = 32;
+const int SPARSE = 64;
 
 /**
  * Specifies the method used to integrate the system of equations.
@@ -209,6 +210,35 @@ public:
         warn("setBandwidth");
     }
 
+    //! Returns `true` if the last call to integrate() or step() returned at a
+    //! root of the root functions of the FuncEval object.
+    /*!
+     * Integrators which support root finding locate the roots of the
+     * functions provided by FuncEval::evalRootFunctions() if
+     * FuncEval::nRootFunctions() is nonzero at initialization. At a root,
+     * integrate() and step() return early, with the solution at the root.
+     * Subsequent calls continue the integration from the root.
+     */
+    virtual bool rootFound() const {
+        return false;
+    }
+
+    //! Time of the root found by the last call to integrate() or step()
+    virtual double rootTime() const {
+        warn("rootTime");
+        return 0.0;
+    }
+
+    //! Get the root functions which have a root at rootTime().
+    /*!
+     * @param[out] info  For each root function, +1 if it has a root where it
+     *     is increasing, -1 if it has a root where it is decreasing, and 0
+     *     otherwise. Length FuncEval::nRootFunctions().
+     */
+    virtual void getRootInfo(int* info) {
+        warn("getRootInfo");
+    }
+
     virtual int nSensParams() {
         warn("nSensParams()");
         return 0;
@@ -0,0 +1,204 @@
+/**
+ *  @file OneStepIntegrator.h
+ *  Base class for self-starting one-step ODE integrators
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ONESTEPINTEGRATOR_H
+#define CT_ONESTEPINTEGRATOR_H
+
+#include "cantera/numerics/Integrator.h"
+
+namespace Cantera
+{
+
+//! Base class for one-step ODE integrators with embedded error estimates.
+/*!
+ * Implements the parts of the Integrator interface which are common to
+ * one-step methods: weighted error norms, adaptive step size control,
+ * stepping to output times, and dense output. Between the last two accepted
+ * steps, the solution is represented by the cubic Hermite interpolant of the
+ * solution and its time derivative, which is used by integrate() for output
+ * times before the current integrator time and by derivative().
+ *
+ * Roots of the functions provided by FuncEval::evalRootFunctions() are
+ * located after each accepted step by searching for sign changes of the root
+ * functions evaluated along the interpolant, using the Illinois variant of
+ * the method of false position.
+ *
+ * Derived classes implement a single step of the method in attemptStep().
+ * These integrators do not compute sensitivities.
+ *
+ * @ingroup odeGroup
+ */
+class OneStepIntegrator : public Integrator
+{
+public:
+    OneStepIntegrator();
+
+    virtual void setTolerances(double reltol, size_t n, double* abstol);
+    virtual void setTolerances(double reltol, double abstol);
+    virtual void setSensitivityTolerances(double reltol, double abstol) {}
+    virtual void setProblemType(int probtype);
+    virtual void initialize(double t0, FuncEval& func);
+    virtual void reinitialize(double t0, FuncEval& func);
+    virtual void integrate(double tout);
+    virtual double step(double tout);
+    virtual double& solution(size_t k) {
+        return m_yout[k];
+    }
+    virtual double* solution() {
+        return m_yout.data();
+    }
+    virtual double* derivative(double tout, int n);
+    virtual int lastOrder() const {
+        return (m_t > m_tprev) ? order() : 0;
+    }
+    virtual int nEquations() const {
+        return static_cast<int>(m_neq);
+    }
+    virtual int nEvals() const {
+        return static_cast<int>(m_nfevals);
+    }
+    //! The method is determined by the derived class. Ignored.
+    virtual void setMethod(MethodType t) {}
+    //! The order is determined by the method. Ignored.
+    virtual void setMaxOrder(int n) {}
+    virtual void setMaxStepSize(double hmax);
+    virtual void setMinStepSize(double hmin);
+    virtual void setMaxSteps(int nmax);
+    virtual int maxSteps() {
+        return m_maxsteps;
+    }
+    virtual void setMaxErrTestFails(int n);
+    virtual bool rootFound() const {
+        return m_root_found;
+    }
+    virtual double rootTime() const {
+        return m_troot;
+    }
+    virtual void getRootInfo(int* info);
+    virtual int nSensParams() {
+        return 0;
+    }
+
+    //! Order of the method
+    virtual int order() const = 0;
+
+    //! Number of accepted steps since the last call to initialize()
+    size_t nSteps() const {
+        return m_nsteps;
+    }
+
+    //! Number of rejected steps since the last call to initialize()
+    size_t nRejectedSteps() const {
+        return m_nreject;
+    }
+
+    //! Current integrator time, which may be past the output time of the last
+    //! call to integrate()
+    double currentTime() const {
+        return m_t;
+    }
+
+protected:
+    //! Called by initialize() after the work arrays have been sized
+    virtual void setup() {}
+
+    //! Order of the error estimate used to compute new step sizes
+    virtual int errorOrder() const = 0;
+
+    //! Limit the step size *h* before an attempted step, e.g. to satisfy a
+    //! stability condition. Returns the limited step size.
+    virtual double limitStep(double h) {
+        return h;
+    }
+
+    //! Attempt a step of size *h* from the current solution #m_y, with
+    //! derivative #m_f, at time #m_t.
+    /*!
+     * Stores the solution at `m_t + h` in #m_ynew. If the derivative at the
+     * new solution is computed as part of the step, it is stored in #m_fnew
+     * and #m_fnew_ok is set to `true`.
+     * @returns the weighted RMS norm of the local error estimate, or a
+     *     negative value if the right-hand side could not be evaluated
+     */
+    virtual double attemptStep(double h) = 0;
+
+    //! Evaluate the right hand side function at time *t* and state *y*.
+    //! Returns `false` after a recoverable error.
+    bool evalRHS(double t, double* y, double* ydot);
+
+    //! Weighted RMS norm of *v*, using error weights computed from the
+    //! magnitudes of *y0* and *y1*.
+    double errorNorm(const double* v, const double* y0, const double* y1) const;
+
+    //! Absolute tolerance for component *k*
+    double atol(size_t k) const {
+        return (m_atol.size() == 1) ? m_atol[0] : m_atol[k];
+    }
+
+    //! Take one accepted step, which will not extend past *tmax*
+    void takeStep(double tmax);
+
+    //! Estimate the size of the first step
+    double initialStepSize() const;
+
+    //! Evaluate the Hermite interpolant over the last step, or its *n*-th
+    //! derivative, at time *t*.
+    void interpolate(double t, int n, double* out) const;
+
+    //! Evaluate the root functions at time *t* within the last step, using
+    //! the interpolated solution
+    void evalRoots(double t, double* g);
+
+    //! Search for roots of the root functions between #m_tg and *tend*, which
+    //! must be within the last step. If a root is found, the solution at the
+    //! root is stored in #m_yout and `true` is returned.
+    bool findRoot(double tend);
+
+    FuncEval* m_func;
+    size_t m_neq; //!< Number of equations
+    int m_type; //!< Problem type, see setProblemType()
+    double m_rtol; //!< Relative tolerance
+    vector_fp m_atol; //!< Absolute tolerances (scalar or per component)
+    double m_hmax; //!< Maximum step size; zero if unlimited
+    double m_hmin; //!< Minimum step size
+    int m_maxsteps; //!< Maximum steps per call to integrate()
+    int m_maxErrTestFails; //!< Maximum consecutive rejected steps
+
+    double m_t; //!< Current integrator time
+    double m_h; //!< Step size to use for the next step
+    vector_fp m_y; //!< Solution at #m_t
+    vector_fp m_f; //!< Time derivative at #m_t
+    double m_tprev; //!< Time at the start of the last accepted step
+    vector_fp m_yprev; //!< Solution at #m_tprev
+    vector_fp m_fprev; //!< Time derivative at #m_tprev
+    vector_fp m_ynew; //!< Solution at the end of the attempted step
+    vector_fp m_fnew; //!< Time derivative at the end of the attempted step
+    bool m_fnew_ok; //!< `true` if #m_fnew has been computed by attemptStep()
+    vector_fp m_yout; //!< Solution returned by solution()
+    vector_fp m_dky; //!< Work array used by derivative()
+    bool m_rejected; //!< `true` if the previous attempted step was rejected
+
+    size_t m_nroots; //!< Number of root functions
+    double m_tg; //!< Time up to which roots have been located
+    vector_fp m_g; //!< Values of the root functions at #m_tg
+    vector_fp m_glo; //!< Work array: root functions at the lower bracket
+    vector_fp m_ghi; //!< Work array: root functions at the upper bracket
+    vector_fp m_gmid; //!< Work array: root functions at the trial point
+    vector_fp m_yg; //!< Work array: solution used to evaluate root functions
+    bool m_root_found; //!< `true` if the last call returned at a root
+    double m_troot; //!< Time of the last root found
+    std::vector<int> m_rootInfo; //!< Directions of the root functions at #m_troot
+
+    size_t m_nsteps;
+    size_t m_nreject;
+    size_t m_nfevals;
+};
+
+}
+
+#endif
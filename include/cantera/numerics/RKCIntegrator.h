@@ -0,0 +1,86 @@
+/**
+ *  @file RKCIntegrator.h
+ *  Explicit Runge-Kutta-Chebyshev integrator for mildly stiff ODE systems
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_RKCINTEGRATOR_H
+#define CT_RKCINTEGRATOR_H
+
+#include "cantera/numerics/OneStepIntegrator.h"
+
+namespace Cantera
+{
+
+//! Explicit Runge-Kutta-Chebyshev integrator.
+/*!
+ * Implements the second order, stabilized explicit method of Sommeijer,
+ * Shampine & Verwer, J. Comput. Appl. Math. 88:315-326 (1997). The number of
+ * stages *s* of each step is chosen such that the stability region, which
+ * extends along the negative real axis to approximately \f$ -0.65 s^2 \f$,
+ * contains the scaled spectrum \f$ h \lambda \f$ of the Jacobian. The spectral
+ * radius is estimated with a nonlinear power method using only evaluations of
+ * the right hand side, so no Jacobian or linear solves are needed.
+ *
+ * The method is suited to problems with eigenvalues close to the negative
+ * real axis and moderate stiffness, for example chemistry integrated over
+ * the short time steps of operator-split reacting flow simulations. For very
+ * stiff problems, the number of stages (and therefore the cost per step)
+ * grows with the square root of the spectral radius; RosenbrockIntegrator or
+ * CVodesIntegrator are more efficient in this case.
+ *
+ * @ingroup odeGroup
+ */
+class RKCIntegrator : public OneStepIntegrator
+{
+public:
+    RKCIntegrator();
+
+    virtual int order() const {
+        return 2;
+    }
+
+    //! Set the maximum number of stages per step. Default: 250.
+    void setMaxStages(size_t nmax);
+
+    //! Maximum number of stages used by any step since the last call to
+    //! initialize()
+    size_t maxStagesUsed() const {
+        return m_maxStagesUsed;
+    }
+
+    //! Last estimate of the spectral radius of the Jacobian
+    double spectralRadius() const {
+        return m_spectralRadius;
+    }
+
+protected:
+    virtual void setup();
+    virtual int errorOrder() const {
+        return 3;
+    }
+    virtual double limitStep(double h);
+    virtual double attemptStep(double h);
+
+    //! Estimate the spectral radius of the Jacobian at the current solution
+    void estimateSpectralRadius();
+
+    size_t m_maxStages; //!< Maximum number of stages per step
+    size_t m_maxStagesUsed;
+    size_t m_stages; //!< Number of stages of the next step
+    double m_spectralRadius; //!< Estimated spectral radius of the Jacobian
+    //! Value of #m_nsteps when the spectral radius was estimated; `npos` if
+    //! an estimate is needed
+    size_t m_rho_step;
+    size_t m_rho_nreject; //!< Value of #m_nreject at the last estimate
+    vector_fp m_eigvec; //!< Approximate dominant eigenvector
+    vector_fp m_yjm1; //!< Work array: solution at stage j - 1
+    vector_fp m_yjm2; //!< Work array: solution at stage j - 2
+    vector_fp m_work; //!< Work array
+};
+
+}
+
+#endif
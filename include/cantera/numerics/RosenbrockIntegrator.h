@@ -0,0 +1,118 @@
+/**
+ *  @file RosenbrockIntegrator.h
+ *  Linearly implicit Rosenbrock integrators for stiff ODE systems
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ROSENBROCKINTEGRATOR_H
+#define CT_ROSENBROCKINTEGRATOR_H
+
+#include "cantera/numerics/OneStepIntegrator.h"
+#include "cantera/numerics/eigen_dense.h"
+
+namespace Cantera
+{
+
+//! Rosenbrock integrator for stiff ODE systems.
+/*!
+ * Rosenbrock methods are linearly implicit Runge-Kutta methods which
+ * require a single factorization of the iteration matrix \f$ I / (\gamma h)
+ * - J \f$ per step and no Newton iteration. This makes them efficient for
+ * the short integration intervals and moderate accuracy requirements of
+ * operator-split reacting flow simulations. Two methods are available, using
+ * the coefficients given by Sandu et al., Atmospheric Environment
+ * 31:3459-3472 (1997):
+ *
+ *  - `"ROS4"`: L-stable fourth order method with four stages and an
+ *    embedded third order method (Hairer & Wanner, Solving Ordinary
+ *    Differential Equations II, Section IV.7).
+ *  - `"RODAS3"`: Stiffly accurate, L-stable third order method with four
+ *    stages and an embedded second order method.
+ *
+ * The Jacobian is evaluated at the start of each step. For problem type
+ * `SPARSE + JAC`, the Jacobian provided by FuncEval::evalSparseJacobian()
+ * is used with a sparse LU factorization. Otherwise, a dense Jacobian is
+ * used, which is provided by FuncEval::evalDenseJacobian() for problem type
+ * `DENSE + JAC`, or computed using forward finite differences for problem
+ * type `DENSE + NOJAC`. The derivative of the right hand side with respect to
+ * time is computed using a finite difference.
+ *
+ * The order of Rosenbrock methods relies on an accurate Jacobian. Where the
+ * sparse Jacobian is an approximation, the error control remains valid, but
+ * smaller steps may be needed, especially at tight tolerances.
+ *
+ * @ingroup odeGroup
+ */
+class RosenbrockIntegrator : public OneStepIntegrator
+{
+public:
+    //! Constructor
+    //! @param method  Name of the method; either `"ROS4"` or `"RODAS3"`
+    explicit RosenbrockIntegrator(const std::string& method="ROS4");
+
+    virtual void setProblemType(int probtype);
+    virtual void reinitialize(double t0, FuncEval& func);
+    virtual int order() const {
+        return m_order;
+    }
+
+    //! Name of the method
+    const std::string& method() const {
+        return m_method;
+    }
+
+    //! Number of Jacobian evaluations since the last call to initialize()
+    size_t nJacobianEvals() const {
+        return m_njevals;
+    }
+
+protected:
+    virtual void setup();
+    virtual int errorOrder() const {
+        return m_order;
+    }
+    virtual double attemptStep(double h);
+
+    //! Evaluate the Jacobian and the time derivative of the right hand side
+    //! at the current solution. Returns `false` after a recoverable error.
+    bool evalJacobian();
+
+    //! Factorize the iteration matrix for step size *h*. Returns `false` if
+    //! the matrix is singular.
+    bool factorize(double h);
+
+    //! Solve the linear system with the factorized iteration matrix, in place
+    void solve(Eigen::VectorXd& x);
+
+    std::string m_method;
+    int m_order; //!< Order of the method
+    size_t m_nstages; //!< Number of stages
+    vector_fp m_a; //!< Coefficients of the stage arguments (lower triangle)
+    vector_fp m_c; //!< Coefficients of the stage increments (lower triangle)
+    vector_fp m_m; //!< Weights of the solution
+    vector_fp m_e; //!< Weights of the error estimate
+    vector_fp m_alpha; //!< Time offsets of the stages
+    vector_fp m_gamma; //!< Coefficients of the time derivative of the RHS
+    std::vector<bool> m_newF; //!< `true` if a stage requires a new RHS evaluation
+
+    bool m_sparse; //!< `true` if the sparse Jacobian is used
+    //! Value of #m_nsteps when the Jacobian was evaluated; `npos` if the
+    //! Jacobian needs to be evaluated
+    size_t m_jac_step;
+    Eigen::SparseMatrix<double> m_jac; //!< Jacobian (sparse)
+    Eigen::SparseMatrix<double> m_iter; //!< Iteration matrix (sparse)
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> m_sparseLU;
+    Eigen::MatrixXd m_dense_jac; //!< Jacobian (dense)
+    Eigen::PartialPivLU<Eigen::MatrixXd> m_denseLU;
+    vector_fp m_dfdt; //!< Time derivative of the right hand side
+    std::vector<Eigen::VectorXd> m_K; //!< Stage increments
+    vector_fp m_ystage; //!< Work array: stage argument
+    vector_fp m_fstage; //!< Work array: stage derivative
+    size_t m_njevals;
+};
+
+}
+
+#endif
@@ -87,6 +87,8 @@ public:
     void updatePropertiesTemp(const doublereal temp,
                               doublereal* cp_R, doublereal* h_RT,
                               doublereal* s_R) const;
+    void updatePropertiesTemp_ddT(double temp, double* cp_R, double* h_RT,
+                                  double* s_R, double* dcp_R_dT) const;
 
     size_t nCoeffs() const { return 4; }
 
@@ -12,6 +12,7 @@
 #define CT_IDEALGASPHASE_H
 
 #include "ThermoPhase.h"
+#include <functional>
 
 namespace Cantera
 {
@@ -408,6 +409,31 @@ public:
         setTemperature(p * meanMolecularWeight() / (GasConstant * rho));
     }
 
+    //! @copydoc ThermoPhase::setState_HP
+    /*!
+     * For a fixed composition, the reference state properties of the mixture
+     * are a single polynomial in the temperature within each range where no
+     * species changes its temperature region (see
+     * MultiSpeciesThermo::combinedCoeffs()). The temperature is found by a
+     * Newton iteration on this polynomial, starting from the current
+     * temperature, and the state is set once the iteration has converged.
+     * If the species thermo parameterizations can't be combined in this way,
+     * or the iteration fails, the general method of ThermoPhase is used.
+     */
+    virtual void setState_HP(double h, double p, double tol=1e-9);
+
+    //! @copydoc ThermoPhase::setState_UV
+    //! See setState_HP() for the method used.
+    virtual void setState_UV(double u, double v, double tol=1e-9);
+
+    //! @copydoc ThermoPhase::setState_SP
+    //! See setState_HP() for the method used.
+    virtual void setState_SP(double s, double p, double tol=1e-9);
+
+    //! @copydoc ThermoPhase::setState_SV
+    //! See setState_HP() for the method used.
+    virtual void setState_SV(double s, double v, double tol=1e-9);
+
     //! Returns the isothermal compressibility. Units: 1/Pa.
     /**
      * The isothermal compressibility is defined as
@@ -524,6 +550,7 @@ public:
     virtual void getPureGibbs(doublereal* gpure) const;
     virtual void getIntEnergy_RT(doublereal* urt) const;
     virtual void getCp_R(doublereal* cpr) const;
+    virtual void getCp_R_ddT(double* dcpr) const;
     virtual void getStandardVolumes(doublereal* vol) const;
 
     //! @}
@@ -587,6 +614,34 @@ public:
     virtual bool addSpecies(shared_ptr<Species> spec);
     virtual void setToEquilState(const doublereal* mu_RT);
 
+    //! Evaluate mixture properties for a batch of states.
+    /*!
+     * The properties are computed directly from the species thermo
+     * parameterizations without changing the state of the phase. If the
+     * thermo parameterizations of all species are handled by
+     * PolyThermoBatchEvaluator, the states are divided into chunks which are
+     * evaluated concurrently by up to batchThreads() threads.
+     *
+     * @copydetails ThermoPhase::getPropertiesBatch
+     */
+    virtual void getPropertiesBatch(size_t nStates, const double* T,
+                                    const double* P, const double* Y,
+                                    double* h, double* cp, double* rho,
+                                    double* mw);
+
+    //! Solve for the temperatures of a batch of states with given specific
+    //! enthalpy, pressure and composition.
+    /*!
+     * The temperature of each state is found using the method described for
+     * setState_HP(), without changing the state of the phase. The states are
+     * evaluated concurrently in the same way as for getPropertiesBatch().
+     *
+     * @copydetails ThermoPhase::solveTemperatureBatch_HP
+     */
+    virtual void solveTemperatureBatch_HP(size_t nStates, const double* h,
+                                          const double* P, const double* Y,
+                                          double* T, double tol=1e-9);
+
 protected:
     //! Reference state pressure
     /*!
@@ -607,6 +662,10 @@ protected:
     //! Temporary storage for dimensionless reference state entropies
     mutable vector_fp m_s0_R;
 
+    //! Temporary storage for temperature derivatives of the dimensionless
+    //! reference state heat capacities
+    mutable vector_fp m_dcp0_R;
+
     mutable vector_fp m_expg0_RT;
 
     //! Temporary array containing internally calculated partial pressures
@@ -626,6 +685,59 @@ private:
      *  (or equivalent) call is made.
      */
     void _updateThermo() const;
+
+    //! Update the temperature derivatives of the species reference state heat
+    //! capacities, together with the reference state thermodynamic functions
+    void _updateThermo_ddT() const;
+
+    //! Call `eval(m0, m1)` for ranges of states `[m0, m1)` which together
+    //! cover a batch of *nStates* states, concurrently using up to
+    //! batchThreads() threads.
+    void evalChunks(size_t nStates,
+                    const std::function<void(size_t, size_t)>& eval) const;
+
+    //! Find the temperature at which a mixture with fixed composition has a
+    //! given specific enthalpy, internal energy or entropy.
+    /*!
+     * Does not modify this object, and may be called concurrently.
+     *
+     * @param w        Mass fractions divided by the molecular weights
+     *                 [kmol/kg], as returned by moleFractdivMMW()
+     * @param target   Target specific enthalpy or internal energy [J/kg], or
+     *                 specific entropy [J/kg/K]
+     * @param pv       Pressure [Pa], or specific volume [m^3/kg] if *constV*
+     *                 is `true`
+     * @param entropy  If `true`, solve for the entropy, otherwise for the
+     *                 enthalpy (at constant pressure) or internal energy (at
+     *                 constant volume)
+     * @param constV   If `true`, the specific volume is held constant,
+     *                 otherwise the pressure
+     * @param T        On input, the initial estimate of the temperature [K].
+     *                 On output, the solution.
+     * @param rtol     Relative tolerance for the temperature
+     * @returns `false` if no solution was found.
+     */
+    bool solveTemperature(const double* w, double target, double pv,
+                          bool entropy, bool constV, double& T,
+                          double rtol) const;
+
+    //! Solve for the temperatures of states *m0* to *m1 - 1* of a batch of
+    //! *nStates* states for solveTemperatureBatch_HP(). Sets `failed[m]` to
+    //! `true` and leaves `T[m]` unchanged for states where no solution is
+    //! found. Does not modify this object, and may be called concurrently for
+    //! different ranges of states.
+    void solveTemperatureBatch(size_t m0, size_t m1, size_t nStates,
+                               const double* h, const double* P,
+                               const double* Y, double* T, double tol,
+                               char* failed) const;
+
+    //! Evaluate the properties of states *m0* to *m1 - 1* of a batch of
+    //! *nStates* states for getPropertiesBatch(). Does not modify this object,
+    //! and may be called concurrently for different ranges of states.
+    void evalPropertiesBatch(size_t m0, size_t m1, size_t nStates,
+                             const double* T, const double* P, const double* Y,
+                             double* h, double* cp, double* rho,
+                             double* mw) const;
 };
 
 }
@@ -279,6 +279,22 @@ public:
      */
     virtual void setPressure(doublereal p);
 
+    //! Evaluate mixture properties for a batch of states.
+    /*!
+     * The state of the phase is set to each of the states in turn. Unlike
+     * setState_TPY(), the temperature is set before the composition without
+     * updating the mixing rules, so that they are evaluated only once per
+     * state, for the new temperature and composition. The phase state used to
+     * select the root of the cubic equation of state is also determined for
+     * the new composition.
+     *
+     * @copydetails ThermoPhase::getPropertiesBatch
+     */
+    virtual void getPropertiesBatch(size_t nStates, const double* T,
+                                    const double* P, const double* Y,
+                                    double* h, double* cp, double* rho,
+                                    double* mw);
+
 protected:
     virtual void compositionChanged();
 
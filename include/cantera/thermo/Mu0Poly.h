@@ -129,6 +129,10 @@ public:
                                       doublereal* h_RT,
                                       doublereal* s_R) const;
 
+    virtual void updatePropertiesTemp_ddT(double temp, double* cp_R,
+                                          double* h_RT, double* s_R,
+                                          double* dcp_R_dT) const;
+
     virtual size_t nCoeffs() const;
 
     virtual void reportParameters(size_t& n, int& type,
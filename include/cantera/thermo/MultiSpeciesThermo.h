@@ -11,10 +11,144 @@
 #define CT_MULTISPECIESTHERMO_H
 
 #include "SpeciesThermoInterpType.h"
+#include <set>
 
 namespace Cantera
 {
 
+//! Evaluator for the reference state properties of all species in a phase
+//! which use NASA 7-coefficient, NASA 9-coefficient or Shomate polynomials.
+/*!
+ * The coefficients of each of these parameterizations can be written exactly
+ * in the form of the NASA 9-coefficient polynomials (see Nasa9Poly1). The
+ * coefficients of all species are stored in this form as a structure of
+ * arrays, where each coefficient of each temperature region is a contiguous
+ * array over the species. The properties of all species are then evaluated in
+ * one pass of vectorizable loops, using a single set of temperature basis
+ * functions and no virtual function calls. The temperature region of each
+ * species is selected without branching, by blending the coefficients of
+ * adjacent regions. Species with fewer temperature regions than the maximum
+ * are padded with region boundaries at infinity. Species with more than three
+ * temperature regions are not handled.
+ *
+ * The SpeciesThermoInterpType objects remain the source of the coefficients,
+ * and the packed coefficients for a species need to be updated using
+ * replace() whenever its parameterization is modified.
+ *
+ * @ingroup spthermo
+ */
+class PolyThermoBatchEvaluator
+{
+public:
+    PolyThermoBatchEvaluator() : m_nregions(1), m_ok(false) {}
+
+    //! Add or replace the parameterization of species *k*. Returns `false`,
+    //! without adding the species, if the parameterization is not one of the
+    //! supported types.
+    bool install(size_t k, const SpeciesThermoInterpType& stit);
+
+    //! Replace the parameterization of species *k*. Returns `false` if
+    //! the species is not handled by this evaluator. If the new
+    //! parameterization is not supported, the species is removed and `false`
+    //! is returned.
+    bool replace(size_t k, const SpeciesThermoInterpType& stit);
+
+    //! Stop handling species *k* with this evaluator
+    void remove(size_t k);
+
+    //! Number of species handled by this evaluator
+    size_t nSpecies() const {
+        return m_species.size();
+    }
+
+    //! `true` if species *k* is handled by this evaluator
+    bool contains(size_t k) const {
+        return k < m_pos.size() && m_pos[k] != npos;
+    }
+
+    //! Compute the non-dimensional heat capacity, enthalpy, and entropy of
+    //! the species handled by this evaluator at temperature *T*. The output
+    //! arrays are indexed by species. If *dcp_R_dT* is not `nullptr`, the
+    //! temperature derivatives of the heat capacities are also computed.
+    void update(double T, double* cp_R, double* h_RT, double* s_R,
+                double* dcp_R_dT=nullptr);
+
+    //! Build the packed arrays if species have been installed or replaced
+    //! since the last evaluation. Afterwards, update() does not modify this
+    //! object until the next call to install() or replace().
+    void prepare() {
+        if (!m_ok) {
+            build();
+        }
+    }
+
+    //! Compute the coefficients of a single NASA 9-coefficient polynomial for
+    //! the sum of the reference state properties of the packed species
+    //! weighted by *w*, at temperatures near *T*.
+    /*!
+     * The combined polynomial is valid for temperatures greater than *Tlow*
+     * and less than or equal to *Thigh*, where none of the species with a
+     * non-zero weight changes its temperature region.
+     *
+     * @param T       Temperature (Kelvin)
+     * @param w       Weights, indexed by species (length m_kk)
+     * @param coeffs  Output array of 9 combined coefficients
+     * @param Tlow    Output lower limit of the range of validity
+     * @param Thigh   Output upper limit of the range of validity
+     */
+    void combine(double T, const double* w, double* coeffs, double& Tlow,
+                 double& Thigh) const;
+
+    //! Evaluate the properties for a single set of NASA 9-coefficient
+    //! polynomial coefficients *c*, such as those computed by combine().
+    //! Returns the non-dimensional heat capacity, enthalpy, and entropy.
+    static void evalCoeffs(double T, const double* c, double& cp_R,
+                           double& h_RT, double& s_R);
+
+protected:
+    //! Convert the parameterization *stit* to the form of the NASA
+    //! 9-coefficient polynomials. On return, *bounds* contains the lower
+    //! temperature limits of all regions except the first, and *coeffs*
+    //! contains 9 coefficients for each region. Returns `false` if the
+    //! parameterization is not supported.
+    static bool convert(const SpeciesThermoInterpType& stit, vector_fp& bounds,
+                        vector_fp& coeffs);
+
+    //! Build the packed arrays from #m_speciesBounds and #m_speciesCoeffs
+    void build();
+
+    //! Evaluate the packed species, including the derivatives of the heat
+    //! capacities if *ddT* is `true`
+    template <bool ddT>
+    void evalPacked(double T, double* cp_R, double* h_RT, double* s_R,
+                    double* dcp_R_dT) const;
+
+    //! Species index of each packed species
+    std::vector<size_t> m_species;
+
+    //! Packed position of each species; `npos` for species not handled here
+    std::vector<size_t> m_pos;
+
+    //! Region boundaries and coefficients of each packed species, as returned
+    //! by convert()
+    std::vector<vector_fp> m_speciesBounds, m_speciesCoeffs;
+
+    //! Maximum number of temperature regions of any species
+    size_t m_nregions;
+
+    //! Region boundaries, where `m_bounds[r * n + i]` is the lower limit of
+    //! region `r + 1` of packed species `i`, and `n` is the number of packed
+    //! species. A species is in the region above a boundary if the
+    //! temperature is greater than the boundary.
+    vector_fp m_bounds;
+
+    //! NASA 9 coefficients, where `m_coeffs[(r * 9 + j) * n + i]` is
+    //! coefficient `j` for region `r` of packed species `i`.
+    vector_fp m_coeffs;
+
+    bool m_ok; //!< `true` if the packed arrays are up to date
+};
+
 //! A species thermodynamic property manager for a phase.
 /*!
  * This is a general manager that can handle a wide variety of species
@@ -27,7 +161,8 @@ namespace Cantera
  * phase, for a range of temperatures. Note, the pressure dependence of the
  * species thermodynamic functions is not handled at this level. Species using
  * the same parameterization are grouped together in order to minimize the
- * operation count and achieve better efficiency.
+ * operation count and achieve better efficiency. Species using NASA or Shomate
+ * polynomials are evaluated together by a PolyThermoBatchEvaluator.
  *
  * The most important member function for the MultiSpeciesThermo class is the
  * member function MultiSpeciesThermo::update(). The function calculates the
@@ -97,6 +232,46 @@ public:
     virtual void update(doublereal T, doublereal* cp_R,
                         doublereal* h_RT, doublereal* s_R) const;
 
+    //! Compute the reference-state properties for all species together with
+    //! the temperature derivatives of the heat capacities.
+    /*!
+     * The properties are computed in the same pass over the parameterizations
+     * as the derivatives, which are evaluated analytically. The derivatives
+     * of the other properties follow from \f$ d(h/RT)/dT = (c_p/R - h/RT)/T
+     * \f$ and \f$ d(s/R)/dT = (c_p/R)/T \f$.
+     *
+     * @param T         Temperature (Kelvin)
+     * @param cp_R      Vector of Dimensionless heat capacities. (length m_kk).
+     * @param h_RT      Vector of Dimensionless enthalpies. (length m_kk).
+     * @param s_R       Vector of Dimensionless entropies. (length m_kk).
+     * @param dcp_R_dT  Vector of temperature derivatives of the dimensionless
+     *                  heat capacities [1/K]. (length m_kk).
+     */
+    virtual void update_ddT(double T, double* cp_R, double* h_RT, double* s_R,
+                            double* dcp_R_dT) const;
+
+    //! Prepare for concurrent calls to update() and update_ddT() from multiple
+    //! threads. Returns `true` if these calls do not modify this object,
+    //! which is the case if all species are handled by the packed evaluator
+    //! (see PolyThermoBatchEvaluator).
+    bool prepareConcurrentUpdate() const;
+
+    //! Compute the coefficients of a single NASA 9-coefficient polynomial for
+    //! the weighted sum of the reference state properties of all species.
+    /*!
+     * With the weights set to the mole fractions, the polynomial gives the
+     * mean molar reference state properties of a mixture of fixed composition
+     * as a function of temperature, which can be evaluated with
+     * PolyThermoBatchEvaluator::evalCoeffs() at a cost independent of the
+     * number of species. See PolyThermoBatchEvaluator::combine() for the
+     * arguments. Returns `false` if some species are not handled by the
+     * packed evaluator, in which case no coefficients are computed. Does not
+     * modify this object, and may be called concurrently from multiple
+     * threads.
+     */
+    bool combinedCoeffs(double T, const double* w, double* coeffs,
+                        double& Tlow, double& Thigh) const;
+
     //! Minimum temperature.
     /*!
      * If no argument is supplied, this method returns the minimum temperature
@@ -214,6 +389,13 @@ protected:
     //! Temperature polynomials for each thermo parameterization
     mutable tpoly_map m_tpoly;
 
+    //! Evaluator for the species using NASA or Shomate polynomials
+    mutable PolyThermoBatchEvaluator m_packed;
+
+    //! Parameterization types for which some species are not handled by
+    //! #m_packed and need to be evaluated individually
+    std::set<int> m_unpackedTypes;
+
     //! Map from species index to location within #m_sp, such that
     //! `m_sp[m_speciesLoc[k].first][m_speciesLoc[k].second]` is the
     //! SpeciesThermoInterpType object for species `k`.
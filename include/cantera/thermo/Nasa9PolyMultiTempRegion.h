@@ -92,6 +92,10 @@ public:
                                       doublereal* cp_R, doublereal* h_RT,
                                       doublereal* s_R) const;
 
+    virtual void updatePropertiesTemp_ddT(double temp, double* cp_R,
+                                          double* h_RT, double* s_R,
+                                          double* dcp_R_dT) const;
+
     virtual size_t nCoeffs() const;
 
     //! This utility function reports back the type of parameterization and all
@@ -129,6 +129,14 @@ public:
         updateProperties(tPoly, cp_R, h_RT, s_R);
     }
 
+    virtual void updatePropertiesTemp_ddT(double temp, double* cp_R,
+                                          double* h_RT, double* s_R,
+                                          double* dcp_R_dT) const {
+        updatePropertiesTemp(temp, cp_R, h_RT, s_R);
+        *dcp_R_dT = m_coeff[1] + temp * (2.0 * m_coeff[2]
+            + temp * (3.0 * m_coeff[3] + temp * 4.0 * m_coeff[4]));
+    }
+
     virtual void reportParameters(size_t& n, int& type,
                                   doublereal& tlow, doublereal& thigh,
                                   doublereal& pref,
@@ -123,6 +123,15 @@ public:
         }
     }
 
+    void updatePropertiesTemp_ddT(double temp, double* cp_R, double* h_RT,
+                                  double* s_R, double* dcp_R_dT) const {
+        if (temp <= m_midT) {
+            mnp_low.updatePropertiesTemp_ddT(temp, cp_R, h_RT, s_R, dcp_R_dT);
+        } else {
+            mnp_high.updatePropertiesTemp_ddT(temp, cp_R, h_RT, s_R, dcp_R_dT);
+        }
+    }
+
     size_t nCoeffs() const { return 15; }
 
     void reportParameters(size_t& n, int& type,
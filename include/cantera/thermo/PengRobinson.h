@@ -216,14 +216,16 @@ public:
     /*!
      *  The \f$a\f$ and the \f$b\f$ parameters depend on the mole fraction and the
      *  parameter \f$\alpha\f$ depends on the temperature. This function updates
-     *  the internal numbers based on the state of the object.
+     *  the internal numbers based on the state of the object. The species sums
+     *  of the mixing rule are cached, and are only re-evaluated if the
+     *  temperature or the composition has changed since the last call.
      */
     virtual void updateMixingExpressions();
 
-    //! Calculate the \f$a\f$, \f$b\f$, and \f$\alpha\f$ parameters given the temperature
+    //! Get the \f$a\f$, \f$b\f$, and \f$\alpha\f$ parameters at the current state
     /*!
-     * This function doesn't change the internal state of the object, so it is a
-     * const function.  It does use the stored mole fractions in the object.
+     * These values are evaluated by updateMixingExpressions() whenever the
+     * temperature or the composition changes.
      *
      * @param aCalc (output)  Returns the a value
      * @param bCalc (output)  Returns the b value.
@@ -264,10 +266,25 @@ protected:
     mutable vector_fp m_d2alphadT2;
     vector_fp m_alpha;
 
-    // Matrices for Binary coefficients a_{i,j} and {a*alpha}_{i.j} are saved in an
-    // array form. Size = (m_kk, m_kk).
+    // Matrix for Binary coefficients a_{i,j} is saved in an array form.
+    // Size = (m_kk, m_kk).
     Array2D m_a_coeffs;
-    Array2D m_aAlpha_binary;
+
+    //! Mixing rule sums \f$ \sum_i X_i (a \alpha)_{ki} \f$ at the current
+    //! temperature and composition. Length = m_kk.
+    vector_fp m_aAlphaSum;
+
+    //! Mixing rule sums \f$ \sum_i X_i (a \alpha)_{ki} \alpha'_i / \alpha_i \f$
+    //! at the current temperature and composition. Length = m_kk.
+    vector_fp m_aAlphaDerivSum;
+
+    //! Temperature at which #m_alpha and the mixing rule sums were last
+    //! evaluated. Set to NaN to force their re-evaluation.
+    double m_mixTemp;
+
+    //! Value of stateMFNumber() for which the mixing rule sums were last
+    //! evaluated
+    int m_mixStateNum;
 
     //! Explicitly-specified binary interaction parameters, to enable serialization
     std::map<std::string, std::map<std::string, double>> m_binaryParameters;
@@ -276,9 +293,6 @@ protected:
 
     double m_Vroot[3];
 
-    //! Temporary storage - length = m_kk.
-    mutable vector_fp m_pp;
-
     // Partial molar volumes of the species
     mutable vector_fp m_partialMolarVolumes;
 
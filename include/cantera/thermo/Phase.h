@@ -353,6 +353,9 @@ public:
     void restoreState(const vector_fp& state);
 
     //! Restore the state of the phase from a previously saved state vector.
+    //! If the composition is unchanged, the state counter returned by
+    //! stateMFNumber() is not incremented, which allows cached properties
+    //! depending on the composition to be reused.
     //!     @param lenstate   Length of the state vector
     //!     @param state      Vector of state conditions.
     virtual void restoreState(size_t lenstate, const doublereal* state);
@@ -1015,6 +1018,28 @@ private:
     //! this int is incremented.
     int m_stateNum;
 
+    //! Determine offsets of native state variables returned by nativeState(),
+    //! which are cached for use by saveState() and restoreState().
+    void updateNativeStateOffsets() const;
+
+    //! True if the cached offsets of native state variables are valid
+    mutable bool m_nativeOk;
+
+    //! Offset of the temperature in the native state vector
+    mutable size_t m_nativeT;
+
+    //! Offset of the density (compressible phases) or pressure
+    //! (incompressible phases) in the native state vector
+    mutable size_t m_nativeDP;
+
+    //! Offset of the composition in the native state vector, or `npos` if
+    //! the composition is not part of the native state
+    mutable size_t m_nativeComp;
+
+    //! True if the native composition variables are mole fractions rather
+    //! than mass fractions
+    mutable bool m_nativeMoleFractions;
+
     //! Vector of the species names
     std::vector<std::string> m_speciesNames;
 
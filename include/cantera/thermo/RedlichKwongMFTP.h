@@ -227,14 +227,17 @@ public:
     /*!
      *  The a and the b parameters depend on the mole fraction and the
      *  temperature. This function updates the internal numbers based on the
-     *  state of the object.
+     *  state of the object. The O(m_kk^2) species sums of the mixing rule only
+     *  depend on the composition, and are re-evaluated only if it has changed
+     *  since the last call.
      */
     virtual void updateMixingExpressions();
 
     //! Calculate the a and the b parameters given the temperature
     /*!
      * This function doesn't change the internal state of the object, so it is a
-     * const function.  It does use the stored mole fractions in the object.
+     * const function.  It does use the mixing rule sums for the stored mole
+     * fractions in the object.
      *
      * @param temp  Temperature (TKelvin)
      * @param aCalc (output)  Returns the a value
@@ -271,11 +274,32 @@ protected:
      */
     doublereal m_a_current;
 
-    vector_fp a_vec_Curr_;
     vector_fp b_vec_Curr_;
 
     Array2D a_coeff_vec;
 
+    //! Mixing rule sums \f$ \sum_i X_i a_{ki,0} \f$ for the current composition.
+    //! Length = m_kk.
+    vector_fp m_a0Sum;
+
+    //! Mixing rule sums \f$ \sum_i X_i a_{ki,1} \f$ for the current composition.
+    //! Length = m_kk.
+    vector_fp m_a1Sum;
+
+    //! Mixing rule sums \f$ \sum_i X_i a_{ki} \f$ at the current temperature
+    //! and composition. Length = m_kk.
+    vector_fp m_aSum;
+
+    //! Temperature-independent part of the mixture "a" parameter
+    double m_a0_mix;
+
+    //! Coefficient of the temperature in the mixture "a" parameter
+    double m_a1_mix;
+
+    //! Value of stateMFNumber() for which the mixing rule sums were last
+    //! evaluated. Set to -2 to force their re-evaluation.
+    int m_mixStateNum;
+
     //! Explicitly-specified binary interaction parameters
     std::map<std::string, std::map<std::string, std::pair<double, double>>> m_binaryParameters;
 
@@ -287,9 +311,6 @@ protected:
 
     doublereal Vroot_[3];
 
-    //! Temporary storage - length = m_kk.
-    mutable vector_fp m_pp;
-
     // Partial molar volumes of the species
     mutable vector_fp m_partialMolarVolumes;
 
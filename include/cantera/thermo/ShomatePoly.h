@@ -146,6 +146,17 @@ public:
         updateProperties(tPoly, cp_R, h_RT, s_R);
     }
 
+    virtual void updatePropertiesTemp_ddT(double temp, double* cp_R,
+                                          double* h_RT, double* s_R,
+                                          double* dcp_R_dT) const {
+        double tPoly[6];
+        updateTemperaturePoly(temp, tPoly);
+        updateProperties(tPoly, cp_R, h_RT, s_R);
+        // d/dT = 1e-3 d/dt
+        *dcp_R_dT = 1e-3 * (m_coeff[1] + 2.0 * m_coeff[2] * tPoly[0]
+            + 3.0 * m_coeff[3] * tPoly[1] - 2.0 * m_coeff[4] * tPoly[3] * tPoly[5]);
+    }
+
     virtual void reportParameters(size_t& n, int& type,
                                   doublereal& tlow, doublereal& thigh,
                                   doublereal& pref,
@@ -317,6 +328,16 @@ public:
         }
     }
 
+    virtual void updatePropertiesTemp_ddT(double temp, double* cp_R,
+                                          double* h_RT, double* s_R,
+                                          double* dcp_R_dT) const {
+        if (temp <= m_midT) {
+            msp_low.updatePropertiesTemp_ddT(temp, cp_R, h_RT, s_R, dcp_R_dT);
+        } else {
+            msp_high.updatePropertiesTemp_ddT(temp, cp_R, h_RT, s_R, dcp_R_dT);
+        }
+    }
+
     virtual size_t nCoeffs() const { return 15; }
 
     virtual void reportParameters(size_t& n, int& type,
@@ -205,6 +205,24 @@ public:
                                       doublereal* h_RT,
                                       doublereal* s_R) const;
 
+    //! Compute the reference-state properties of one species together with
+    //! the temperature derivative of the heat capacity
+    /*!
+     * The temperature derivatives of the other properties follow from the
+     * thermodynamic identities \f$ d(h/RT)/dT = (c_p/R - h/RT)/T \f$ and
+     * \f$ d(s/R)/dT = (c_p/R)/T \f$.
+     *
+     * @param temp      Temperature (Kelvin)
+     * @param cp_R      Dimensionless heat capacity
+     * @param h_RT      Dimensionless enthalpy
+     * @param s_R       Dimensionless entropy
+     * @param dcp_R_dT  Derivative of the dimensionless heat capacity with
+     *                  respect to temperature [1/K]
+     */
+    virtual void updatePropertiesTemp_ddT(double temp, double* cp_R,
+                                          double* h_RT, double* s_R,
+                                          double* dcp_R_dT) const;
+
     //! This utility function returns the number of coefficients
     //! for a given type of species parameterization
     virtual size_t nCoeffs() const;
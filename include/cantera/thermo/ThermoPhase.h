@@ -642,6 +642,57 @@ public:
         throw NotImplementedError("ThermoPhase::getCp_R");
     }
 
+    //! Get the temperature derivatives of the nondimensional heat capacities
+    //! at constant pressure for the species standard states at the current
+    //! *T* and *P* of the solution
+    /*!
+     * @param dcpr  Output vector of temperature derivatives of the
+     *              nondimensional standard state heat capacities [1/K].
+     *              Length: m_kk.
+     */
+    virtual void getCp_R_ddT(double* dcpr) const {
+        throw NotImplementedError("ThermoPhase::getCp_R_ddT");
+    }
+
+    //! Get the temperature derivatives of the nondimensional enthalpy
+    //! functions for the species standard states at the current *T* and *P*
+    //! of the solution
+    /*!
+     * The default implementation uses the identity
+     * \f$ d(h^0_k/RT)/dT = (c^0_{p,k}/R - h^0_k/RT)/T \f$.
+     *
+     * @param dhrt  Output vector of temperature derivatives of the
+     *              nondimensional standard state enthalpies [1/K].
+     *              Length: m_kk.
+     */
+    virtual void getEnthalpy_RT_ddT(double* dhrt) const;
+
+    //! Get the temperature derivatives of the nondimensional entropy
+    //! functions for the species standard states at the current *T* and *P*
+    //! of the solution
+    /*!
+     * The default implementation uses the identity
+     * \f$ d(s^0_k/R)/dT = (c^0_{p,k}/R)/T \f$.
+     *
+     * @param dsr   Output vector of temperature derivatives of the
+     *              nondimensional standard state entropies [1/K].
+     *              Length: m_kk.
+     */
+    virtual void getEntropy_R_ddT(double* dsr) const;
+
+    //! Get the temperature derivatives of the nondimensional Gibbs functions
+    //! for the species standard states at the current *T* and *P* of the
+    //! solution
+    /*!
+     * The default implementation uses the identity
+     * \f$ d(g^0_k/RT)/dT = -(h^0_k/RT)/T \f$.
+     *
+     * @param dgrt  Output vector of temperature derivatives of the
+     *              nondimensional standard state Gibbs functions [1/K].
+     *              Length: m_kk.
+     */
+    virtual void getGibbs_RT_ddT(double* dgrt) const;
+
     //!  Get the molar volumes of the species standard states at the current
     //!  *T* and *P* of the solution.
     /*!
@@ -1183,6 +1234,71 @@ public:
      */
     virtual void setState(const AnyMap& state);
 
+    //! @}
+    //! @name Batched Property Evaluation
+    //! @{
+
+    //! Evaluate mixture properties for a batch of states.
+    /*!
+     * The states are given as arrays of temperature, pressure and mass
+     * fractions, where the mass fractions are stored by species, such that
+     * `Y[k * nStates + m]` is the mass fraction of species *k* in state *m*.
+     * As for setState_TPY(), negative mass fractions are set to zero and the
+     * mass fractions of each state are normalized. Any of the output arrays
+     * may be `nullptr` if the corresponding property is not needed.
+     *
+     * The default implementation sets the state of this phase to each of the
+     * states in turn. The state of the phase is restored afterwards.
+     *
+     * @param nStates  Number of states
+     * @param T        Temperatures [K]. Length: nStates.
+     * @param P        Pressures [Pa]. Length: nStates.
+     * @param Y        Mass fractions. Length: m_kk * nStates.
+     * @param h        Output array of specific enthalpies [J/kg].
+     * @param cp       Output array of specific heat capacities at constant
+     *                 pressure [J/kg/K].
+     * @param rho      Output array of densities [kg/m^3].
+     * @param mw       Output array of mean molecular weights [kg/kmol].
+     */
+    virtual void getPropertiesBatch(size_t nStates, const double* T,
+                                    const double* P, const double* Y,
+                                    double* h, double* cp, double* rho,
+                                    double* mw);
+
+    //! Solve for the temperatures of a batch of states with given specific
+    //! enthalpy, pressure and composition.
+    /*!
+     * This is the batched equivalent of calling setState_TPY() followed by
+     * setState_HP() for each state. The mass fractions are stored in the same
+     * way as for getPropertiesBatch(). The default implementation sets the
+     * state of this phase to each of the states in turn. The state of the
+     * phase is restored afterwards.
+     *
+     * @param nStates  Number of states
+     * @param h        Specific enthalpies [J/kg]. Length: nStates.
+     * @param P        Pressures [Pa]. Length: nStates.
+     * @param Y        Mass fractions. Length: m_kk * nStates.
+     * @param T        On input, initial estimates of the temperatures [K],
+     *                 for example from the previous time step of a
+     *                 simulation. On output, the temperatures of the states.
+     * @param tol      Relative tolerance, as for setState_HP().
+     */
+    virtual void solveTemperatureBatch_HP(size_t nStates, const double* h,
+                                          const double* P, const double* Y,
+                                          double* T, double tol=1e-9);
+
+    //! Set the number of threads used by getPropertiesBatch() and
+    //! solveTemperatureBatch_HP(), for phase models which evaluate batches of
+    //! states concurrently. If zero
+    //! (default), the number of concurrent threads supported by the hardware
+    //! is used.
+    void setBatchThreads(size_t nThreads) {
+        m_batchThreads = nThreads;
+    }
+
+    //! Number of threads used for batches of states
+    size_t batchThreads() const;
+
     //! @}
     //! @name Set Mixture Composition by Mixture Fraction
     //! @{
@@ -1925,6 +2041,10 @@ protected:
 
     //! last value of the temperature processed by reference state
     mutable doublereal m_tlast;
+
+    //! Number of threads used by getPropertiesBatch(); zero to use the
+    //! number of hardware threads
+    size_t m_batchThreads;
 };
 
 //! typedef for the ThermoPhase class
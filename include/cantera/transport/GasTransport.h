@@ -16,6 +16,27 @@ namespace Cantera
 
 class MMCollisionInt;
 
+//! Polynomial fits generated during the initialization of a GasTransport object
+/*!
+ * The fits depend only on the species, the temperature range of the phase and
+ * the transport mode. They can be stored and used to initialize another
+ * transport manager for the same phase without repeating the fitting
+ * procedure; see GasTransport::fits() and GasTransport::setFits().
+ */
+struct GasTransportFits
+{
+    int mode = 0; //!< Type of the polynomial fits; see GasTransport::CKMode()
+    std::vector<vector_fp> visccoeffs; //!< Fits to the species viscosities
+    std::vector<vector_fp> condcoeffs; //!< Fits to the species conductivities
+    std::vector<vector_fp> diffcoeffs; //!< Fits to the binary diffusivities
+    std::vector<vector_int> poly; //!< Indices of the collision integral fits
+    std::vector<vector_int> star_poly_uses_actualT; //!< @see #poly
+    std::vector<vector_fp> omega22_poly; //!< Fits to the omega22 integral
+    std::vector<vector_fp> astar_poly; //!< Fits to the astar integral
+    std::vector<vector_fp> bstar_poly; //!< Fits to the bstar integral
+    std::vector<vector_fp> cstar_poly; //!< Fits to the cstar integral
+};
+
 //! Class GasTransport implements some functions and properties that are
 //! shared by the MixTransport and MultiTransport classes.
 //!
@@ -154,7 +175,20 @@ public:
                                                 double* cstar_coeffs, bool actualT);
 
     virtual void init(ThermoPhase* thermo, int mode=0, int log_level=0);
-    
+
+    //! Return the polynomial fits generated by init()
+    GasTransportFits fits() const;
+
+    //! Use previously generated polynomial fits in the next call to init()
+    /*!
+     * The fits to the collision integrals and the species properties are
+     * skipped, which accounts for most of the time needed to initialize the
+     * transport manager. The fits must have been generated for the same set of
+     * species, temperature range and transport mode; only the number of
+     * species and the mode are checked.
+     */
+    void setFits(const GasTransportFits& fits);
+
     //! Boolean indicating the form of the transport properties polynomial fits.
     //! Returns true if the Chemkin form is used.
     bool CKMode() const {
@@ -549,6 +583,9 @@ protected:
 
     //! Level of verbose printing during initialization
     int m_log_level;
+
+    //! Polynomial fits to be used by the next call to init(); see setFits()
+    unique_ptr<GasTransportFits> m_precomputed_fits;
 };
 
 } // namespace Cantera
@@ -0,0 +1,197 @@
+//! @file ISATCache.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ISATCACHE_H
+#define CT_ISATCACHE_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/numerics/eigen_dense.h"
+
+#include <list>
+
+namespace Cantera
+{
+
+class Solution;
+class ThermoPhase;
+class Reactor;
+class ReactorNet;
+
+//! In situ adaptive tabulation of the reaction mapping of a constant pressure
+//! reactor.
+/*!
+ * The reaction mapping \f$ R(\phi) \f$ gives the composition reached by
+ * integrating the governing equations of an adiabatic, constant pressure
+ * reactor for a fixed time step \f$ \Delta t \f$, starting from the
+ * composition \f$ \phi \f$. Here, the composition consists of the scaled
+ * temperature \f$ T / T_s \f$ followed by the species mass fractions. This
+ * class implements the in situ adaptive tabulation (ISAT) algorithm of
+ * S. B. Pope, Combust. Theory Modelling 1:41-63 (1997), which approximates the
+ * mapping by storing records of the form
+ * \f$ (\phi_0, R(\phi_0), A(\phi_0)) \f$, where \f$ A = \partial R / \partial
+ * \phi \f$ is the mapping gradient. For a query composition \f$ \phi_q \f$
+ * inside the ellipsoid of accuracy (EOA) of a record, the mapping is
+ * approximated by the linear approximation
+ * \f$ R(\phi_q) \approx R(\phi_0) + A (\phi_q - \phi_0) \f$.
+ *
+ * The records are stored in the leaves of a binary tree, where each internal
+ * node holds a cutting plane separating the compositions of the records in
+ * its two subtrees. For each query, one of the following actions is taken:
+ *
+ *  - *retrieve*: The query composition is inside the EOA of the leaf found by
+ *    traversing the tree, or of one of the most recently used records (see
+ *    setSearchLimit()). The linear approximation is returned.
+ *  - *grow*: The mapping is computed by direct integration. The linear
+ *    approximation of the leaf record meets the tolerance, so its EOA is
+ *    grown to include the query composition.
+ *  - *add*: The linear approximation does not meet the tolerance. The mapping
+ *    gradient is computed and a new record is added to the tree. If the
+ *    table is full (see setMaxRecords()), the least recently used record is
+ *    removed first.
+ *
+ * The mapping gradient is computed by forward finite differences, which
+ * requires one integration per component of the composition. Integrations
+ * use a single IdealGasConstPressureReactor (or ConstPressureReactor, for
+ * non-ideal phases) with the pressure of the phase at construction.
+ *
+ * @ingroup ZeroD
+ */
+class ISATCache
+{
+public:
+    //! Constructor
+    /*!
+     * @param sol  Solution object used for all integrations. advance() takes
+     *     the initial state from and stores the final state in the phase of
+     *     this object.
+     * @param dt  Time step of the tabulated reaction mapping [s]
+     * @param tol  Error tolerance of the scaled composition
+     */
+    ISATCache(shared_ptr<Solution> sol, double dt, double tol=1e-4);
+    ~ISATCache();
+    ISATCache(const ISATCache&) = delete;
+    ISATCache& operator=(const ISATCache&) = delete;
+
+    //! Advance the state of the phase by the time step of the table.
+    /*!
+     * The pressure of the phase must match the pressure of the table, which
+     * is the pressure of the phase at construction.
+     */
+    void advance();
+
+    //! Set the maximum number of records. If the table is full, the least
+    //! recently used record is removed before a new record is added.
+    void setMaxRecords(size_t nmax);
+
+    //! Maximum number of records
+    size_t maxRecords() const {
+        return m_maxRecords;
+    }
+
+    //! Set the number of most recently used records which are checked if the
+    //! query composition is not in the EOA of the leaf found by traversing the
+    //! tree. Default 10.
+    void setSearchLimit(size_t n) {
+        m_searchLimit = n;
+    }
+
+    //! Set the temperature used to scale the temperature component of the
+    //! composition [K]. Default 1000 K. Removes all records.
+    void setTemperatureScale(double Ts);
+
+    //! Set the relative and absolute tolerances of the integrator
+    void setIntegratorTolerances(double rtol, double atol);
+
+    //! Number of records in the table
+    size_t nRecords() const {
+        return m_lru.size();
+    }
+
+    //! Remove all records
+    void clear();
+
+    //! Statistics on the queries since construction or the last call to
+    //! clear().
+    /*!
+     * The map contains the total number of `queries` and the number of
+     * `retrieves`, `grows`, `adds` and `evictions`, as well as the number of
+     * `integrations`, including the ones used to compute mapping gradients,
+     * and the number of `records`.
+     */
+    AnyMap stats() const;
+
+protected:
+    //! Record of the reaction mapping for a single composition
+    struct Record;
+
+    //! Node of the binary tree, which is either a leaf holding a record, or
+    //! an internal node holding a cutting plane
+    struct Node;
+
+    //! Compute the reaction mapping of the scaled composition *phi* by direct
+    //! integration
+    void integrate(const vector_fp& phi, vector_fp& out);
+
+    //! Set the scaled composition *phi* from the state of the phase
+    void getComposition(vector_fp& phi) const;
+
+    //! Set the state of the phase from the scaled composition *phi*
+    void setComposition(const vector_fp& phi);
+
+    //! Leaf of the tree found by traversing the cutting planes for *phi*
+    Node* findLeaf(const vector_fp& phi) const;
+
+    //! Check if *phi* is in the EOA of record *rec*
+    bool inEOA(const Record& rec, const vector_fp& phi) const;
+
+    //! Evaluate the linear approximation of record *rec* at *phi*
+    void linearMapping(const Record& rec, const vector_fp& phi,
+                       vector_fp& out) const;
+
+    //! Move the record held by leaf *leaf* to the front of the LRU list
+    void touch(Node* leaf);
+
+    //! Create a record for composition *phi* with mapping *R*, and insert it
+    //! into the tree
+    void addRecord(const vector_fp& phi, const vector_fp& R);
+
+    //! Remove the least recently used record from the tree
+    void evict();
+
+    shared_ptr<Solution> m_sol;
+    ThermoPhase* m_thermo;
+    std::unique_ptr<Reactor> m_reactor;
+    std::unique_ptr<ReactorNet> m_net;
+
+    double m_dt; //!< Time step of the reaction mapping [s]
+    double m_tol; //!< Error tolerance of the scaled composition
+    double m_pressure; //!< Pressure of the reaction mapping [Pa]
+    double m_Tscale; //!< Temperature scale [K]
+    size_t m_maxRecords;
+    size_t m_searchLimit;
+    size_t m_nv; //!< Number of components of the composition
+
+    //! Root of the binary tree; null if the table is empty
+    std::unique_ptr<Node> m_root;
+
+    //! Leaves of the tree, ordered from the most to the least recently used
+    std::list<Node*> m_lru;
+
+    vector_fp m_phi; //!< Work array: query composition
+    vector_fp m_R; //!< Work array: reaction mapping
+    vector_fp m_work; //!< Work array: linear approximation
+
+    size_t m_nQueries;
+    size_t m_nRetrieves;
+    size_t m_nGrows;
+    size_t m_nAdds;
+    size_t m_nEvictions;
+    size_t m_nIntegrations;
+};
+
+}
+
+#endif
@@ -17,6 +17,11 @@ namespace Cantera
  * be connected to a "flow device" such as a mass flow controller, a pressure
  * regulator, etc. Additional reactors may be connected to the other end of the
  * flow device, allowing construction of arbitrary reactor networks.
+ *
+ * Species treated as quasi-steady by the kinetics manager (see
+ * Kinetics::setQuasiSteadySpecies()) are removed from the state vector when
+ * the reactor is initialized. Their mass fractions are set to zero in the
+ * phase, i.e. the mass of the quasi-steady species is neglected.
  */
 class IdealGasConstPressureReactor : public ConstPressureReactor
 {
@@ -40,6 +45,21 @@ public:
     virtual void initialize(doublereal t0 = 0.0);
     virtual void eval(double t, double* LHS, double* RHS);
 
+    //! Calculate the Jacobian of the governing equations.
+    /*!
+     * Contributions from gas phase chemistry and from the dilution by inlet
+     * flows are included, while the temperature dependence of the heat
+     * capacity is neglected. To preserve sparsity, terms arising from the
+     * dependence of the mixture density on composition are only retained in
+     * the energy equation. Terms due to walls and outlets are neglected, and
+     * reactors with surfaces are not supported.
+     */
+    virtual Eigen::SparseMatrix<double> jacobian();
+
+    virtual bool hasJacobian() const {
+        return m_nv_surf == 0;
+    }
+
     virtual void updateState(doublereal* y);
 
     //! Return the index in the solution vector for this reactor of the
@@ -50,7 +70,26 @@ public:
     std::string componentName(size_t k);
 
 protected:
+    //! Number of species in the state vector
+    size_t nStateSpecies() const {
+        return m_stateSpecies.empty() ? m_nsp : m_stateSpecies.size();
+    }
+
     vector_fp m_hk; //!< Species molar enthalpies
+
+    //! Indices of the species included in the state vector; empty if there are
+    //! no quasi-steady species
+    std::vector<size_t> m_stateSpecies;
+
+    //! Offset of each species from the first species in the state vector;
+    //! `npos` for quasi-steady species
+    std::vector<size_t> m_speciesOffset;
+
+    //! Work array for the mass fractions of all species
+    vector_fp m_Yfull;
+
+    //! Work array for the mass production rates of all species
+    vector_fp m_mdYdt;
 };
 }
 
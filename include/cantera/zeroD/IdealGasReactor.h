@@ -39,6 +39,20 @@ public:
 
     virtual void eval(double t, double* LHS, double* RHS);
 
+    //! Calculate the Jacobian of the governing equations.
+    /*!
+     * Contributions from gas phase chemistry and from the dilution by inlet
+     * flows are included. Derivatives with respect to the mass and volume of
+     * the reactor, the temperature dependence of the heat capacity, and terms
+     * due to walls and outlets are neglected. Reactors with surfaces are not
+     * supported.
+     */
+    virtual Eigen::SparseMatrix<double> jacobian();
+
+    virtual bool hasJacobian() const {
+        return m_nv_surf == 0;
+    }
+
     virtual void updateState(doublereal* y);
 
     //! Return the index in the solution vector for this reactor of the
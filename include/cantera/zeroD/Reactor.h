@@ -7,11 +7,14 @@
 #define CT_REACTOR_H
 
 #include "ReactorBase.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
 
 class Solution;
+class AnyMap;
+class DirectedRelationGraph;
 
 /**
  * Class Reactor is a general-purpose class for stirred reactors. The reactor
@@ -125,6 +128,30 @@ public:
     //! coefficients for governing equations, length m_nv, default values 0
     virtual void eval(double t, double* LHS, double* RHS);
 
+    //! Calculate the Jacobian of the reactor governing equations.
+    /*!
+     * Returns the derivatives of the time derivatives of the state variables
+     * with respect to the state variables, d(ydot)/dy, using the indices of
+     * the local state vector of this reactor and the state set by the last
+     * call to updateState(). Implementations may neglect terms which would
+     * otherwise destroy the sparsity of the matrix, since the result is only
+     * used to form the Newton iteration matrix of implicit integrators.
+     */
+    virtual Eigen::SparseMatrix<double> jacobian() {
+        throw NotImplementedError("Reactor::jacobian");
+    }
+
+    //! `true` if jacobian() is implemented for this reactor in its current
+    //! configuration
+    virtual bool hasJacobian() const {
+        return false;
+    }
+
+    //! Set the settings used to evaluate the derivatives of the reaction
+    //! rates when calculating the Jacobian.
+    //! @see Kinetics::setDerivativeSettings
+    virtual void setDerivativeSettings(const AnyMap& settings);
+
     virtual void syncState();
 
     //! Set the state of the reactor to correspond to the state vector *y*.
@@ -178,6 +205,78 @@ public:
     //! Reset the reaction rate multipliers
     virtual void resetSensitivity(double* params);
 
+    //! @name Adaptive chemistry
+    //!
+    //! During integration, the reactions which are relevant for a set of target
+    //! species are periodically identified using a DirectedRelationGraph, and
+    //! all other reactions are deactivated using Kinetics::setActiveReactions().
+    //! The updates are controlled by ReactorNet::setAdaptiveChemistry().
+    //! @{
+
+    //! Enable or disable adaptive reduction of the reaction mechanism.
+    /*!
+     * Supported settings are:
+     *  - `targets`: list of target species (required)
+     *  - `method`: definition of the interaction coefficients, either
+     *    `"DRGEP"` (default) or `"DRG"`
+     *  - `threshold`: minimum importance of retained species (default 1e-3)
+     *  - `tolerance`: maximum error of the net production rates of the reduced
+     *    mechanism relative to the largest net production rate of the full
+     *    mechanism (default 0.01). If the error is exceeded, the threshold is
+     *    reduced by a factor of 10.
+     *  - `max-refinements`: maximum number of threshold reductions before the
+     *    full mechanism is used (default 3)
+     *
+     * An empty map disables adaptive chemistry. If several reactors share a
+     * kinetics manager, each of them needs to use adaptive chemistry.
+     */
+    void setAdaptiveChemistry(const AnyMap& settings);
+
+    //! Returns `true` if adaptive chemistry is enabled
+    bool adaptiveChemistry() const {
+        return bool(m_drg);
+    }
+
+    //! Determine the reduced mechanism for the current state of the reactor.
+    //! Called by ReactorNet.
+    //! @returns `true` if the set of active reactions changed
+    bool updateActiveReactions();
+
+    //! Activate the reactions of the reduced mechanism in the kinetics manager,
+    //! which may be shared with other reactors. Called by ReactorNet before the
+    //! governing equations are evaluated.
+    void applyActiveReactions();
+
+    //! Returns `true` if a subset of the reactions was activated at the last
+    //! update of the reduced mechanism
+    bool reducedMechanism() const {
+        return !m_activeReactions.empty();
+    }
+
+    //! Number of species retained at the last update of the reduced mechanism
+    size_t nActiveSpecies() const {
+        return m_nActiveSpecies;
+    }
+
+    //! Number of reactions retained at the last update of the reduced mechanism
+    size_t nActiveReactions() const {
+        return m_nActiveReactions;
+    }
+
+    //! Relative error of the net production rates at the last update of the
+    //! reduced mechanism
+    double adaptiveChemistryError() const {
+        return m_adaptiveError;
+    }
+
+    //! Number of threshold reductions at the last update of the reduced
+    //! mechanism
+    size_t nThresholdRefinements() const {
+        return m_nRefinements;
+    }
+
+    //! @}
+
 protected:
     //! Return the index in the solution vector for this reactor of the species
     //! named *nm*, in either the homogeneous phase or a surface phase, relative
@@ -241,6 +340,22 @@ protected:
 
     // Data associated each sensitivity parameter
     std::vector<SensitivityParameter> m_sensParams;
+
+    //! @name Adaptive chemistry
+    //! @{
+    shared_ptr<DirectedRelationGraph> m_drg; //!< Relation graph; null if disabled
+    double m_drgThreshold; //!< Minimum importance of retained species
+    double m_drgTolerance; //!< Maximum relative error of net production rates
+    size_t m_drgMaxRefinements; //!< Maximum number of threshold reductions
+    std::vector<bool> m_activeReactions; //!< Reactions of reduced mechanism
+    std::vector<bool> m_trialReactions; //!< Work array for candidate mechanisms
+    vector_fp m_wdotFull; //!< Net production rates of the full mechanism
+    vector_fp m_wdotReduced; //!< Net production rates of a reduced mechanism
+    size_t m_nActiveSpecies; //!< Number of retained species
+    size_t m_nActiveReactions; //!< Number of retained reactions
+    double m_adaptiveError; //!< Error of the current reduced mechanism
+    size_t m_nRefinements; //!< Number of threshold reductions at last update
+    //! @}
 };
 }
 
@@ -0,0 +1,196 @@
+//! @file ReactorEnsemble.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORENSEMBLE_H
+#define CT_REACTORENSEMBLE_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <deque>
+#include <mutex>
+
+namespace Cantera
+{
+
+class Solution;
+class Reactor;
+class ReactorNet;
+
+//! Results of a single case integrated by ReactorEnsemble
+//! @ingroup ZeroD
+struct EnsembleResult
+{
+    EnsembleResult();
+
+    //! True if the integration of this case finished without errors
+    bool success;
+
+    //! Error message, if the integration of this case failed
+    std::string message;
+
+    //! Time at which the temperature first exceeded the initial temperature
+    //! by the rise set with ReactorEnsemble::setTemperatureRise(). Linearly
+    //! interpolated between integrator steps. NaN if not reached.
+    double ignitionTime;
+
+    //! Time at which the mass fraction of the species set with
+    //! ReactorEnsemble::setPeakSpecies() reached its maximum, resolved to the
+    //! integrator steps. NaN if not tracked.
+    double peakTime;
+
+    //! Maximum mass fraction of the tracked species
+    double peakValue;
+
+    //! Time at which the integration was terminated
+    double finalTime;
+
+    //! Temperature at the end of the integration
+    double finalTemperature;
+
+    //! Number of integrator steps taken
+    size_t nSteps;
+};
+
+//! Integrate an ensemble of independent reactors in parallel.
+/*!
+ * Each case consists of an initial state (temperature, pressure and mole
+ * fractions) of a single reactor of the type given to the constructor. The
+ * cases are distributed to a set of worker threads, which each hold a clone of
+ * the Solution object (see Solution::clone()) together with their own reactor
+ * and reactor network. These objects are reused for all cases handled by a
+ * worker and between calls to run().
+ *
+ * Cases are initially assigned round-robin to the workers. A worker that runs
+ * out of cases steals cases from the end of the queues of other workers, which
+ * balances the load in sweeps where the cost of individual cases varies
+ * strongly, for example between low- and high-temperature ignition cases.
+ *
+ * Each case is integrated until all enabled termination criteria
+ * (setTemperatureRise(), setPeakSpecies()) are satisfied, or until the time
+ * horizon set with setTimeHorizon() is reached.
+ *
+ * @ingroup ZeroD
+ */
+class ReactorEnsemble
+{
+public:
+    //! Constructor
+    /*!
+     * @param sol  Solution object used as the template for all workers. This
+     *     object is not modified by the ensemble, but must not be modified
+     *     by other threads while run() is executing.
+     * @param reactorType  Type of reactor, as accepted by newReactor()
+     */
+    ReactorEnsemble(shared_ptr<Solution> sol,
+                    const std::string& reactorType="IdealGasConstPressureReactor");
+    ~ReactorEnsemble();
+    ReactorEnsemble(const ReactorEnsemble&) = delete;
+    ReactorEnsemble& operator=(const ReactorEnsemble&) = delete;
+
+    //! Set the number of worker threads. If zero (default), the number of
+    //! concurrent threads supported by the hardware is used.
+    void setThreads(size_t nThreads);
+
+    //! Number of worker threads used by run()
+    size_t nThreads() const;
+
+    //! Set the relative and absolute tolerances of the integrator
+    void setTolerances(double rtol, double atol);
+
+    //! Set the maximum number of integrator steps for each case. Cases that
+    //! exceed this number are marked as failed.
+    void setMaxSteps(size_t nmax) {
+        m_maxSteps = nmax;
+    }
+
+    //! Set the end time of the integration of each case [s]
+    void setTimeHorizon(double tEnd);
+
+    //! Terminate when the temperature exceeds the initial temperature by
+    //! *dT* [K], and record the time at which this happens as the ignition
+    //! delay. A non-positive value disables this criterion.
+    void setTemperatureRise(double dT) {
+        m_deltaT = dT;
+    }
+
+    //! Track the mass fraction of species *name* and terminate after it has
+    //! passed its maximum, as determined by the mass fraction decreasing to
+    //! `(1 - drop)` times the maximum value. An empty name disables this
+    //! criterion.
+    void setPeakSpecies(const std::string& name, double drop=0.05);
+
+    //! Add a case with the initial temperature *T* [K], pressure *P* [Pa]
+    //! and mole fractions given as a composition string. Returns the index of
+    //! the case.
+    size_t addCase(double T, double P, const std::string& X);
+
+    //! Add a case with the initial temperature *T* [K], pressure *P* [Pa]
+    //! and mole fractions given as a composition map
+    size_t addCase(double T, double P, const compositionMap& X);
+
+    //! Add a case with the initial temperature *T* [K], pressure *P* [Pa]
+    //! and mole fractions of all species
+    size_t addCase(double T, double P, const vector_fp& X);
+
+    //! Remove all cases and results
+    void clearCases();
+
+    //! Number of cases
+    size_t nCases() const {
+        return m_T0.size();
+    }
+
+    //! Integrate all cases
+    void run();
+
+    //! Results for case *i*. Available after calling run().
+    const EnsembleResult& result(size_t i) const;
+
+protected:
+    //! Objects and queue of cases owned by a single worker thread
+    struct Worker;
+
+    //! Create or update the worker objects before starting a run
+    void setupWorkers();
+
+    //! Process cases assigned to worker *n* and steal cases from other
+    //! workers, until no cases are left
+    void work(size_t n);
+
+    //! Get the next case to be handled by worker *n*, or `npos` if there are
+    //! no cases left
+    size_t nextCase(size_t n);
+
+    //! Integrate case *i* using the objects of worker *w*
+    void runCase(Worker& w, size_t i);
+
+    shared_ptr<Solution> m_sol;
+    std::string m_reactorType;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    size_t m_nThreads;
+
+    double m_rtol;
+    double m_atol;
+    size_t m_maxSteps;
+    double m_tEnd;
+    double m_deltaT;
+    size_t m_peakSpecies;
+    double m_peakDrop;
+
+    //! Initial temperatures of all cases
+    vector_fp m_T0;
+
+    //! Initial pressures of all cases
+    vector_fp m_P0;
+
+    //! Initial mole fractions of all cases
+    std::vector<vector_fp> m_X0;
+
+    std::vector<EnsembleResult> m_results;
+};
+
+}
+
+#endif
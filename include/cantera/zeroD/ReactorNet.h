@@ -8,11 +8,13 @@
 
 #include "Reactor.h"
 #include "cantera/numerics/FuncEval.h"
+#include "cantera/base/Array.h"
+
+#include <functional>
 
 namespace Cantera
 {
 
-class Array2D;
 class Integrator;
 
 //! A class representing a network of connected reactors.
@@ -57,6 +59,103 @@ public:
     //! sensitivity equations.
     void setSensitivityTolerances(double rtol, double atol);
 
+    //! Set the type of ODE integrator.
+    /*!
+     * Supported types are:
+     *  - `"CVODE"` (default): variable order BDF method implemented by the
+     *    CVODES integrator (see CVodesIntegrator). Required for sensitivity
+     *    analysis.
+     *  - `"ROS4"` and `"RODAS3"`: linearly implicit Rosenbrock methods (see
+     *    RosenbrockIntegrator). With the `"SPARSE"` linear solver type, the
+     *    Jacobians provided by Reactor::jacobian() are used. Since these may
+     *    neglect some terms, the `"DENSE"` linear solver type is more
+     *    efficient at tight tolerances. The `"GMRES"` linear solver type is
+     *    not supported.
+     *  - `"RKC"`: explicit Runge-Kutta-Chebyshev method for mildly stiff
+     *    problems (see RKCIntegrator). The linear solver type is ignored.
+     *
+     * The one-step methods can be more efficient than CVODES for integrating
+     * over short time intervals, as in operator-split reacting flow
+     * simulations, since they do not need to build up the integration history
+     * after each reinitialization.
+     */
+    void setIntegratorType(const std::string& type);
+
+    //! Type of ODE integrator
+    const std::string& integratorType() const {
+        return m_integratorType;
+    }
+
+    //! Set the type of linear solver used in the Newton iteration of the
+    //! integrator.
+    /*!
+     * Supported types are:
+     *  - `"DENSE"` (default): dense direct solver using a Jacobian computed by
+     *    finite differences (see evalDenseJacobian())
+     *  - `"SPARSE"`: sparse direct solver using the analytic Jacobians provided
+     *    by Reactor::jacobian(). Only available if all reactors implement
+     *    the Jacobian (see Reactor::hasJacobian()), e.g. IdealGasReactor and
+     *    IdealGasConstPressureReactor without surfaces.
+     *  - `"GMRES"`: iterative GMRES solver, preconditioned by a sparse
+     *    factorization of the Newton iteration matrix formed from the
+     *    Jacobians provided by Reactor::jacobian(). The quality of the
+     *    approximation can be adjusted using setDerivativeSettings() and
+     *    setPreconditionerType().
+     */
+    void setLinearSolverType(const std::string& linSolverType);
+
+    //! Type of linear solver used by the integrator
+    const std::string& linearSolverType() const {
+        return m_linearSolverType;
+    }
+
+    //! Set the settings used by all reactors to evaluate the derivatives of
+    //! reaction rates for the Jacobian, for example to skip the contributions
+    //! of third bodies or falloff.
+    //! @see Kinetics::setDerivativeSettings
+    void setDerivativeSettings(const AnyMap& settings);
+
+    //! Set the factorization used as the preconditioner by the `"GMRES"`
+    //! linear solver.
+    /*!
+     * Supported types are:
+     *  - `"LU"` (default): sparse LU factorization
+     *  - `"ILUT"`: incomplete LU factorization with threshold; see
+     *    setPreconditionerOptions(). Note that at most half of the entries of
+     *    dense rows, like the one corresponding to the energy equation, are
+     *    retained.
+     */
+    void setPreconditionerType(const std::string& type);
+
+    //! Type of factorization used as the preconditioner
+    const std::string& preconditionerType() const {
+        return m_precon_type;
+    }
+
+    //! Set the parameters of the incomplete LU factorization with threshold
+    //! used by the `"ILUT"` preconditioner type.
+    //! @param droptol  entries smaller than *droptol* relative to the norm of
+    //!     the current row are dropped. Default 1e-10.
+    //! @param fillfactor  maximum fill-in of each row of the factors relative
+    //!     to the average number of nonzeros per row of the matrix. Default 10.
+    void setPreconditionerOptions(double droptol, int fillfactor);
+
+    //! Enable or disable adaptive reduction of the reaction mechanisms of all
+    //! reactors with chemistry enabled.
+    /*!
+     * In addition to the settings described in Reactor::setAdaptiveChemistry(),
+     * the key `interval` sets the number of internal integrator steps between
+     * updates of the reduced mechanisms (default 10). Whenever the set of
+     * active reactions changes, the integrator is reinitialized. An empty map
+     * disables adaptive chemistry.
+     */
+    void setAdaptiveChemistry(const AnyMap& settings);
+
+    //! Returns `true` if adaptive chemistry is enabled
+    bool adaptiveChemistry() const {
+        return m_adaptiveInterval != 0;
+    }
+
     //! @}
 
     //! Current value of the simulation time.
@@ -86,7 +185,10 @@ public:
 
     /**
      * Advance the state of all reactors in time. Take as many internal
-     * timesteps as necessary to reach *time*.
+     * timesteps as necessary to reach *time*. If a terminal event (see
+     * addEvent()) occurs, integration stops at the time of the event, which
+     * is then returned by time(). States at the output times passed are
+     * recorded (see setOutputTimes()).
      * @param time Time to advance to (s).
      */
     void advance(doublereal time);
@@ -103,8 +205,100 @@ public:
     double advance(double time, bool applylimit);
 
     //! Advance the state of all reactors in time.
+    /*!
+     * Takes a single internal step of the integrator, which ends early at the
+     * time of an event.
+     */
     double step();
 
+    //! @name Events and output times
+    //!
+    //! Events are located by the root finding capabilities of the integrator,
+    //! so their times are determined to within the integration tolerances
+    //! rather than to the resolution of the internal time steps. States at
+    //! specified output times are interpolated by the integrator and recorded
+    //! while advancing, without the need to step the integrator to each
+    //! output time.
+    //! @{
+
+    //! Add an event which is detected during integration.
+    /*!
+     * @param r  Reactor in this network
+     * @param component  Name of the component of the state vector of *r*,
+     *     e.g. `"temperature"` or a species name (see Reactor::componentIndex)
+     * @param type  Type of event:
+     *   - `"threshold"` (default): the component crosses *value* in either
+     *     direction
+     *   - `"peak"`: the component has a local maximum, where its value is at
+     *     least *value*
+     *   - `"max-rate"`: the time derivative of the component has a local
+     *     maximum, where its value is at least *value*. The second derivative
+     *     of the component is approximated by a directional finite difference
+     *     of the governing equations.
+     * @param value  Threshold value, or the minimum value of a peak
+     * @param terminal  If `true`, advance() stops at the time of the event
+     * @returns the index of the event
+     *
+     * Since the derivatives used by the `"peak"` and `"max-rate"` types are
+     * affected by numerical noise when the solution approaches a steady
+     * state, *value* should be chosen to exclude insignificant maxima.
+     */
+    size_t addEvent(Reactor& r, const std::string& component,
+                    const std::string& type="threshold", double value=0.0,
+                    bool terminal=false);
+
+    //! Remove all events
+    void clearEvents();
+
+    //! Number of events
+    size_t nEvents() const {
+        return m_events.size();
+    }
+
+    //! Times at which event *i* occurred since the event was added or the
+    //! initial time was last set
+    const vector_fp& eventTimes(size_t i) const;
+
+    //! Index of the event which occurred last during the most recent call to
+    //! advance() or step(), or `npos` if no event occurred
+    size_t lastEvent() const {
+        return m_lastEvent;
+    }
+
+    //! Set the times at which the state is recorded by advance() and step().
+    /*!
+     * The states are stored in a buffer allocated by this method, which is
+     * accessible through outputStates(). Output times are recorded again after
+     * calling setInitialTime().
+     * @param times  Output times in ascending order, not earlier than the
+     *     current time [s]
+     */
+    void setOutputTimes(const vector_fp& times);
+
+    //! Times at which the state is recorded
+    const vector_fp& outputTimes() const {
+        return m_outputTimes;
+    }
+
+    //! Number of output times which have been reached
+    size_t nOutputs() const {
+        return m_nOutputs;
+    }
+
+    //! Recorded states, where column *j* contains the global state vector at
+    //! output time *j*. Only the first nOutputs() columns are valid.
+    const Array2D& outputStates() const {
+        return m_outputStates;
+    }
+
+    //! Set a function which is called with the time and the global state
+    //! vector whenever an output time is reached
+    void setOutputCallback(std::function<void(double, const double*)> callback) {
+        m_outputCallback = callback;
+    }
+
+    //! @}
+
     //! Add the reactor *r* to this reactor network.
     void addReactor(Reactor& r);
 
@@ -127,6 +321,25 @@ public:
         suppressErrors(!m_verbose);
     }
 
+    //! Update the reduced mechanisms of all reactors using adaptive chemistry
+    //! for the current state, and reinitialize the integrator if any of the
+    //! sets of active reactions changed. Called automatically by advance() and
+    //! step() at the interval set by setAdaptiveChemistry().
+    void updateAdaptiveChemistry();
+
+    //! Statistics on the reduced mechanisms used since adaptive chemistry was
+    //! enabled.
+    /*!
+     * The map contains the number of `updates` of the reduced mechanisms, the
+     * number of `switches`, where the set of active reactions changed and the
+     * integrator was reinitialized, the total number of threshold
+     * `refinements`, the number of updates using the `full-mechanism` since
+     * no reduced mechanism met the tolerance, the `max-error` of the reduced
+     * mechanisms, and the `mean-active-species` and `mean-active-reactions`
+     * per reactor and update.
+     */
+    AnyMap adaptiveChemistryStats() const;
+
     //! Return a reference to the integrator.
     Integrator& integrator() {
         return *m_integ;
@@ -165,6 +378,17 @@ public:
 
     //! Evaluate the Jacobian matrix for the reactor network.
     /*!
+     *  The Jacobian is evaluated using forward finite differences. State
+     *  variables of reactors which do not affect the governing equations of
+     *  any common reactor are perturbed simultaneously, which reduces the
+     *  number of evaluations of the governing equations to
+     *  nJacobianColors(). Reactors are considered to be coupled if they are
+     *  connected by a wall or a flow device, or through the master flow
+     *  device of a PressureController. Elements of the Jacobian outside of
+     *  this sparsity pattern are set to zero.
+     *
+     *  The same approximation is provided to the integrators by
+     *  evalDenseJacobian() if the `"DENSE"` linear solver type is selected.
      *  @param[in] t Time at which to evaluate the Jacobian
      *  @param[in] y Global state vector at time *t*
      *  @param[out] ydot Time derivative of the state vector evaluated at *t*.
@@ -174,6 +398,50 @@ public:
     void evalJacobian(doublereal t, doublereal* y,
                       doublereal* ydot, doublereal* p, Array2D* j);
 
+    //! Number of evaluations of the governing equations used by
+    //! evalJacobian(), in addition to the evaluation at the unperturbed state.
+    size_t nJacobianColors();
+
+    //! Evaluate the dense Jacobian matrix for the reactor network.
+    /*!
+     *  Uses the same finite difference approximation as evalJacobian(), where
+     *  *ydot* is the time derivative at the unperturbed state. Used by the
+     *  integrator if the `"DENSE"` linear solver type is selected.
+     *  @param[in] t Time at which to evaluate the Jacobian
+     *  @param[in] y Global state vector at time *t*
+     *  @param[in] ydot Time derivative of the state vector evaluated at *t*
+     *  @param[out] jac Jacobian matrix in column-major order, size neq() by
+     *      neq()
+     */
+    virtual void evalDenseJacobian(double t, double* y, const double* ydot,
+                                   double* jac);
+
+    //! Evaluate the sparse Jacobian matrix for the reactor network.
+    /*!
+     *  The Jacobian is assembled from the contributions of the individual
+     *  reactors (see Reactor::jacobian()). Coupling between reactors through
+     *  walls and flow devices is neglected. Used by the integrator if the
+     *  `"SPARSE"` linear solver type is selected.
+     *  @param[in] t Time at which to evaluate the Jacobian
+     *  @param[in] y Global state vector at time *t*
+     *  @param[out] jac Jacobian matrix, size neq() by neq().
+     */
+    virtual void evalSparseJacobian(double t, double* y,
+                                    Eigen::SparseMatrix<double>& jac);
+
+    //! Set up the preconditioner for the `"GMRES"` linear solver.
+    /*!
+     *  Evaluates the sparse Jacobian *J* using evalSparseJacobian() and
+     *  computes a complete or incomplete LU factorization of
+     *  \f$ I - \gamma J \f$, depending on preconditionerType(). If *jacOk*
+     *  is `true`, the Jacobian from the previous call is reused and only the
+     *  factorization is updated for the new value of *gamma*.
+     */
+    virtual bool preconditionerSetup(double t, double* y, double gamma,
+                                     bool jacOk=false);
+
+    virtual void preconditionerSolve(double* rhs, double* output);
+
     // overloaded methods of class FuncEval
     virtual size_t neq() {
         return m_nv;
@@ -190,6 +458,12 @@ public:
         return m_sens_params.size();
     }
 
+    virtual size_t nRootFunctions() {
+        return m_events.size();
+    }
+
+    virtual void evalRootFunctions(double t, double* y, double* gout);
+
     //! Return the index corresponding to the component named *component* in the
     //! reactor with index *reactor* in the global state vector for the
     //! reactor network.
@@ -265,6 +539,36 @@ protected:
     //! and deliberately not exposed in external interfaces.
     virtual int lastOrder();
 
+    //! Determine the coupling between reactors and group reactors whose state
+    //! variables can be perturbed simultaneously by evalJacobian()
+    void updateJacobianColoring();
+
+    //! Compute the columns of the Jacobian for all colors determined by
+    //! updateJacobianColoring(), given the unperturbed time derivative
+    //! *ydot*. Elements of *jac* (column-major, size neq() by neq()) outside
+    //! of the sparsity pattern are not modified.
+    void evalColoredJacobian(double t, double* y, const double* ydot,
+                             double* p, double* jac);
+
+    //! Record the events at the root found by the integrator. Returns `true`
+    //! if a terminal event occurred.
+    bool recordEvents();
+
+    //! Record the states at the output times up to *tmax*, which must be
+    //! within the last step of the integrator
+    void recordOutputs(double tmax);
+
+    //! An event detected by the integrator; see addEvent()
+    struct Event {
+        Reactor* reactor;
+        std::string component;
+        std::string type;
+        double value;
+        bool terminal;
+        size_t index; //!< Index of the component in the global state vector
+        vector_fp times; //!< Times at which the event occurred
+    };
+
     std::vector<Reactor*> m_reactors;
     std::unique_ptr<Integrator> m_integ;
     doublereal m_time;
@@ -285,6 +589,50 @@ protected:
     int m_maxErrTestFails;
     bool m_verbose;
 
+    //! Type of ODE integrator
+    std::string m_integratorType;
+
+    //! Type of linear solver used by the integrator
+    std::string m_linearSolverType;
+
+    //! Work array used to assemble the sparse Jacobian
+    SparseTriplets m_jac_trips;
+
+    //! Indices of the reactors whose state affects the governing equations of
+    //! each reactor, including the reactor itself
+    std::vector<std::vector<size_t>> m_coupled;
+
+    //! Groups of reactors which do not affect the governing equations of any
+    //! common reactor, and can be perturbed simultaneously by evalJacobian()
+    std::vector<std::vector<size_t>> m_colorGroups;
+
+    //! Number of evaluations needed to determine the Jacobian by evalJacobian()
+    size_t m_nColors;
+
+    //! Perturbation of the current state variable of each reactor
+    vector_fp m_jac_dy;
+
+    //! Unperturbed value of the current state variable of each reactor
+    vector_fp m_jac_ysave;
+
+    //! Jacobian used by the last call to preconditionerSetup()
+    Eigen::SparseMatrix<double> m_precon_jac;
+
+    //! Newton iteration matrix used as the preconditioner
+    Eigen::SparseMatrix<double> m_precon_matrix;
+
+    //! Type of factorization used as the preconditioner
+    std::string m_precon_type;
+
+    //! Sparse LU factorization of #m_precon_matrix
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> m_splu;
+
+    //! Incomplete LU factorization of #m_precon_matrix
+    Eigen::IncompleteLUT<double> m_ilut;
+
+    double m_ilut_droptol; //!< Drop tolerance of the preconditioner ILUT
+    int m_ilut_fillfactor; //!< Fill factor of the preconditioner ILUT
+
     //! Names corresponding to each sensitivity parameter
     std::vector<std::string> m_paramNames;
 
@@ -295,6 +643,35 @@ protected:
     //! "left hand side" of each governing equation
     vector_fp m_LHS;
     vector_fp m_RHS;
+    //! Time reached by the integrator, which may be beyond #m_time
+    double m_tn;
+
+    std::vector<Event> m_events;
+    size_t m_lastEvent; //!< Index of the last event; see lastEvent()
+    std::vector<int> m_rootInfo; //!< Root directions reported by the integrator
+    vector_fp m_root_ydot; //!< Work array: time derivative for root functions
+    vector_fp m_root_y; //!< Work array: perturbed state for root functions
+    vector_fp m_root_ydot2; //!< Work array: perturbed time derivative
+
+    vector_fp m_outputTimes; //!< Times at which the state is recorded
+    size_t m_nOutputs; //!< Number of output times reached
+    Array2D m_outputStates; //!< Recorded states; see outputStates()
+    std::function<void(double, const double*)> m_outputCallback;
+
+    //! @name Adaptive chemistry
+    //! @{
+    size_t m_adaptiveInterval; //!< Integrator steps between updates; 0 if disabled
+    size_t m_adaptiveSteps; //!< Integrator steps since the last update
+    size_t m_adaptiveUpdates; //!< Number of updates of the reduced mechanisms
+    size_t m_adaptiveSwitches; //!< Number of integrator reinitializations
+    size_t m_adaptiveRefinements; //!< Total number of threshold reductions
+    size_t m_adaptiveFull; //!< Number of updates using the full mechanism
+    double m_adaptiveMaxError; //!< Maximum error of the reduced mechanisms
+    double m_adaptiveSpecies; //!< Sum of the numbers of active species
+    double m_adaptiveReactions; //!< Sum of the numbers of active reactions
+    size_t m_adaptiveSamples; //!< Number of reactor updates
+    //! @}
+
     bool m_checked_eval_deprecation; //!< @todo Remove after Cantera 2.6
     std::vector<bool> m_have_deprecated_eval; //!< @todo Remove after Cantera 2.6
 };
@@ -90,6 +90,11 @@ public:
         m_master = master;
     }
 
+    //! Get the master flow device, or a null pointer if it has not been set
+    FlowDevice* master() const {
+        return m_master;
+    }
+
     virtual void setTimeFunction(Func1* g) {
         throw NotImplementedError("PressureController::setTimeFunction");
     }
@@ -8,6 +8,8 @@
 
 // reactor network
 #include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/ISATCache.h"
 
 // reactors
 #include "cantera/zeroD/Reservoir.h"
@@ -0,0 +1,96 @@
+/*!
+ * @file adaptive_chemistry.cpp
+ *
+ * Benchmark for adaptive chemistry
+ *
+ * This program computes the ignition delays of methane/air mixtures at
+ * constant pressure for a range of initial temperatures, once with the full
+ * GRI-Mech 3.0 mechanism and once using adaptive chemistry, where the reactions
+ * which are relevant for a set of target species are periodically identified
+ * using the DRGEP method and all other reactions are deactivated. The wall
+ * clock times, the ignition delays and statistics on the size of the reduced
+ * mechanisms are printed for each case.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include "cantera/zerodim.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+using namespace Cantera;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Result {
+    double tIgn; //!< ignition delay [s]
+    double time; //!< wall clock time [s]
+    AnyMap stats; //!< adaptive chemistry statistics
+};
+
+Result ignite(double T0, const AnyMap& settings)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    sol->thermo()->setState_TPX(T0, OneAtm, "CH4:1.0, O2:2.0, N2:7.52");
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    net.setTolerances(1e-8, 1e-15);
+    net.setAdaptiveChemistry(settings);
+
+    Result res{0.0, 0.0, AnyMap()};
+    auto t0 = Clock::now();
+    while (net.time() < 1.0) {
+        net.step();
+        if (res.tIgn == 0 && reactor.temperature() > T0 + 400) {
+            res.tIgn = net.time();
+        }
+    }
+    res.time = std::chrono::duration<double>(Clock::now() - t0).count();
+    if (net.adaptiveChemistry()) {
+        res.stats = net.adaptiveChemistryStats();
+    }
+    return res;
+}
+
+int main()
+{
+    try {
+        AnyMap settings = AnyMap::fromYamlString(
+            "{targets: [CH4, O2, CO2, H2O, CO, N2], method: DRGEP,"
+            " threshold: 0.01, tolerance: 0.01, interval: 10}");
+        std::cout << std::setw(8) << "T0 [K]"
+                  << std::setw(14) << "tIgn full"
+                  << std::setw(14) << "tIgn adapt"
+                  << std::setw(12) << "time full"
+                  << std::setw(12) << "time adapt"
+                  << std::setw(10) << "speedup"
+                  << std::setw(10) << "species"
+                  << std::setw(11) << "reactions"
+                  << std::setw(10) << "switches" << std::endl;
+        for (double T0 : {1000.0, 1200.0, 1400.0, 1600.0}) {
+            Result full = ignite(T0, AnyMap());
+            Result adaptive = ignite(T0, settings);
+            std::cout << std::setw(8) << T0
+                      << std::setw(14) << std::setprecision(5) << full.tIgn
+                      << std::setw(14) << adaptive.tIgn
+                      << std::setw(12) << std::setprecision(3) << full.time
+                      << std::setw(12) << adaptive.time
+                      << std::setw(10) << full.time / adaptive.time
+                      << std::setw(10) << std::setprecision(4)
+                      << adaptive.stats["mean-active-species"].asDouble()
+                      << std::setw(11)
+                      << adaptive.stats["mean-active-reactions"].asDouble()
+                      << std::setw(10) << adaptive.stats["switches"].asInt()
+                      << std::endl;
+        }
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*!
+ * @file cubic_eos_benchmark.cpp
+ *
+ * Benchmark for the cubic equations of state
+ *
+ * High-pressure CFD simulations evaluate the equation of state of the mixture
+ * in every cell at every time step. This program measures the time per state
+ * needed to set the state of Redlich-Kwong and Peng-Robinson phases and to
+ * evaluate the properties typically required by the flow solver, for a
+ * 100-species n-dodecane mechanism at supercritical conditions. The ideal gas
+ * model with the same species is included for comparison.
+ *
+ * The Peng-Robinson phase is constructed from the critical properties
+ * implied by the Redlich-Kwong coefficients of each species, using an
+ * acentric factor of 0.2 for all species.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/Species.h"
+
+using namespace Cantera;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+//! Create a Peng-Robinson phase with the species of the Redlich-Kwong phase *rk*
+shared_ptr<ThermoPhase> makePengRobinson(ThermoPhase& rk)
+{
+    shared_ptr<ThermoPhase> pr(newThermoPhase("Peng-Robinson"));
+    for (size_t k = 0; k < rk.nSpecies(); k++) {
+        auto src = rk.species(k);
+        auto sp = std::make_shared<Species>(src->name, src->composition,
+                                            src->charge, src->size);
+        sp->thermo = src->thermo;
+        sp->input = src->input;
+        auto& eos = sp->input["equation-of-state"].getMapWhere("model",
+                                                               "Redlich-Kwong");
+        double a = eos.units().convert(eos["a"].asVector<AnyValue>()[0],
+                                       "Pa*m^6/kmol^2*K^0.5");
+        double b = eos.convert("b", "m^3/kmol");
+        // critical properties consistent with the Redlich-Kwong coefficients
+        double Tc = std::pow(0.08664 * a / (0.42748 * GasConstant * b), 2.0 / 3.0);
+        double Pc = 0.08664 * GasConstant * Tc / b;
+        AnyMap crit;
+        crit["critical-temperature"] = Tc;
+        crit["critical-pressure"] = fmt::format("{:.17g} Pa", Pc);
+        crit["acentric-factor"] = 0.2;
+        sp->input.erase("equation-of-state");
+        sp->input["critical-parameters"] = std::move(crit);
+        pr->addSpecies(sp);
+    }
+    pr->initThermo();
+    return pr;
+}
+
+void benchmark(const std::string& label, ThermoPhase& phase,
+               const std::vector<vector_fp>& X, const vector_fp& T,
+               const vector_fp& P, double refTime=0.0)
+{
+    size_t nStates = T.size();
+    size_t nsp = phase.nSpecies();
+    vector_fp mu(nsp), hbar(nsp);
+    double hsum = 0.0;
+    auto perState = [nStates](Clock::time_point t0, Clock::time_point t1) {
+        return std::chrono::duration<double, std::micro>(t1 - t0).count() / nStates;
+    };
+
+    auto t0 = Clock::now();
+    for (size_t m = 0; m < nStates; m++) {
+        phase.setState_TPX(T[m], P[m], X[m].data());
+    }
+    auto t1 = Clock::now();
+    for (size_t m = 0; m < nStates; m++) {
+        phase.setState_TPX(T[m], P[m], X[m].data());
+        hsum += phase.enthalpy_mass() + phase.cp_mass() + phase.density();
+    }
+    auto t2 = Clock::now();
+    for (size_t m = 0; m < nStates; m++) {
+        phase.setState_TPX(T[m], P[m], X[m].data());
+        phase.getChemPotentials(mu.data());
+        phase.getPartialMolarEnthalpies(hbar.data());
+        hsum += mu[0] + hbar[0];
+    }
+    auto t3 = Clock::now();
+
+    // batch evaluation of the same states, with mass fractions stored by species
+    vector_fp Y(nsp * nStates), y(nsp), h(nStates), cp(nStates), rho(nStates);
+    for (size_t m = 0; m < nStates; m++) {
+        phase.setState_TPX(T[m], P[m], X[m].data());
+        phase.getMassFractions(y.data());
+        for (size_t k = 0; k < nsp; k++) {
+            Y[k * nStates + m] = y[k];
+        }
+    }
+    auto t4 = Clock::now();
+    phase.getPropertiesBatch(nStates, T.data(), P.data(), Y.data(), h.data(),
+                             cp.data(), rho.data(), nullptr);
+    auto t5 = Clock::now();
+    hsum += h[0];
+
+    double tSet = perState(t0, t1);
+    double tProps = perState(t1, t2) - tSet;
+    double tPartial = perState(t2, t3) - tSet;
+    double tBatch = perState(t4, t5);
+    std::cout << std::setw(14) << label << std::fixed << std::setprecision(2)
+        << std::setw(10) << tSet << std::setw(10) << tProps
+        << std::setw(10) << tPartial << std::setw(10) << tBatch;
+    if (refTime > 0) {
+        std::cout << std::setw(10) << (tSet + tProps) / refTime;
+    }
+    std::cout << std::endl;
+    if (std::isnan(hsum)) {
+        std::cout << "invalid result" << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    try {
+        size_t nStates = (argc > 1) ? std::stoul(argv[1]) : 2000;
+        auto rk = newSolution("nDodecane_Reitz.yaml", "nDodecane_RK", "None");
+        auto ig = newSolution("nDodecane_Reitz.yaml", "nDodecane_IG", "None");
+        auto pr = makePengRobinson(*rk->thermo());
+        size_t nsp = ig->thermo()->nSpecies();
+
+        // Supercritical mixtures of fuel, air and combustion products
+        std::vector<vector_fp> X(nStates, vector_fp(nsp));
+        vector_fp T(nStates), P(nStates);
+        ThermoPhase& gas = *ig->thermo();
+        for (size_t m = 0; m < nStates; m++) {
+            double f = (m + 0.5) / nStates;
+            T[m] = 800.0 + 1200.0 * f;
+            P[m] = 6.0e6 * (1.0 + f);
+            gas.setState_TPX(T[m], P[m], "c12h26:1, o2:18.5, n2:69.6");
+            gas.getMoleFractions(X[m].data());
+            for (size_t k = 0; k < nsp; k++) {
+                // small amounts of all other species
+                X[m][k] += 1e-4 * f;
+            }
+        }
+
+        std::cout << "Time per state [us] for " << nsp << " species and "
+                  << nStates << " states\n"
+                  << std::setw(14) << "model" << std::setw(10) << "setState"
+                  << std::setw(10) << "h,cp,rho" << std::setw(10) << "mu,hbar"
+                  << std::setw(10) << "batch" << std::setw(10) << "vs. IG"
+                  << std::endl;
+        // reference time for setting the state and evaluating h, cp and rho
+        auto t0 = Clock::now();
+        double hsum = 0.0;
+        for (size_t m = 0; m < nStates; m++) {
+            gas.setState_TPX(T[m], P[m], X[m].data());
+            hsum += gas.enthalpy_mass() + gas.cp_mass() + gas.density();
+        }
+        auto t1 = Clock::now();
+        double tIG = std::chrono::duration<double, std::micro>(t1 - t0).count()
+                     / nStates;
+        if (std::isnan(hsum)) {
+            std::cout << "invalid result" << std::endl;
+        }
+
+        benchmark("ideal gas", gas, X, T, P, tIG);
+        benchmark("Redlich-Kwong", *rk->thermo(), X, T, P, tIG);
+        benchmark("Peng-Robinson", *pr, X, T, P, tIG);
+    } catch (std::exception& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*!
+ * @file import_benchmark.cpp
+ *
+ * Benchmark for importing large reaction mechanisms
+ *
+ * This benchmark generates a synthetic mechanism with 30000 reactions among
+ * 100 isomers and measures the time required for parsing the YAML input file,
+ * for creating the Solution object (which includes creating the Reaction
+ * objects, adding them to the Kinetics object, and checking for duplicate
+ * reactions), and for the duplicate reaction check by itself.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include "cantera/base/Solution.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/kinetics/Kinetics.h"
+
+using namespace Cantera;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double seconds(Clock::time_point a, Clock::time_point b)
+{
+    return std::chrono::duration<double>(b - a).count();
+}
+
+//! Write a mechanism with reactions of the form `Ia + Ib <=> Ic + Id` between
+//! `nSpecies` species with identical composition and thermo data
+void writeMechanism(const std::string& filename, size_t nSpecies, size_t nReactions)
+{
+    std::ofstream out(filename);
+    out << "units: {length: cm, quantity: mol, activation-energy: cal/mol}\n"
+        << "phases:\n"
+        << "- name: gas\n"
+        << "  thermo: ideal-gas\n"
+        << "  elements: [C, H]\n"
+        << "  species: all\n"
+        << "  kinetics: gas\n"
+        << "  state: {T: 1000 K, P: 1 atm}\n"
+        << "species:\n";
+    for (size_t k = 0; k < nSpecies; k++) {
+        out << "- name: I" << k << "\n"
+            << "  composition: {C: 1, H: 4}\n"
+            << "  thermo:\n"
+            << "    model: NASA7\n"
+            << "    temperature-ranges: [200.0, 1000.0, 3500.0]\n"
+            << "    data:\n"
+            << "    - [5.14987613, -0.0136709788, 4.91800599e-05, -4.84743026e-08,"
+               " 1.66693956e-11, -1.02466476e+04, -4.64130376]\n"
+            << "    - [0.074851495, 0.0133909467, -5.73285809e-06, 1.22292535e-09,"
+               " -1.0181523e-13, -9468.34459, 18.437318]\n";
+    }
+
+    // Each pair of distinct species is used as the reactants of reactions
+    // with all pairs with higher indices as the products, so no two reactions
+    // are duplicates of one another
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for (size_t a = 0; a < nSpecies; a++) {
+        for (size_t b = a + 1; b < nSpecies; b++) {
+            pairs.emplace_back(a, b);
+        }
+    }
+    out << "reactions:\n";
+    size_t n = 0;
+    for (size_t p = 0; p < pairs.size() && n < nReactions; p++) {
+        for (size_t q = p + 1; q < pairs.size() && n < nReactions; q++, n++) {
+            out << "- equation: I" << pairs[p].first << " + I" << pairs[p].second
+                << " <=> I" << pairs[q].first << " + I" << pairs[q].second << "\n"
+                << "  rate-constant: {A: " << 1.0e10 * (1 + n % 17)
+                << ", b: " << 0.1 * (n % 5) << ", Ea: " << 100.0 * (n % 23)
+                << "}\n";
+        }
+    }
+}
+
+int main()
+{
+    try {
+        std::string filename = "synthetic-30k.yaml";
+        writeMechanism(filename, 100, 30000);
+        std::cout << "Hardware threads: " << std::thread::hardware_concurrency()
+            << "\n" << std::setprecision(4);
+
+        auto t0 = Clock::now();
+        AnyMap::fromYamlFile(filename); // result is cached for newSolution
+        auto t1 = Clock::now();
+        auto soln = newSolution(filename, "gas", "None");
+        auto t2 = Clock::now();
+        auto kin = soln->kinetics();
+        kin->checkDuplicates();
+        auto t3 = Clock::now();
+
+        std::cout << "Synthetic mechanism (" << kin->nTotalSpecies()
+            << " species, " << kin->nReactions() << " reactions)\n"
+            << "  YAML parsing:     " << std::setw(8) << seconds(t0, t1) << " s\n"
+            << "  Solution setup:   " << std::setw(8) << seconds(t1, t2) << " s\n"
+            << "  duplicate check:  " << std::setw(8) << seconds(t2, t3) << " s\n";
+
+        t0 = Clock::now();
+        auto gri30 = newSolution("gri30.yaml", "gri30", "None");
+        t1 = Clock::now();
+        std::cout << "GRI 3.0 (" << gri30->kinetics()->nReactions()
+            << " reactions)\n"
+            << "  total load time:  " << std::setw(8) << seconds(t0, t1) << " s\n";
+    } catch (std::exception& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*!
+ * @file integrator_benchmark.cpp
+ *
+ * Benchmark of ODE integrators for operator-split chemistry
+ *
+ * In operator-split reacting flow simulations, the chemistry of each cell is
+ * integrated over a short time step starting from a new initial state. This
+ * program measures the wall clock time per cell needed by each of the
+ * integrators available to ReactorNet for this task, for hydrogen and methane
+ * mechanisms. The cell states are sampled from an ignition trajectory, so
+ * they include unburned, igniting and burned mixtures. The maximum
+ * temperature difference from a reference solution computed with tight
+ * tolerances is printed as a measure of accuracy.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include "cantera/zerodim.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+using namespace Cantera;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Cell {
+    double T;
+    vector_fp Y;
+};
+
+//! Sample cell states from the ignition of a constant pressure reactor
+std::vector<Cell> sampleCells(const std::string& mech, const std::string& X0,
+                              double T0, size_t nCells)
+{
+    auto sol = newSolution(mech, "", "None");
+    auto gas = sol->thermo();
+    gas->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+
+    // find the ignition delay time
+    double tIgn = 0.0;
+    while (gas->temperature() < T0 + 400) {
+        tIgn = net.step();
+    }
+
+    std::vector<Cell> cells;
+    gas->setState_TPX(T0, OneAtm, X0);
+    reactor.syncState();
+    net.setInitialTime(0.0);
+    for (size_t i = 0; i < nCells; i++) {
+        net.advance(2.0 * tIgn * (i + 0.5) / nCells);
+        cells.push_back({gas->temperature(), vector_fp(gas->nSpecies())});
+        gas->getMassFractions(cells.back().Y.data());
+    }
+    return cells;
+}
+
+//! Advance all cells by *dt* and return the wall clock time per cell [s].
+//! The final temperatures are stored in *T*.
+double advanceCells(shared_ptr<Solution> sol, const std::vector<Cell>& cells,
+                    double dt, const std::string& integrator,
+                    const std::string& linearSolver, double rtol, double atol,
+                    vector_fp& T)
+{
+    auto gas = sol->thermo();
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    net.setIntegratorType(integrator);
+    net.setLinearSolverType(linearSolver);
+    net.setTolerances(rtol, atol);
+    T.resize(cells.size());
+
+    auto t0 = Clock::now();
+    for (size_t i = 0; i < cells.size(); i++) {
+        gas->setState_TPY(cells[i].T, OneAtm, cells[i].Y.data());
+        reactor.syncState();
+        net.setInitialTime(0.0);
+        net.advance(dt);
+        T[i] = gas->temperature();
+    }
+    auto t1 = Clock::now();
+    return std::chrono::duration<double>(t1 - t0).count() / cells.size();
+}
+
+void benchmark(const std::string& mech, const std::string& X0, double T0)
+{
+    const size_t nCells = 50;
+    const double rtol = 1e-6;
+    const double atol = 1e-12;
+    std::vector<std::pair<std::string, std::string>> configs = {
+        {"CVODE", "DENSE"}, {"CVODE", "SPARSE"}, {"ROS4", "DENSE"},
+        {"ROS4", "SPARSE"}, {"RODAS3", "DENSE"}, {"RODAS3", "SPARSE"},
+        {"RKC", "DENSE"}};
+
+    auto cells = sampleCells(mech, X0, T0, nCells);
+    auto sol = newSolution(mech, "", "None");
+    std::cout << "\n" << mech << " (" << sol->thermo()->nSpecies()
+              << " species), " << nCells << " cells\n";
+    std::cout << std::setw(8) << "dt [s]" << std::setw(12) << "integrator"
+              << std::setw(10) << "linsolver" << std::setw(16)
+              << "time/cell [us]" << std::setw(14) << "max |dT| [K]" << "\n";
+
+    for (double dt : {1e-7, 1e-6, 1e-5}) {
+        vector_fp Tref, T;
+        advanceCells(sol, cells, dt, "CVODE", "DENSE", 1e-10, 1e-18, Tref);
+        for (const auto& config : configs) {
+            std::cout << std::setw(8) << dt << std::setw(12) << config.first
+                      << std::setw(10) << config.second;
+            try {
+                double tcell = advanceCells(sol, cells, dt, config.first,
+                                            config.second, rtol, atol, T);
+                double dTmax = 0.0;
+                for (size_t i = 0; i < nCells; i++) {
+                    dTmax = std::max(dTmax, std::abs(T[i] - Tref[i]));
+                }
+                std::cout << std::setw(16) << std::fixed << std::setprecision(1)
+                          << tcell * 1e6 << std::setw(14) << std::scientific
+                          << std::setprecision(2) << dTmax << "\n";
+            } catch (CanteraError& err) {
+                std::cout << std::setw(16) << "failed" << "\n";
+            }
+            std::cout.unsetf(std::ios_base::floatfield);
+            std::cout << std::setprecision(6);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    try {
+        benchmark("h2o2.yaml", "H2:2.0, O2:1.0, N2:3.76", 1100.0);
+        benchmark("gri30.yaml", "CH4:1.0, O2:2.0, N2:7.52", 1400.0);
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*!
+ * @file isat_pasr.cpp
+ *
+ * Partially stirred reactor using in situ adaptive tabulation
+ *
+ * This program simulates a partially stirred reactor (PaSR) burning a
+ * hydrogen/air mixture, which is represented by an ensemble of particles.
+ * In each time step, a fraction of the particles is replaced by fresh inflow,
+ * pairs of particles are mixed (Curl's model), and the composition of each
+ * particle is advanced by the reaction mapping. This operator-split structure
+ * is typical of transported PDF and LES chemistry. The reaction step is
+ * computed once by direct integration and once using ISATCache, and the wall
+ * clock times for the reaction step, the table statistics and the mean
+ * temperatures are printed.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include "cantera/zerodim.h"
+#include "cantera/thermo/IdealGasPhase.h"
+
+using namespace Cantera;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Particle {
+    double h; //!< specific enthalpy [J/kg]
+    vector_fp Y; //!< mass fractions
+};
+
+//! Run the PaSR and return the time spent in the reaction step
+double pasr(bool useISAT, double& Tmean, AnyMap& stats)
+{
+    const size_t nParticles = 100;
+    const size_t nSteps = 200;
+    const double dt = 1e-5;
+    const double P = OneAtm;
+
+    auto sol = newSolution("h2o2.yaml");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+
+    // fresh inflow and initial (burnt) particle states
+    gas->setState_TPX(900, P, "H2:2.0, O2:1.0, AR:4.0");
+    Particle inflow{gas->enthalpy_mass(), vector_fp(nsp)};
+    gas->getMassFractions(inflow.Y.data());
+    gas->equilibrate("HP");
+    Particle burnt{gas->enthalpy_mass(), vector_fp(nsp)};
+    gas->getMassFractions(burnt.Y.data());
+    std::vector<Particle> particles(nParticles, burnt);
+
+    std::unique_ptr<ISATCache> isat;
+    std::unique_ptr<IdealGasConstPressureReactor> reactor;
+    std::unique_ptr<ReactorNet> net;
+    if (useISAT) {
+        isat.reset(new ISATCache(sol, dt, 1e-4));
+    } else {
+        reactor.reset(new IdealGasConstPressureReactor());
+        reactor->insert(sol);
+        net.reset(new ReactorNet());
+        net->addReactor(*reactor);
+    }
+
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<size_t> pick(0, nParticles - 1);
+    double reactionTime = 0.0;
+    for (size_t n = 0; n < nSteps; n++) {
+        // inflow
+        for (size_t i = 0; i < nParticles / 50; i++) {
+            particles[pick(rng)] = inflow;
+        }
+        // mixing
+        for (size_t i = 0; i < nParticles / 10; i++) {
+            Particle& p = particles[pick(rng)];
+            Particle& q = particles[pick(rng)];
+            p.h = q.h = 0.5 * (p.h + q.h);
+            for (size_t k = 0; k < nsp; k++) {
+                p.Y[k] = q.Y[k] = 0.5 * (p.Y[k] + q.Y[k]);
+            }
+        }
+        // reaction
+        auto t0 = Clock::now();
+        for (auto& p : particles) {
+            gas->setMassFractions(p.Y.data());
+            gas->setState_HP(p.h, P);
+            if (useISAT) {
+                isat->advance();
+            } else {
+                reactor->syncState();
+                net->setInitialTime(0.0);
+                net->advance(dt);
+            }
+            gas->getMassFractions(p.Y.data());
+        }
+        reactionTime += std::chrono::duration<double>(Clock::now() - t0).count();
+    }
+
+    Tmean = 0.0;
+    for (auto& p : particles) {
+        gas->setMassFractions(p.Y.data());
+        gas->setState_HP(p.h, P);
+        Tmean += gas->temperature() / nParticles;
+    }
+    if (useISAT) {
+        stats = isat->stats();
+    }
+    return reactionTime;
+}
+
+int main()
+{
+    try {
+        double Tdirect, Tisat;
+        AnyMap stats;
+        double tDirect = pasr(false, Tdirect, stats);
+        double tIsat = pasr(true, Tisat, stats);
+        std::cout << std::setprecision(4)
+                  << "Direct integration: " << tDirect << " s, mean T = "
+                  << Tdirect << " K" << std::endl
+                  << "ISAT:               " << tIsat << " s, mean T = "
+                  << Tisat << " K" << std::endl
+                  << "Speedup: " << tDirect / tIsat << std::endl
+                  << "ISAT statistics:" << std::endl << stats.toYamlString();
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -5,6 +5,9 @@
  *
  * This example shows how to use OpenMP to run multiple reactor network
  * calculations in parallel by using separate Cantera objects for each thread.
+ * The mechanism is imported only once; the objects used by the other threads
+ * are created using Solution::clone(), which shares the species and reaction
+ * definitions between all threads.
  */
 
 // This file is part of Cantera. See License.txt in the top-level directory or
@@ -33,8 +36,9 @@ void run()
 
     // Create and link the Cantera objects for each thread. This step should be
     // done in serial
+    auto gri30 = newSolution("gri30.yaml", "gri30", "None");
     for (int i = 0; i < nThreads; i++) {
-        auto sol = newSolution("gri30.yaml", "gri30", "None");
+        auto sol = (i == 0) ? gri30 : gri30->clone();
         sols.emplace_back(sol);
         reactors.emplace_back(new IdealGasConstPressureReactor());
         nets.emplace_back(new ReactorNet());
@@ -73,10 +77,12 @@ void run()
         net.setInitialTime(0.0);
 
         // Integrate until we satisfy a crude estimate of the ignition delay
-        // time: time for T to increase by 500 K
-        while (reactor.temperature() < T0[i] + 500) {
-            net.step();
-        }
+        // time: time for T to increase by 500 K. The time where this
+        // temperature is reached is located by the integrator, which stops
+        // there since the event is terminal.
+        net.clearEvents();
+        net.addEvent(reactor, "temperature", "threshold", T0[i] + 500, true);
+        net.advance(10.0);
 
         // Save the ignition delay time for this temperature
         ignition_time[i] = net.time();
@@ -0,0 +1,120 @@
+/*!
+ * @file state_benchmark.cpp
+ *
+ * Benchmark for saving and restoring the thermodynamic state of phases
+ *
+ * This benchmark measures the time and the number of heap allocations per call
+ * of Phase::saveState() and Phase::restoreState(), which are called for every
+ * evaluation of the governing equations of reactors in a ReactorNet.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <new>
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+using namespace Cantera;
+
+// Count all heap allocations made by the program
+static std::atomic<size_t> n_allocations(0);
+
+void* operator new(std::size_t size)
+{
+    n_allocations++;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+//! Time calls to saveState and restoreState for a phase
+void benchmark(const std::string& label, ThermoPhase& phase, size_t loops=100000)
+{
+    vector_fp state;
+    phase.saveState(state);
+    vector_fp perturbed = state;
+
+    size_t allocs0 = n_allocations;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < loops; i++) {
+        phase.saveState(state);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    size_t allocs1 = n_allocations;
+    phase.restoreState(state);
+    int stateNum = phase.stateMFNumber();
+    for (size_t i = 0; i < loops; i++) {
+        phase.restoreState(state);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    size_t allocs2 = n_allocations;
+    bool unchanged = (stateNum == phase.stateMFNumber());
+
+    // alternate between two compositions to bypass the unchanged-state path
+    if (state.size() > 2) {
+        auto kmax = std::max_element(state.begin() + 2, state.end());
+        perturbed[kmax - state.begin()] *= 0.5;
+    }
+    for (size_t i = 0; i < loops; i++) {
+        phase.restoreState((i % 2) ? state : perturbed);
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    size_t allocs3 = n_allocations;
+    phase.restoreState(state);
+
+    auto perCall = [loops](std::chrono::high_resolution_clock::time_point a,
+                           std::chrono::high_resolution_clock::time_point b) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count()
+            / static_cast<double>(loops);
+    };
+    std::cout << label << " (" << state.size() << " state variables)\n"
+        << std::setprecision(4)
+        << "  saveState:                " << std::setw(8) << perCall(t0, t1)
+        << " ns/call, " << (allocs1 - allocs0) / static_cast<double>(loops)
+        << " allocations/call\n"
+        << "  restoreState (unchanged): " << std::setw(8) << perCall(t1, t2)
+        << " ns/call, " << (allocs2 - allocs1) / static_cast<double>(loops)
+        << " allocations/call, state number "
+        << (unchanged ? "unchanged" : "changed") << "\n"
+        << "  restoreState (changed):   " << std::setw(8) << perCall(t2, t3)
+        << " ns/call, " << (allocs3 - allocs2) / static_cast<double>(loops)
+        << " allocations/call\n";
+}
+
+int main()
+{
+    try {
+        auto gas = newSolution("gri30.yaml", "gri30", "None");
+        gas->thermo()->setState_TPX(1200, OneAtm, "CH4:1, O2:2, N2:7.52");
+        benchmark("Ideal gas (gri30)", *gas->thermo());
+
+        auto water = newSolution("liquidvapor.yaml", "water", "None");
+        water->thermo()->setState_TP(300, OneAtm);
+        benchmark("Pure fluid (water)", *water->thermo());
+
+        auto lattice = newSolution("sofc.yaml", "oxide_bulk", "None");
+        benchmark("Lattice (oxide_bulk)", *lattice->thermo());
+    } catch (std::exception& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
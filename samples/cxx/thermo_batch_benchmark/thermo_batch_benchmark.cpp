@@ -0,0 +1,172 @@
+/*!
+ * @file thermo_batch_benchmark.cpp
+ *
+ * Benchmark for batched evaluation of thermodynamic properties
+ *
+ * This benchmark measures the number of states ("cells") per second for which
+ * the mass-specific enthalpy, heat capacity, density and mean molecular weight
+ * can be computed, as is done when post-processing the fields of a CFD
+ * simulation. Evaluating each state with ThermoPhase::setState_TPY() and the
+ * individual property getters is compared with ThermoPhase::getPropertiesBatch()
+ * using one and several threads.
+ *
+ * The second part measures the rate at which the temperature can be found
+ * from the enthalpy, pressure and composition, as required after each step of
+ * the energy equation in a CFD simulation. The general iteration implemented
+ * in ThermoPhase::setState_HP() is compared with the specialized version for
+ * ideal gases and with ThermoPhase::solveTemperatureBatch_HP(), using initial
+ * estimates which differ from the solution by 50 K.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+using namespace Cantera;
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double cellsPerSecond(size_t nStates, Clock::time_point t0, Clock::time_point t1)
+{
+    return nStates / std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main(int argc, char** argv)
+{
+    try {
+        size_t nStates = (argc > 1) ? std::stoul(argv[1]) : 200000;
+        auto sol = newSolution("gri30.yaml", "gri30", "None");
+        auto gas = sol->thermo();
+        size_t nsp = gas->nSpecies();
+
+        // Partially burned methane/air mixtures over a range of temperatures
+        vector_fp T(nStates), P(nStates), Y(nsp * nStates);
+        vector_fp y(nsp);
+        for (size_t m = 0; m < nStates; m++) {
+            T[m] = 300.0 + 2200.0 * m / nStates;
+            P[m] = OneAtm * (1.0 + 0.1 * (m % 10));
+            gas->setState_TPX(T[m], P[m], "CH4:1, O2:2, N2:7.52, CO2:0.1, H2O:0.2, OH:0.01");
+            gas->getMassFractions(y.data());
+            for (size_t k = 0; k < nsp; k++) {
+                Y[k * nStates + m] = y[k];
+            }
+        }
+
+        vector_fp h(nStates), cp(nStates), rho(nStates), mw(nStates);
+        auto t0 = Clock::now();
+        for (size_t m = 0; m < nStates; m++) {
+            for (size_t k = 0; k < nsp; k++) {
+                y[k] = Y[k * nStates + m];
+            }
+            gas->setState_TPY(T[m], P[m], y.data());
+            h[m] = gas->enthalpy_mass();
+            cp[m] = gas->cp_mass();
+            rho[m] = gas->density();
+            mw[m] = gas->meanMolecularWeight();
+        }
+        auto t1 = Clock::now();
+        double rate0 = cellsPerSecond(nStates, t0, t1);
+
+        vector_fp hb(nStates), cpb(nStates), rhob(nStates), mwb(nStates);
+        gas->setBatchThreads(1);
+        t0 = Clock::now();
+        gas->getPropertiesBatch(nStates, T.data(), P.data(), Y.data(),
+                                hb.data(), cpb.data(), rhob.data(), mwb.data());
+        t1 = Clock::now();
+        double rate1 = cellsPerSecond(nStates, t0, t1);
+
+        gas->setBatchThreads(0);
+        t0 = Clock::now();
+        gas->getPropertiesBatch(nStates, T.data(), P.data(), Y.data(),
+                                hb.data(), cpb.data(), rhob.data(), mwb.data());
+        t1 = Clock::now();
+        double rateN = cellsPerSecond(nStates, t0, t1);
+
+        double maxErr = 0.0;
+        for (size_t m = 0; m < nStates; m++) {
+            maxErr = std::max(maxErr, std::abs(hb[m] - h[m]) / (std::abs(h[m]) + 1.0));
+            maxErr = std::max(maxErr, std::abs(cpb[m] - cp[m]) / cp[m]);
+            maxErr = std::max(maxErr, std::abs(rhob[m] - rho[m]) / rho[m]);
+        }
+
+        std::cout << "Ideal gas (gri30), " << nStates << " states\n"
+            << std::setprecision(4)
+            << "  setState_TPY + getters: " << std::setw(10) << rate0
+            << " cells/s\n"
+            << "  batch, 1 thread:        " << std::setw(10) << rate1
+            << " cells/s (" << rate1 / rate0 << "x)\n"
+            << "  batch, " << std::setw(3) << gas->batchThreads() << " threads:     "
+            << std::setw(10) << rateN << " cells/s (" << rateN / rate0 << "x)\n"
+            << "  max. relative difference: " << maxErr << std::endl;
+
+        // Initial estimates of the temperature, as from a previous time step
+        vector_fp T0(nStates), Tb(nStates);
+        for (size_t m = 0; m < nStates; m++) {
+            T0[m] = T[m] + 50.0;
+        }
+        t0 = Clock::now();
+        for (size_t m = 0; m < nStates; m++) {
+            for (size_t k = 0; k < nsp; k++) {
+                y[k] = Y[k * nStates + m];
+            }
+            gas->setState_TPY(T0[m], P[m], y.data());
+            gas->ThermoPhase::setState_HP(h[m], P[m]);
+        }
+        t1 = Clock::now();
+        double rateG = cellsPerSecond(nStates, t0, t1);
+
+        t0 = Clock::now();
+        for (size_t m = 0; m < nStates; m++) {
+            for (size_t k = 0; k < nsp; k++) {
+                y[k] = Y[k * nStates + m];
+            }
+            gas->setState_TPY(T0[m], P[m], y.data());
+            gas->setState_HP(h[m], P[m]);
+        }
+        t1 = Clock::now();
+        double rateS = cellsPerSecond(nStates, t0, t1);
+
+        Tb = T0;
+        gas->setBatchThreads(1);
+        t0 = Clock::now();
+        gas->solveTemperatureBatch_HP(nStates, h.data(), P.data(), Y.data(),
+                                      Tb.data());
+        t1 = Clock::now();
+        rate1 = cellsPerSecond(nStates, t0, t1);
+
+        Tb = T0;
+        gas->setBatchThreads(0);
+        t0 = Clock::now();
+        gas->solveTemperatureBatch_HP(nStates, h.data(), P.data(), Y.data(),
+                                      Tb.data());
+        t1 = Clock::now();
+        rateN = cellsPerSecond(nStates, t0, t1);
+
+        maxErr = 0.0;
+        for (size_t m = 0; m < nStates; m++) {
+            maxErr = std::max(maxErr, std::abs(Tb[m] - T[m]) / T[m]);
+        }
+
+        std::cout << "Temperature from enthalpy and pressure\n"
+            << "  general setState_HP:    " << std::setw(10) << rateG
+            << " cells/s\n"
+            << "  ideal gas setState_HP:  " << std::setw(10) << rateS
+            << " cells/s (" << rateS / rateG << "x)\n"
+            << "  batch, 1 thread:        " << std::setw(10) << rate1
+            << " cells/s (" << rate1 / rateG << "x)\n"
+            << "  batch, " << std::setw(3) << gas->batchThreads() << " threads:     "
+            << std::setw(10) << rateN << " cells/s (" << rateN / rateG << "x)\n"
+            << "  max. relative difference: " << maxErr << std::endl;
+    } catch (std::exception& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,694 @@
+/**
+ *  @file BinaryMechanism.cpp
+ *   Writing and loading of precompiled binary mechanism files
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/BinaryMechanism.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/Array.h"
+#include "cantera/base/global.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/Species.h"
+#include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/Falloff.h"
+#include "cantera/transport/GasTransport.h"
+#include "cantera/transport/TransportData.h"
+#include "cantera/transport/TransportFactory.h"
+
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+
+#ifdef _WIN32
+#include <sstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Cantera
+{
+
+namespace {
+
+const char magic[8] = {'C', 'T', 'B', 'M', 'E', 'C', 'H', '\0'};
+const uint32_t byteOrderMark = 0x01020304;
+const uint32_t endMark = 0x454e4421;
+
+//! Sequential writer for the binary mechanism format
+class BinaryWriter
+{
+public:
+    void put(uint64_t n) {
+        m_buf.append(reinterpret_cast<const char*>(&n), sizeof(n));
+    }
+    void put(uint32_t n) {
+        m_buf.append(reinterpret_cast<const char*>(&n), sizeof(n));
+    }
+    void put(double x) {
+        m_buf.append(reinterpret_cast<const char*>(&x), sizeof(x));
+    }
+    void put(bool flag) {
+        put(uint64_t(flag));
+    }
+    void put(int n) {
+        put(uint64_t(int64_t(n)));
+    }
+    void put(const std::string& s) {
+        put(uint64_t(s.size()));
+        m_buf.append(s);
+    }
+    void put(const vector_fp& v) {
+        put(uint64_t(v.size()));
+        m_buf.append(reinterpret_cast<const char*>(v.data()),
+                     v.size() * sizeof(double));
+    }
+    void put(const vector_int& v) {
+        put(uint64_t(v.size()));
+        for (int n : v) {
+            put(n);
+        }
+    }
+    void put(const Composition& comp) {
+        put(uint64_t(comp.size()));
+        for (const auto& item : comp) {
+            put(item.first);
+            put(item.second);
+        }
+    }
+    template <class T>
+    void put(const std::vector<T>& v) {
+        put(uint64_t(v.size()));
+        for (const auto& item : v) {
+            put(item);
+        }
+    }
+    void putArrhenius(const ArrheniusBase& rate) {
+        put(rate.preExponentialFactor());
+        put(rate.temperatureExponent());
+        put(rate.activationEnergy());
+    }
+
+    const std::string& buffer() const {
+        return m_buf;
+    }
+
+private:
+    std::string m_buf;
+};
+
+//! Sequential reader for the binary mechanism format
+class BinaryReader
+{
+public:
+    BinaryReader(const char* data, size_t size, const std::string& filename)
+        : m_data(data), m_size(size), m_pos(0), m_filename(filename) {}
+
+    uint64_t getSize() {
+        uint64_t n;
+        read(&n, sizeof(n));
+        return n;
+    }
+    uint32_t getUInt32() {
+        uint32_t n;
+        read(&n, sizeof(n));
+        return n;
+    }
+    double getDouble() {
+        double x;
+        read(&x, sizeof(x));
+        return x;
+    }
+    bool getBool() {
+        return getSize() != 0;
+    }
+    int getInt() {
+        return static_cast<int>(static_cast<int64_t>(getSize()));
+    }
+    std::string getString() {
+        size_t n = getSize();
+        check(n);
+        std::string s(m_data + m_pos, n);
+        m_pos += n;
+        return s;
+    }
+    vector_fp getVector() {
+        size_t n = getSize();
+        vector_fp v(n);
+        read(v.data(), n * sizeof(double));
+        return v;
+    }
+    vector_int getIntVector() {
+        size_t n = getSize();
+        vector_int v(n);
+        for (size_t i = 0; i < n; i++) {
+            v[i] = getInt();
+        }
+        return v;
+    }
+    std::vector<vector_fp> getVectors() {
+        std::vector<vector_fp> v(getSize());
+        for (auto& item : v) {
+            item = getVector();
+        }
+        return v;
+    }
+    std::vector<vector_int> getIntVectors() {
+        std::vector<vector_int> v(getSize());
+        for (auto& item : v) {
+            item = getIntVector();
+        }
+        return v;
+    }
+    Composition getComposition() {
+        Composition comp;
+        size_t n = getSize();
+        for (size_t i = 0; i < n; i++) {
+            std::string name = getString();
+            comp[name] = getDouble();
+        }
+        return comp;
+    }
+    Arrhenius3 getArrhenius() {
+        double A = getDouble();
+        double b = getDouble();
+        double Ea = getDouble();
+        return Arrhenius3(A, b, Ea);
+    }
+
+    //! Read the raw bytes of a fixed-size header field
+    void read(void* dest, size_t n) {
+        check(n);
+        std::memcpy(dest, m_data + m_pos, n);
+        m_pos += n;
+    }
+
+private:
+    void check(size_t n) {
+        if (n > m_size - m_pos) {
+            throw CanteraError("newSolutionFromBinary",
+                "Unexpected end of binary mechanism file '{}'.", m_filename);
+        }
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos;
+    std::string m_filename;
+};
+
+//! Read-only view of the contents of a file. The file is memory-mapped where
+//! supported and read into memory otherwise.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& filename)
+        : m_data(nullptr), m_size(0)
+    {
+#ifdef _WIN32
+        std::ifstream in(filename, std::ios::binary);
+        if (!in) {
+            throw CanteraError("MappedFile::MappedFile",
+                               "Could not open file '{}'.", filename);
+        }
+        std::ostringstream contents;
+        contents << in.rdbuf();
+        m_contents = contents.str();
+        m_data = m_contents.data();
+        m_size = m_contents.size();
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw CanteraError("MappedFile::MappedFile",
+                               "Could not open file '{}'.", filename);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw CanteraError("MappedFile::MappedFile",
+                               "Could not determine size of file '{}'.", filename);
+        }
+        m_size = static_cast<size_t>(info.st_size);
+        if (m_size) {
+            void* addr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                close(fd);
+                throw CanteraError("MappedFile::MappedFile",
+                                   "Could not map file '{}'.", filename);
+            }
+            m_data = static_cast<const char*>(addr);
+        }
+        close(fd);
+#endif
+    }
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (m_data) {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const {
+        return m_data;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+private:
+    const char* m_data;
+    size_t m_size;
+#ifdef _WIN32
+    std::string m_contents;
+#endif
+};
+
+void writeRate(BinaryWriter& out, shared_ptr<ReactionRate> rate,
+               const std::string& equation)
+{
+    std::string type = rate->type();
+    out.put(type);
+    if (type == "Arrhenius") {
+        auto arr = std::dynamic_pointer_cast<ArrheniusRate>(rate);
+        out.put(arr->allowNegativePreExponentialFactor());
+        out.putArrhenius(*arr);
+    } else if (type == "Blowers-Masel") {
+        auto bm = std::dynamic_pointer_cast<BlowersMaselRate>(rate);
+        out.put(bm->allowNegativePreExponentialFactor());
+        out.putArrhenius(*bm);
+        out.put(bm->bondEnergy());
+    } else if (type == "Lindemann" || type == "Troe" || type == "SRI"
+               || type == "Tsang") {
+        auto falloff = std::dynamic_pointer_cast<FalloffRate>(rate);
+        out.put(falloff->allowNegativePreExponentialFactor());
+        out.put(falloff->chemicallyActivated());
+        out.putArrhenius(falloff->lowRate());
+        out.putArrhenius(falloff->highRate());
+        vector_fp c;
+        falloff->getFalloffCoeffs(c);
+        out.put(c);
+    } else if (type == "pressure-dependent-Arrhenius") {
+        auto rates = std::dynamic_pointer_cast<PlogRate>(rate)->getRates();
+        out.put(uint64_t(rates.size()));
+        for (const auto& item : rates) {
+            out.put(item.first);
+            out.putArrhenius(item.second);
+        }
+    } else if (type == "Chebyshev") {
+        auto cheb = std::dynamic_pointer_cast<ChebyshevRate>(rate);
+        out.put(cheb->Tmin());
+        out.put(cheb->Tmax());
+        out.put(cheb->Pmin());
+        out.put(cheb->Pmax());
+        out.put(uint64_t(cheb->data().nRows()));
+        out.put(uint64_t(cheb->data().nColumns()));
+        out.put(cheb->data().data());
+    } else {
+        throw NotImplementedError("writeBinaryMechanism",
+            "Rate type '{}' of reaction '{}' is not supported.", type, equation);
+    }
+}
+
+shared_ptr<ReactionRate> readRate(BinaryReader& in)
+{
+    std::string type = in.getString();
+    if (type == "Arrhenius") {
+        bool negativeA = in.getBool();
+        Arrhenius3 arr = in.getArrhenius();
+        auto rate = make_shared<ArrheniusRate>(arr.preExponentialFactor(),
+            arr.temperatureExponent(), arr.activationEnergy());
+        rate->setAllowNegativePreExponentialFactor(negativeA);
+        return rate;
+    } else if (type == "Blowers-Masel") {
+        bool negativeA = in.getBool();
+        Arrhenius3 arr = in.getArrhenius();
+        double w = in.getDouble();
+        auto rate = make_shared<BlowersMaselRate>(arr.preExponentialFactor(),
+            arr.temperatureExponent(), arr.activationEnergy(), w);
+        rate->setAllowNegativePreExponentialFactor(negativeA);
+        return rate;
+    } else if (type == "Lindemann" || type == "Troe" || type == "SRI"
+               || type == "Tsang") {
+        bool negativeA = in.getBool();
+        bool activated = in.getBool();
+        Arrhenius3 low = in.getArrhenius();
+        Arrhenius3 high = in.getArrhenius();
+        vector_fp c = in.getVector();
+        shared_ptr<FalloffRate> rate;
+        if (type == "Lindemann") {
+            rate = make_shared<LindemannRate>(low, high, c);
+        } else if (type == "Troe") {
+            rate = make_shared<TroeRate>(low, high, c);
+        } else if (type == "SRI") {
+            rate = make_shared<SriRate>(low, high, c);
+        } else {
+            rate = make_shared<TsangRate>(low, high, c);
+        }
+        rate->setAllowNegativePreExponentialFactor(negativeA);
+        rate->setChemicallyActivated(activated);
+        return rate;
+    } else if (type == "pressure-dependent-Arrhenius") {
+        std::multimap<double, Arrhenius3> rates;
+        size_t n = in.getSize();
+        for (size_t i = 0; i < n; i++) {
+            double P = in.getDouble();
+            rates.insert({P, in.getArrhenius()});
+        }
+        return make_shared<PlogRate>(rates);
+    } else if (type == "Chebyshev") {
+        double Tmin = in.getDouble();
+        double Tmax = in.getDouble();
+        double Pmin = in.getDouble();
+        double Pmax = in.getDouble();
+        size_t nT = in.getSize();
+        size_t nP = in.getSize();
+        Array2D coeffs(nT, nP);
+        coeffs.data() = in.getVector();
+        return make_shared<ChebyshevRate>(Tmin, Tmax, Pmin, Pmax, coeffs);
+    }
+    throw CanteraError("newSolutionFromBinary",
+                       "Unknown rate type '{}'.", type);
+}
+
+void writeReaction(BinaryWriter& out, Reaction& R)
+{
+    if (R.usesLegacy()) {
+        throw NotImplementedError("writeBinaryMechanism",
+            "Legacy reaction '{}' is not supported.", R.equation());
+    }
+    std::string type = R.type();
+    if (type != "reaction" && type != "three-body" && type != "falloff"
+        && type != "chemically-activated") {
+        throw NotImplementedError("writeBinaryMechanism",
+            "Reaction type '{}' is not supported.", type);
+    }
+    out.put(type);
+    out.put(R.reactants);
+    out.put(R.products);
+    out.put(R.orders);
+    out.put(R.id);
+    out.put(R.reversible);
+    out.put(R.duplicate);
+    out.put(R.allow_nonreactant_orders);
+    out.put(R.allow_negative_orders);
+    auto tbody = R.thirdBody();
+    out.put(bool(tbody));
+    if (tbody) {
+        out.put(tbody->efficiencies);
+        out.put(tbody->default_efficiency);
+        out.put(tbody->specified_collision_partner);
+        out.put(tbody->mass_action);
+    }
+    writeRate(out, R.rate(), R.equation());
+}
+
+shared_ptr<Reaction> readReaction(BinaryReader& in)
+{
+    std::string type = in.getString();
+    shared_ptr<Reaction> R;
+    if (type == "three-body") {
+        R = make_shared<ThreeBodyReaction3>();
+    } else if (type == "falloff" || type == "chemically-activated") {
+        R = make_shared<FalloffReaction3>();
+    } else {
+        R = make_shared<Reaction>();
+    }
+    R->reactants = in.getComposition();
+    R->products = in.getComposition();
+    R->orders = in.getComposition();
+    R->id = in.getString();
+    R->reversible = in.getBool();
+    R->duplicate = in.getBool();
+    R->allow_nonreactant_orders = in.getBool();
+    R->allow_negative_orders = in.getBool();
+    if (in.getBool()) {
+        auto tbody = R->thirdBody();
+        tbody->efficiencies = in.getComposition();
+        tbody->default_efficiency = in.getDouble();
+        tbody->specified_collision_partner = in.getBool();
+        tbody->mass_action = in.getBool();
+    }
+    R->setRate(readRate(in));
+    return R;
+}
+
+} // end unnamed namespace
+
+void writeBinaryMechanism(shared_ptr<Solution> soln, const std::string& filename)
+{
+    auto thermo = soln->thermo();
+    auto kin = soln->kinetics();
+    auto tran = soln->transport();
+    if (!thermo) {
+        throw CanteraError("writeBinaryMechanism",
+                           "Requires associated 'ThermoPhase'");
+    }
+    if (thermo->type() != "IdealGas" || soln->nAdjacent()) {
+        throw NotImplementedError("writeBinaryMechanism",
+            "Not implemented for phases of type '{}'.", thermo->type());
+    }
+    if (kin && kin->kineticsType() != "Gas") {
+        throw NotImplementedError("writeBinaryMechanism",
+            "Not implemented for kinetics of type '{}'.", kin->kineticsType());
+    }
+    auto gasTran = std::dynamic_pointer_cast<GasTransport>(tran);
+    std::string tranType = tran ? tran->transportType() : "None";
+    if (tranType != "None" && (!gasTran ||
+        (tranType != "Mix" && tranType != "CK_Mix" && tranType != "Multi"
+         && tranType != "CK_Multi")))
+    {
+        throw NotImplementedError("writeBinaryMechanism",
+            "Not implemented for transport model '{}'.", tranType);
+    }
+
+    BinaryWriter out;
+    out.put(uint32_t(BINARY_MECHANISM_VERSION));
+    out.put(byteOrderMark);
+    out.put(soln->source());
+    out.put(thermo->name());
+    out.put(thermo->type());
+    out.put(kin ? kin->kineticsType() : "");
+    out.put(tranType);
+
+    // elements
+    out.put(uint64_t(thermo->nElements()));
+    for (size_t m = 0; m < thermo->nElements(); m++) {
+        out.put(thermo->elementName(m));
+        out.put(thermo->atomicWeight(m));
+        out.put(thermo->atomicNumber(m));
+        out.put(thermo->entropyElement298(m));
+        out.put(thermo->elementType(m));
+    }
+
+    // species
+    out.put(uint64_t(thermo->nSpecies()));
+    for (size_t k = 0; k < thermo->nSpecies(); k++) {
+        auto sp = thermo->species(k);
+        out.put(sp->name);
+        out.put(sp->composition);
+        out.put(sp->charge);
+        out.put(sp->size);
+
+        size_t n;
+        int type;
+        double tlow, thigh, pref;
+        vector_fp coeffs(sp->thermo->nCoeffs());
+        sp->thermo->reportParameters(n, type, tlow, thigh, pref, coeffs.data());
+        out.put(type);
+        out.put(tlow);
+        out.put(thigh);
+        out.put(pref);
+        out.put(coeffs);
+
+        auto data = std::dynamic_pointer_cast<GasTransportData>(sp->transport);
+        out.put(bool(data));
+        if (data) {
+            out.put(data->geometry);
+            out.put(data->diameter);
+            out.put(data->well_depth);
+            out.put(data->dipole);
+            out.put(data->polarizability);
+            out.put(data->rotational_relaxation);
+            out.put(data->acentric_factor);
+            out.put(data->dispersion_coefficient);
+            out.put(data->quadrupole_polarizability);
+        }
+    }
+
+    vector_fp state;
+    thermo->saveState(state);
+    out.put(state);
+
+    // reactions
+    if (kin) {
+        out.put(kin->skipUndeclaredSpecies());
+        out.put(kin->skipUndeclaredThirdBodies());
+        out.put(uint64_t(kin->nReactions()));
+        for (size_t i = 0; i < kin->nReactions(); i++) {
+            writeReaction(out, *kin->reaction(i));
+            out.put(kin->multiplier(i));
+        }
+    }
+
+    // transport property fits
+    if (gasTran) {
+        GasTransportFits fits = gasTran->fits();
+        out.put(fits.mode);
+        out.put(fits.visccoeffs);
+        out.put(fits.condcoeffs);
+        out.put(fits.diffcoeffs);
+        out.put(fits.poly);
+        out.put(fits.star_poly_uses_actualT);
+        out.put(fits.omega22_poly);
+        out.put(fits.astar_poly);
+        out.put(fits.bstar_poly);
+        out.put(fits.cstar_poly);
+    }
+    out.put(endMark);
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file) {
+        throw CanteraError("writeBinaryMechanism",
+                           "Could not open file '{}' for writing.", filename);
+    }
+    file.write(magic, sizeof(magic));
+    file.write(out.buffer().data(), out.buffer().size());
+}
+
+shared_ptr<Solution> newSolutionFromBinary(const std::string& filename)
+{
+    std::string path = findInputFile(filename);
+    MappedFile file(path);
+    if (file.size() < sizeof(magic)
+        || std::memcmp(file.data(), magic, sizeof(magic)) != 0) {
+        throw CanteraError("newSolutionFromBinary",
+            "File '{}' is not a binary mechanism file.", filename);
+    }
+    BinaryReader in(file.data() + sizeof(magic), file.size() - sizeof(magic),
+                    filename);
+    uint32_t version = in.getUInt32();
+    uint32_t bom = in.getUInt32();
+    if (version != BINARY_MECHANISM_VERSION || bom != byteOrderMark) {
+        throw CanteraError("newSolutionFromBinary",
+            "Binary mechanism file '{}' was written for a different format "
+            "version or architecture.", filename);
+    }
+
+    auto sol = Solution::create();
+    std::string source = in.getString();
+    std::string name = in.getString();
+    std::string thermoType = in.getString();
+    std::string kinType = in.getString();
+    std::string tranType = in.getString();
+
+    shared_ptr<ThermoPhase> thermo(newThermoPhase(thermoType));
+    thermo->setName(name);
+    size_t nElements = in.getSize();
+    for (size_t m = 0; m < nElements; m++) {
+        std::string symbol = in.getString();
+        double weight = in.getDouble();
+        int atomicNumber = in.getInt();
+        double entropy298 = in.getDouble();
+        int elementType = in.getInt();
+        thermo->addElement(symbol, weight, atomicNumber, entropy298, elementType);
+    }
+
+    size_t nSpecies = in.getSize();
+    for (size_t k = 0; k < nSpecies; k++) {
+        std::string spName = in.getString();
+        Composition comp = in.getComposition();
+        double charge = in.getDouble();
+        double size = in.getDouble();
+        auto sp = make_shared<Species>(spName, comp, charge, size);
+        int type = in.getInt();
+        double tlow = in.getDouble();
+        double thigh = in.getDouble();
+        double pref = in.getDouble();
+        vector_fp coeffs = in.getVector();
+        sp->thermo.reset(newSpeciesThermoInterpType(type, tlow, thigh, pref,
+                                                    coeffs.data()));
+        if (in.getBool()) {
+            auto data = make_shared<GasTransportData>();
+            data->geometry = in.getString();
+            data->diameter = in.getDouble();
+            data->well_depth = in.getDouble();
+            data->dipole = in.getDouble();
+            data->polarizability = in.getDouble();
+            data->rotational_relaxation = in.getDouble();
+            data->acentric_factor = in.getDouble();
+            data->dispersion_coefficient = in.getDouble();
+            data->quadrupole_polarizability = in.getDouble();
+            sp->transport = data;
+        }
+        thermo->addSpecies(sp);
+    }
+    thermo->initThermo();
+    thermo->restoreState(in.getVector());
+    sol->setThermo(thermo);
+
+    if (!kinType.empty()) {
+        shared_ptr<Kinetics> kin(newKineticsMgr(kinType));
+        kin->addPhase(*thermo);
+        kin->init();
+        kin->skipUndeclaredSpecies(in.getBool());
+        kin->skipUndeclaredThirdBodies(in.getBool());
+        size_t nReactions = in.getSize();
+        vector_fp multipliers(nReactions);
+        for (size_t i = 0; i < nReactions; i++) {
+            kin->addReaction(readReaction(in), false);
+            multipliers[i] = in.getDouble();
+        }
+        kin->resizeReactions();
+        for (size_t i = 0; i < nReactions; i++) {
+            kin->setMultiplier(i, multipliers[i]);
+        }
+        sol->setKinetics(kin);
+    }
+
+    if (tranType != "None") {
+        GasTransportFits fits;
+        fits.mode = in.getInt();
+        fits.visccoeffs = in.getVectors();
+        fits.condcoeffs = in.getVectors();
+        fits.diffcoeffs = in.getVectors();
+        fits.poly = in.getIntVectors();
+        fits.star_poly_uses_actualT = in.getIntVectors();
+        fits.omega22_poly = in.getVectors();
+        fits.astar_poly = in.getVectors();
+        fits.bstar_poly = in.getVectors();
+        fits.cstar_poly = in.getVectors();
+        unique_ptr<Transport> tran(TransportFactory::factory()->create(tranType));
+        dynamic_cast<GasTransport&>(*tran).setFits(fits);
+        vector_fp state;
+        thermo->saveState(state);
+        tran->init(thermo.get(), fits.mode);
+        thermo->restoreState(state);
+        sol->setTransport(shared_ptr<Transport>(std::move(tran)));
+    } else {
+        sol->setTransport(shared_ptr<Transport>(newTransportMgr("None")));
+    }
+
+    if (in.getUInt32() != endMark) {
+        throw CanteraError("newSolutionFromBinary",
+            "Binary mechanism file '{}' is corrupted.", filename);
+    }
+    sol->setSource(source);
+    return sol;
+}
+
+}
@@ -7,18 +7,30 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/base/Solution.h"
+#include "cantera/base/BinaryMechanism.h"
 #include "cantera/base/Interface.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/kinetics/Kinetics.h"
 #include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/kinetics/GasKinetics.h"
 #include "cantera/transport/TransportBase.h"
 #include "cantera/transport/TransportFactory.h"
+#include "cantera/transport/GasTransport.h"
+#include "cantera/thermo/VPStandardStateTP.h"
 #include "cantera/base/stringUtils.h"
 
+#include <mutex>
+
 namespace Cantera
 {
 
+namespace {
+// Species and Reaction objects are modified while they are added to clones of
+// a Solution object (for example, when rate indices are set)
+std::mutex clone_mutex;
+}
+
 Solution::Solution() {}
 
 std::string Solution::name() const {
@@ -119,6 +131,106 @@ void Solution::setSource(const std::string& source) {
     m_header.setMetadata("filename", filename);
 }
 
+shared_ptr<Solution> Solution::clone()
+{
+    if (!m_thermo) {
+        throw CanteraError("Solution::clone", "Requires associated 'ThermoPhase'");
+    }
+    if (m_thermo->nDim() != 3 || !m_adjacent.empty()) {
+        throw NotImplementedError("Solution::clone",
+            "Not implemented for Solution objects with adjacent phases.");
+    }
+    if (dynamic_cast<VPStandardStateTP*>(m_thermo.get())) {
+        throw NotImplementedError("Solution::clone",
+            "Not implemented for phases of type '{}'.", m_thermo->type());
+    }
+
+    std::unique_lock<std::mutex> lock(clone_mutex);
+    auto sol = Solution::create();
+
+    // thermo phase, using shared species objects
+    shared_ptr<ThermoPhase> thermo(newThermoPhase(m_thermo->type()));
+    thermo->setName(m_thermo->name());
+    for (size_t m = 0; m < m_thermo->nElements(); m++) {
+        thermo->addElement(m_thermo->elementName(m), m_thermo->atomicWeight(m),
+                           m_thermo->atomicNumber(m),
+                           m_thermo->entropyElement298(m),
+                           m_thermo->elementType(m));
+    }
+    for (size_t k = 0; k < m_thermo->nSpecies(); k++) {
+        thermo->addSpecies(m_thermo->species(k));
+    }
+    thermo->setParameters(m_thermo->input());
+    thermo->initThermo();
+    vector_fp state;
+    m_thermo->saveState(state);
+    thermo->restoreState(state);
+    sol->setThermo(thermo);
+
+    // kinetics, using shared reaction objects
+    if (m_kinetics) {
+        shared_ptr<Kinetics> kin(newKineticsMgr(m_kinetics->kineticsType()));
+        kin->addPhase(*thermo);
+        kin->init();
+        kin->skipUndeclaredSpecies(m_kinetics->skipUndeclaredSpecies());
+        kin->skipUndeclaredThirdBodies(m_kinetics->skipUndeclaredThirdBodies());
+        for (size_t i = 0; i < m_kinetics->nReactions(); i++) {
+            kin->addReaction(m_kinetics->reaction(i), false);
+        }
+        kin->resizeReactions();
+        for (size_t i = 0; i < m_kinetics->nReactions(); i++) {
+            kin->setMultiplier(i, m_kinetics->multiplier(i));
+        }
+        kin->setFusedStoichiometry(m_kinetics->fusedStoichiometry());
+        if (!m_kinetics->quasiSteadySpecies().empty()) {
+            std::vector<std::string> qss;
+            for (size_t k : m_kinetics->quasiSteadySpecies()) {
+                qss.push_back(m_kinetics->kineticsSpeciesName(k));
+            }
+            kin->setQuasiSteadySpecies(qss);
+        }
+        if (auto gasKin = dynamic_cast<GasKinetics*>(m_kinetics.get())) {
+            auto& gasKin2 = dynamic_cast<GasKinetics&>(*kin);
+            double rtol, atol;
+            size_t maxIter;
+            gasKin->getQuasiSteadyTolerances(rtol, atol, maxIter);
+            gasKin2.setQuasiSteadyTolerances(rtol, atol, maxIter);
+            if (gasKin->rateTableEnabled()) {
+                double Tmin, Tmax, dT;
+                gasKin->getRateTable(Tmin, Tmax, dT, rtol);
+                gasKin2.setRateTable(Tmin, Tmax, dT, rtol);
+            }
+        }
+        try {
+            AnyMap settings;
+            m_kinetics->getDerivativeSettings(settings);
+            kin->setDerivativeSettings(settings);
+        } catch (NotImplementedError&) {
+            // derivatives are not available for this kinetics model
+        }
+        sol->setKinetics(kin);
+    }
+
+    // transport
+    if (auto gasTran = dynamic_cast<GasTransport*>(m_transport.get())) {
+        // reuse the polynomial fits instead of generating them again
+        GasTransportFits fits = gasTran->fits();
+        unique_ptr<Transport> tran(
+            TransportFactory::factory()->create(m_transport->transportType()));
+        dynamic_cast<GasTransport&>(*tran).setFits(fits);
+        thermo->saveState(state);
+        tran->init(thermo.get(), fits.mode);
+        thermo->restoreState(state);
+        sol->setTransport(shared_ptr<Transport>(std::move(tran)));
+    } else if (m_transport) {
+        sol->setTransport(shared_ptr<Transport>(
+            newTransportMgr(m_transport->transportType(), thermo.get())));
+    }
+
+    sol->header() = m_header;
+    return sol;
+}
+
 shared_ptr<Solution> newSolution(const std::string& infile,
                                  const std::string& name,
                                  const std::string& transport,
@@ -138,6 +250,9 @@ shared_ptr<Solution> newSolution(const std::string& infile,
         auto sol = newSolution(phaseNode, rootNode, transport, adjacent);
         sol->setSource(infile);
         return sol;
+    } else if (extension == "ctb") {
+        // load precompiled binary mechanism
+        return newSolutionFromBinary(infile);
     }
 
     // instantiate Solution object
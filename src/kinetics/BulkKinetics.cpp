@@ -139,6 +139,7 @@ bool BulkKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
             m_bulk_types[rate->type()] = m_bulk_rates.size();
             m_bulk_rates.push_back(rate->newMultiRate());
             m_bulk_rates.back()->resize(m_kk, nReactions());
+            m_bulk_prof.push_back(addProfilingSection("MultiRate:" + rate->type()));
         }
 
         // Set index of rate to number of reaction within kinetics
@@ -227,6 +228,24 @@ void BulkKinetics::setMultiplier(size_t i, double f) {
     m_ROP_ok = false;
 }
 
+void BulkKinetics::setActiveReactions(const std::vector<bool>& active)
+{
+    if (!active.empty() && active.size() != nReactions()) {
+        throw CanteraError("BulkKinetics::setActiveReactions",
+            "Length of mask ({}) does not match number of reactions ({}).",
+            active.size(), nReactions());
+    }
+    if (std::find(active.begin(), active.end(), false) == active.end()) {
+        m_active.clear();
+    } else {
+        m_active = active;
+    }
+    for (auto& rates : m_bulk_rates) {
+        rates->setActiveReactions(m_active);
+    }
+    invalidateCache();
+}
+
 void BulkKinetics::invalidateCache()
 {
     Kinetics::invalidateCache();
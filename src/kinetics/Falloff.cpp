@@ -116,6 +116,23 @@ void FalloffRate::getParameters(AnyMap& node) const
     }
 }
 
+void FalloffRate::evalBatch(size_t nStates, const double* T, const double* logT,
+                            const double* recipT, const double* conc3b,
+                            double* kf)
+{
+    for (size_t m = 0; m < nStates; m++) {
+        updateTemp(T[m], m_work.data());
+        double k0 = m_lowRate.evalRate(logT[m], recipT[m]);
+        double kinf = m_highRate.evalRate(logT[m], recipT[m]);
+        double pr = conc3b[m] * k0 / (kinf + SmallNumber);
+        if (m_chemicallyActivated) {
+            kf[m] = F(pr, m_work.data()) / (1.0 + pr) * k0;
+        } else {
+            kf[m] = pr * (F(pr, m_work.data()) / (1.0 + pr)) * kinf;
+        }
+    }
+}
+
 void FalloffRate::check(const std::string& equation, const AnyMap& node)
 {
     m_lowRate.check(equation, node);
@@ -15,9 +15,32 @@ namespace Cantera
 GasKinetics::GasKinetics(ThermoPhase* thermo) :
     BulkKinetics(thermo),
     m_logStandConc(0.0),
-    m_pres(0.0)
+    m_pres(0.0),
+    m_table_Tmin(0.0),
+    m_table_Tmax(0.0),
+    m_table_dT(0.0),
+    m_table_dTmax(0.0),
+    m_table_rtol(0.0),
+    m_table_nT(0),
+    m_table_ok(false),
+    m_table_used(false),
+    m_table_evaluator(npos),
+    m_qss_rtol(1e-8),
+    m_qss_atol(1e-25),
+    m_qss_maxiter(50),
+    m_qss_niter(0),
+    m_qss_ok(false)
 {
     setDerivativeSettings(AnyMap()); // use default settings
+    m_prof_updateROP = addProfilingSection("updateROP");
+    m_prof_rates_T = addProfilingSection("update_rates_T");
+    m_prof_rates_C = addProfilingSection("update_rates_C");
+    m_prof_updateKc = addProfilingSection("updateKc");
+    m_prof_rateTable = addProfilingSection("evalRateTable");
+    m_prof_thirdBodies = addProfilingSection("processThirdBodies");
+    m_prof_falloff = addProfilingSection("processFalloffReactions");
+    m_prof_stoich = addProfilingSection("StoichManagerN::multiply");
+    m_prof_qss = addProfilingSection("solveQuasiSteady");
 }
 
 void GasKinetics::resizeReactions()
@@ -39,10 +62,15 @@ void GasKinetics::getThirdBodyConcentrations(double* concm)
 
 void GasKinetics::update_rates_T()
 {
+    ScopedTimer timer(profiler(m_prof_rates_T));
+    if (rateTableEnabled() && !m_table_ok) {
+        buildRateTable();
+    }
     double T = thermo().temperature();
     double P = thermo().pressure();
     m_logStandConc = log(thermo().standardConcentration());
     double logT = log(T);
+    bool useTable = rateTableEnabled() && T >= m_table_Tmin && T <= m_table_Tmax;
 
     if (T != m_temp) {
         // Update forward rate constant for each reaction
@@ -59,18 +87,39 @@ void GasKinetics::update_rates_T()
             m_falloffn.updateTemp(T, falloff_work.data());
         }
 
-        updateKc();
+        if (useTable) {
+            ScopedTimer tableTimer(profiler(m_prof_rateTable));
+            evalRateTable(T, m_rfn.data(), m_rkcn.data());
+        } else {
+            updateKc();
+        }
         m_ROP_ok = false;
+    } else {
+        timer.hit();
     }
 
     // loop over MultiRate evaluators for each reaction type
-    for (auto& rates : m_bulk_rates) {
+    for (size_t j = 0; j < m_bulk_rates.size(); j++) {
+        auto& rates = m_bulk_rates[j];
+        ScopedTimer ratesTimer(profiler(m_bulk_prof[j]));
         bool changed = rates->update(thermo(), *this);
+        if (j == m_table_evaluator) {
+            if (useTable) {
+                // rate constants are interpolated from tabulated values
+                continue;
+            } else if (m_table_used) {
+                // replace previously interpolated values
+                changed = true;
+            }
+        }
         if (changed) {
             rates->getRateConstants(m_rfn.data());
             m_ROP_ok = false;
+        } else {
+            ratesTimer.hit();
         }
     }
+    m_table_used = useTable;
     if (T != m_temp || P != m_pres) {
         // P-log reactions (legacy)
         if (m_plog_rates.nReactions()) {
@@ -90,6 +139,7 @@ void GasKinetics::update_rates_T()
 
 void GasKinetics::update_rates_C()
 {
+    ScopedTimer timer(profiler(m_prof_rates_C));
     thermo().getActivityConcentrations(m_act_conc.data());
     thermo().getConcentrations(m_phys_conc.data());
     doublereal ctot = thermo().molarDensity();
@@ -124,13 +174,19 @@ void GasKinetics::update_rates_C()
     m_ROP_ok = false;
 }
 
-void GasKinetics::updateKc()
+void GasKinetics::updateDeltaGibbs0()
 {
+    ScopedTimer timer(profiler(m_prof_updateKc));
     thermo().getStandardChemPotentials(m_grt.data());
     fill(m_delta_gibbs0.begin(), m_delta_gibbs0.end(), 0.0);
 
     // compute Delta G^0 for all reversible reactions
     getRevReactionDelta(m_grt.data(), m_delta_gibbs0.data());
+}
+
+void GasKinetics::updateKc()
+{
+    updateDeltaGibbs0();
 
     double rrt = 1.0 / thermo().RT();
     for (size_t i = 0; i < m_revindex.size(); i++) {
@@ -145,6 +201,169 @@ void GasKinetics::updateKc()
     }
 }
 
+void GasKinetics::setRateTable(double Tmin, double Tmax, double dT, double rtol)
+{
+    if (thermo().type() != "IdealGas") {
+        throw CanteraError("GasKinetics::setRateTable",
+            "Tabulation requires an ideal gas phase, but phase '{}' is of "
+            "type '{}'.", thermo().name(), thermo().type());
+    }
+    if (Tmin <= 0 || Tmax <= Tmin || dT <= 0 || rtol <= 0) {
+        throw CanteraError("GasKinetics::setRateTable",
+            "Invalid table parameters: Tmin = {}, Tmax = {}, dT = {}, rtol = {}.",
+            Tmin, Tmax, dT, rtol);
+    }
+    m_table_nT = static_cast<size_t>(ceil((Tmax - Tmin) / dT)) + 1;
+    m_table_Tmin = Tmin;
+    m_table_Tmax = Tmax;
+    m_table_dT = (Tmax - Tmin) / (m_table_nT - 1);
+    m_table_dTmax = dT;
+    m_table_rtol = rtol;
+    buildRateTable();
+}
+
+void GasKinetics::getRateTable(double& Tmin, double& Tmax, double& dT,
+                               double& rtol) const
+{
+    Tmin = m_table_Tmin;
+    Tmax = m_table_Tmax;
+    dT = m_table_dTmax;
+    rtol = m_table_rtol;
+}
+
+void GasKinetics::clearRateTable()
+{
+    m_table_nT = 0;
+    m_table_ok = false;
+    m_table_logkf.clear();
+    m_table_logkc.clear();
+    invalidateCache();
+}
+
+void GasKinetics::buildRateTable()
+{
+    m_table_rxn.clear();
+    for (size_t i = 0; i < nReactions(); i++) {
+        if (!m_reactions[i]->usesLegacy() &&
+            m_reactions[i]->rate()->type() == "Arrhenius")
+        {
+            m_table_rxn.push_back(i);
+        }
+    }
+    auto iter = m_bulk_types.find("Arrhenius");
+    m_table_evaluator = (iter == m_bulk_types.end()) ? npos : iter->second;
+
+    // Evaluate rate coefficients directly at grid temperatures and at the
+    // midpoints of all intervals
+    size_t nT = m_table_nT;
+    size_t nk = m_table_rxn.size();
+    size_t nr = m_revindex.size();
+    vector_fp kf((2 * nT - 1) * nk);
+    vector_fp kc((2 * nT - 1) * nr);
+    double P = thermo().pressure();
+    thermo().saveState(m_state);
+    for (size_t n = 0; n < 2 * nT - 1; n++) {
+        thermo().setState_TP(m_table_Tmin + 0.5 * n * m_table_dT, P);
+        m_logStandConc = log(thermo().standardConcentration());
+        updateKc();
+        for (size_t i = 0; i < nr; i++) {
+            kc[n * nr + i] = m_rkcn[m_revindex[i]];
+        }
+        if (m_table_evaluator != npos) {
+            m_bulk_rates[m_table_evaluator]->update(thermo(), *this);
+            m_bulk_rates[m_table_evaluator]->getRateConstants(m_rbuf0.data());
+            for (size_t i = 0; i < nk; i++) {
+                kf[n * nk + i] = m_rbuf0[m_table_rxn[i]];
+            }
+        }
+    }
+    thermo().restoreState(m_state);
+    invalidateCache();
+
+    // Tabulate logarithms at grid temperatures
+    m_table_sign.assign(nk, 0.0);
+    for (size_t n = 0; n < 2 * nT - 1; n++) {
+        for (size_t i = 0; i < nk; i++) {
+            if (kf[n * nk + i] != 0.0) {
+                m_table_sign[i] = (kf[n * nk + i] > 0) ? 1.0 : -1.0;
+            }
+        }
+    }
+    m_table_logkf.resize(nT * nk);
+    m_table_logkc.resize(nT * nr);
+    for (size_t j = 0; j < nT; j++) {
+        for (size_t i = 0; i < nk; i++) {
+            m_table_logkf[j * nk + i] = log(std::max(std::abs(kf[2 * j * nk + i]),
+                                                     SmallNumber));
+        }
+        for (size_t i = 0; i < nr; i++) {
+            m_table_logkc[j * nr + i] = log(std::max(kc[2 * j * nr + i],
+                                                     SmallNumber));
+        }
+    }
+    m_table_ok = true;
+
+    // Check interpolation error at the midpoints of all intervals
+    for (size_t j = 0; j < nT - 1; j++) {
+        double T = m_table_Tmin + (j + 0.5) * m_table_dT;
+        evalRateTable(T, m_rbuf1.data(), m_rbuf2.data());
+        double maxErr = 0.0;
+        size_t iMax = npos;
+        for (size_t i = 0; i < nk; i++) {
+            double k = kf[(2 * j + 1) * nk + i];
+            if (std::abs(k) > SmallNumber) {
+                double err = std::abs(m_rbuf1[m_table_rxn[i]] - k) / std::abs(k);
+                if (err > maxErr) {
+                    maxErr = err;
+                    iMax = m_table_rxn[i];
+                }
+            }
+        }
+        for (size_t i = 0; i < nr; i++) {
+            double k = kc[(2 * j + 1) * nr + i];
+            if (k > SmallNumber) {
+                double err = std::abs(m_rbuf2[m_revindex[i]] - k) / k;
+                if (err > maxErr) {
+                    maxErr = err;
+                    iMax = m_revindex[i];
+                }
+            }
+        }
+        if (maxErr > m_table_rtol) {
+            clearRateTable();
+            throw CanteraError("GasKinetics::buildRateTable",
+                "Relative interpolation error {:.3g} for reaction {} at T = {} K "
+                "exceeds tolerance of {:.3g}. Use a smaller temperature spacing.",
+                maxErr, iMax, T, m_table_rtol);
+        }
+    }
+}
+
+void GasKinetics::evalRateTable(double T, double* kf, double* rkcn)
+{
+    size_t j = std::min(static_cast<size_t>((T - m_table_Tmin) / m_table_dT),
+                        m_table_nT - 2);
+    double rT0 = 1.0 / (m_table_Tmin + j * m_table_dT);
+    double rT1 = 1.0 / (m_table_Tmin + (j + 1) * m_table_dT);
+    double w = (1.0 / T - rT0) / (rT1 - rT0);
+
+    size_t nk = m_table_rxn.size();
+    Eigen::Map<const Eigen::ArrayXd> f0(m_table_logkf.data() + j * nk, nk);
+    Eigen::Map<const Eigen::ArrayXd> f1(m_table_logkf.data() + (j + 1) * nk, nk);
+    m_table_work = (f0 + w * (f1 - f0)).exp();
+    for (size_t i = 0; i < nk; i++) {
+        kf[m_table_rxn[i]] = m_table_sign[i] * m_table_work[i];
+    }
+
+    size_t nr = m_revindex.size();
+    Eigen::Map<const Eigen::ArrayXd> g0(m_table_logkc.data() + j * nr, nr);
+    Eigen::Map<const Eigen::ArrayXd> g1(m_table_logkc.data() + (j + 1) * nr, nr);
+    m_table_work = (g0 + w * (g1 - g0)).exp();
+    for (size_t i = 0; i < nr; i++) {
+        rkcn[m_revindex[i]] = std::min(m_table_work[i], BigNumber);
+    }
+}
+
 void GasKinetics::processFwdRateCoefficients(double* ropf)
 {
     update_rates_C();
@@ -161,10 +380,20 @@ void GasKinetics::processFwdRateCoefficients(double* ropf)
     for (size_t i = 0; i < nReactions(); ++i) {
         ropf[i] *= m_perturb[i];
     }
+
+    // Rate constants of inactive reactions are not evaluated
+    if (!m_active.empty()) {
+        for (size_t i = 0; i < nReactions(); ++i) {
+            if (!m_active[i]) {
+                ropf[i] = 0.0;
+            }
+        }
+    }
 }
 
 void GasKinetics::processThirdBodies(double* rop)
 {
+    ScopedTimer timer(profiler(m_prof_thirdBodies));
     // multiply rop by enhanced 3b conc for all 3b rxns
     if (!concm_3b_values.empty()) {
         m_3b_concm.multiply(rop, concm_3b_values.data());
@@ -188,6 +417,10 @@ void GasKinetics::processEquilibriumConstants(double* rop)
 void GasKinetics::getEquilibriumConstants(doublereal* kc)
 {
     update_rates_T(); // this step ensures that m_grt is updated
+    if (m_table_used) {
+        // m_grt is not evaluated if equilibrium constants are interpolated
+        updateDeltaGibbs0();
+    }
 
     vector_fp& delta_gibbs0 = m_rbuf0;
     fill(delta_gibbs0.begin(), delta_gibbs0.end(), 0.0);
@@ -203,6 +436,7 @@ void GasKinetics::getEquilibriumConstants(doublereal* kc)
 
 void GasKinetics::processFalloffReactions(double* ropf)
 {
+    ScopedTimer timer(profiler(m_prof_falloff));
     // use m_ropr for temporary storage of reduced pressure
     vector_fp& pr = m_ropr;
 
@@ -226,16 +460,36 @@ void GasKinetics::processFalloffReactions(double* ropf)
 
 void GasKinetics::updateROP()
 {
+    ScopedTimer timer(profiler(m_prof_updateROP));
     processFwdRateCoefficients(m_ropf.data());
     processThirdBodies(m_ropf.data());
     copy(m_ropf.begin(), m_ropf.end(), m_ropr.begin());
 
-    // multiply ropf by concentration products
-    m_reactantStoich.multiply(m_act_conc.data(), m_ropf.data());
-
-    // for reversible reactions, multiply ropr by concentration products
+    // for reversible reactions, multiply ropr by the reciprocal equilibrium
+    // constants
     processEquilibriumConstants(m_ropr.data());
-    m_revProductStoich.multiply(m_act_conc.data(), m_ropr.data());
+
+    // QSS concentrations are determined after the concentration products of
+    // all other species are applied
+    for (size_t k : m_qss) {
+        m_act_conc[k] = 1.0;
+    }
+
+    {
+        ScopedTimer stoichTimer(profiler(m_prof_stoich));
+        if (m_fusedStoich) {
+            m_stoichFused.multiply(m_act_conc.data(), m_ropf.data(), m_ropr.data());
+        } else {
+            // multiply ropf by concentration products
+            m_reactantStoich.multiply(m_act_conc.data(), m_ropf.data());
+
+            // for reversible reactions, multiply ropr by concentration products
+            m_revProductStoich.multiply(m_act_conc.data(), m_ropr.data());
+        }
+    }
+    if (!m_qss.empty()) {
+        solveQuasiSteady();
+    }
     for (size_t j = 0; j != nReactions(); ++j) {
         m_ropnet[j] = m_ropf[j] - m_ropr[j];
     }
@@ -251,6 +505,350 @@ void GasKinetics::updateROP()
     m_ROP_ok = true;
 }
 
+void GasKinetics::setQuasiSteadySpecies(const vector<string>& names)
+{
+    vector<size_t> qss;
+    for (const auto& name : names) {
+        size_t k = kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("GasKinetics::setQuasiSteadySpecies",
+                               "Unknown species '{}'", name);
+        }
+        if (std::find(qss.begin(), qss.end(), k) != qss.end()) {
+            throw CanteraError("GasKinetics::setQuasiSteadySpecies",
+                               "Duplicate species '{}'", name);
+        }
+        qss.push_back(k);
+    }
+    m_qss = qss;
+    m_qss_conc.assign(m_qss.size(), 0.0);
+    m_qss_ok = false;
+    if (!m_qss.empty()) {
+        buildQuasiSteady();
+    }
+    invalidateCache();
+}
+
+void GasKinetics::setQuasiSteadyTolerances(double rtol, double atol,
+                                           size_t maxIter)
+{
+    if (rtol <= 0 || atol <= 0 || maxIter == 0) {
+        throw CanteraError("GasKinetics::setQuasiSteadyTolerances",
+            "Invalid settings: rtol = {}, atol = {}, maxIter = {}",
+            rtol, atol, maxIter);
+    }
+    m_qss_rtol = rtol;
+    m_qss_atol = atol;
+    m_qss_maxiter = maxIter;
+}
+
+void GasKinetics::getQuasiSteadyTolerances(double& rtol, double& atol,
+                                           size_t& maxIter) const
+{
+    rtol = m_qss_rtol;
+    atol = m_qss_atol;
+    maxIter = m_qss_maxiter;
+}
+
+void GasKinetics::buildQuasiSteady()
+{
+    size_t nq = m_qss.size();
+    vector<size_t> qindex(m_kk, npos);
+    for (size_t q = 0; q < nq; q++) {
+        qindex[m_qss[q]] = q;
+    }
+    vector<bool> consumed(nq, false);
+    m_qss_rxns.clear();
+    for (size_t i = 0; i < nReactions(); i++) {
+        const Reaction& R = *m_reactions[i];
+        QuasiSteadyReaction rxn;
+        rxn.rxn = i;
+        rxn.ropf = 0.0;
+        rxn.ropr = 0.0;
+        for (const auto& sp : R.orders) {
+            size_t q = qindex[kineticsSpeciesIndex(sp.first)];
+            if (q != npos) {
+                rxn.fwd.emplace_back(q, sp.second);
+            }
+        }
+        for (const auto& sp : R.reactants) {
+            size_t q = qindex[kineticsSpeciesIndex(sp.first)];
+            if (q != npos && !R.orders.count(sp.first)) {
+                rxn.fwd.emplace_back(q, sp.second);
+            }
+        }
+        if (R.reversible) {
+            for (const auto& sp : R.products) {
+                size_t q = qindex[kineticsSpeciesIndex(sp.first)];
+                if (q != npos) {
+                    rxn.rev.emplace_back(q, sp.second);
+                }
+            }
+        }
+        for (size_t q = 0; q < nq; q++) {
+            double nu = productStoichCoeff(m_qss[q], i)
+                        - reactantStoichCoeff(m_qss[q], i);
+            if (nu != 0.0) {
+                rxn.net.emplace_back(q, nu);
+            }
+        }
+        for (const auto& r : rxn.fwd) {
+            consumed[r.first] = true;
+        }
+        for (const auto& r : rxn.rev) {
+            consumed[r.first] = true;
+        }
+        if (!rxn.fwd.empty() || !rxn.rev.empty() || !rxn.net.empty()) {
+            m_qss_rxns.push_back(std::move(rxn));
+        }
+    }
+    for (size_t q = 0; q < nq; q++) {
+        if (!consumed[q]) {
+            throw CanteraError("GasKinetics::buildQuasiSteady", "Species '{}' "
+                "is not consumed by any reaction and cannot be treated as "
+                "quasi-steady.", kineticsSpeciesName(m_qss[q]));
+        }
+    }
+    m_qss_resid.resize(nq);
+    m_qss_jac.resize(nq, nq);
+    m_qss_ok = true;
+}
+
+//! Product of the QSS concentrations *c* raised to the reaction orders given
+//! in *terms*
+static double qssProduct(const vector<pair<size_t, double>>& terms,
+                         const vector_fp& c)
+{
+    double prod = 1.0;
+    for (const auto& t : terms) {
+        prod *= (t.second == 1.0) ? c[t.first] : std::pow(c[t.first], t.second);
+    }
+    return prod;
+}
+
+//! Derivative of qssProduct() with respect to term *j*
+static double qssProductDeriv(const vector<pair<size_t, double>>& terms,
+                              const vector_fp& c, size_t j)
+{
+    double prod = 1.0;
+    for (size_t n = 0; n < terms.size(); n++) {
+        double x = c[terms[n].first];
+        double order = terms[n].second;
+        if (n == j) {
+            prod *= (order == 1.0) ? 1.0 : order * std::pow(x, order - 1.0);
+        } else {
+            prod *= (order == 1.0) ? x : std::pow(x, order);
+        }
+    }
+    return prod;
+}
+
+void GasKinetics::solveQuasiSteady()
+{
+    ScopedTimer timer(profiler(m_prof_qss));
+    if (!m_qss_ok) {
+        buildQuasiSteady();
+    }
+    size_t nq = m_qss.size();
+    for (auto& R : m_qss_rxns) {
+        R.ropf = m_ropf[R.rxn];
+        R.ropr = m_ropr[R.rxn];
+    }
+
+    vector_fp& c = m_qss_conc;
+    m_qss_niter = 0;
+    while (true) {
+        m_qss_resid.setZero();
+        m_qss_jac.setZero();
+        for (const auto& R : m_qss_rxns) {
+            double rop = R.ropf * qssProduct(R.fwd, c)
+                         - R.ropr * qssProduct(R.rev, c);
+            for (const auto& n : R.net) {
+                m_qss_resid[n.first] += n.second * rop;
+                for (size_t j = 0; j < R.fwd.size(); j++) {
+                    m_qss_jac(n.first, R.fwd[j].first) +=
+                        n.second * R.ropf * qssProductDeriv(R.fwd, c, j);
+                }
+                for (size_t j = 0; j < R.rev.size(); j++) {
+                    m_qss_jac(n.first, R.rev[j].first) -=
+                        n.second * R.ropr * qssProductDeriv(R.rev, c, j);
+                }
+            }
+        }
+        for (size_t q = 0; q < nq; q++) {
+            if (m_qss_jac(q, q) == 0.0) {
+                // species is currently neither formed nor consumed
+                m_qss_jac(q, q) = -1.0;
+            }
+        }
+        Eigen::VectorXd delta = m_qss_jac.partialPivLu().solve(-m_qss_resid);
+        bool converged = true;
+        for (size_t q = 0; q < nq; q++) {
+            double cNew = c[q] + delta[q];
+            if (!std::isfinite(cNew)) {
+                throw CanteraError("GasKinetics::solveQuasiSteady",
+                    "Non-finite concentration of QSS species '{}'",
+                    kineticsSpeciesName(m_qss[q]));
+            }
+            if (cNew < 0.0) {
+                // Keep concentrations positive by taking a partial step
+                cNew = 0.1 * c[q];
+            }
+            if (std::abs(cNew - c[q]) > m_qss_rtol * cNew + m_qss_atol) {
+                converged = false;
+            }
+            c[q] = cNew;
+        }
+        m_qss_niter++;
+        if (converged) {
+            break;
+        } else if (m_qss_niter == m_qss_maxiter) {
+            throw CanteraError("GasKinetics::solveQuasiSteady", "Concentrations "
+                "of QSS species did not converge in {} iterations.",
+                m_qss_maxiter);
+        }
+    }
+
+    for (const auto& R : m_qss_rxns) {
+        m_ropf[R.rxn] = R.ropf * qssProduct(R.fwd, c);
+        m_ropr[R.rxn] = R.ropr * qssProduct(R.rev, c);
+    }
+    for (size_t q = 0; q < nq; q++) {
+        m_act_conc[m_qss[q]] = c[q];
+    }
+}
+
+void GasKinetics::getNetProductionRatesBatch(size_t nStates, const double* T,
+                                             const double* P, const double* conc,
+                                             double* wdot)
+{
+    size_t nsp = nTotalSpecies();
+    size_t nrxn = nReactions();
+
+    // Rate and equilibrium constants are evaluated for all states at once if
+    // they do not depend on the state of the ThermoPhase object
+    bool batch = m_legacy.empty() && m_qss.empty()
+                 && thermo().type() == "IdealGas";
+    for (const auto& rates : m_bulk_rates) {
+        batch &= rates->hasBatchEvaluation();
+    }
+    if (!batch) {
+        // Evaluate states one at a time, where the pressure is determined by
+        // the temperature and the concentrations
+        thermo().saveState(m_state);
+        for (size_t m = 0; m < nStates; m++) {
+            for (size_t k = 0; k < nsp; k++) {
+                m_sbuf0[k] = conc[k * nStates + m];
+            }
+            thermo().setConcentrationsNoNorm(m_sbuf0.data());
+            thermo().setTemperature(T[m]);
+            getNetProductionRates(m_sbuf0.data());
+            for (size_t k = 0; k < nsp; k++) {
+                wdot[k * nStates + m] = m_sbuf0[k];
+            }
+        }
+        thermo().restoreState(m_state);
+        invalidateCache();
+        return;
+    }
+
+    m_batch_ropf.assign(nrxn * nStates, 0.0);
+    m_batch_ropr.resize(nrxn * nStates);
+    m_batch_rkcn.resize(nrxn * nStates);
+    m_batch_concm.resize(nrxn * nStates);
+    m_batch_ctot.assign(nStates, 0.0);
+
+    // Third-body concentrations, which are also used by falloff rates
+    for (size_t k = 0; k < nsp; k++) {
+        const double* c = conc + k * nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            m_batch_ctot[m] += c[m];
+        }
+    }
+    if (!m_concm.empty()) {
+        m_multi_concm.update(conc, m_batch_ctot.data(), m_batch_concm.data(),
+                             nStates);
+    }
+
+    // Forward rate constants, scaled by the perturbation factors
+    for (auto& rates : m_bulk_rates) {
+        rates->getRateConstantsBatch(nStates, T, P, m_batch_concm.data(),
+                                     m_batch_ropf.data());
+    }
+    for (size_t i = 0; i < nrxn; i++) {
+        double f = (m_active.empty() || m_active[i]) ? m_perturb[i] : 0.0;
+        double* kf = m_batch_ropf.data() + i * nStates;
+        for (size_t m = 0; m < nStates; m++) {
+            kf[m] *= f;
+        }
+    }
+    updateKcBatch(nStates, T);
+
+    // Law of mass action
+    if (!m_concm.empty()) {
+        m_multi_concm.multiply(m_batch_ropf.data(), m_batch_concm.data(), nStates);
+    }
+    for (size_t j = 0; j < nrxn * nStates; j++) {
+        m_batch_ropr[j] = m_batch_ropf[j] * m_batch_rkcn[j];
+    }
+    // activity concentrations of an ideal gas are the molar concentrations
+    m_reactantStoich.multiply(conc, m_batch_ropf.data(), nStates);
+    m_revProductStoich.multiply(conc, m_batch_ropr.data(), nStates);
+    for (size_t j = 0; j < nrxn * nStates; j++) {
+        AssertFinite(m_batch_ropf[j], "GasKinetics::getNetProductionRatesBatch",
+                     "ropf[{}] is not finite.", j);
+        AssertFinite(m_batch_ropr[j], "GasKinetics::getNetProductionRatesBatch",
+                     "ropr[{}] is not finite.", j);
+        m_batch_ropf[j] -= m_batch_ropr[j];
+    }
+
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+        RowMatrix;
+    Eigen::Map<const RowMatrix> ropnet(m_batch_ropf.data(), nrxn, nStates);
+    Eigen::Map<RowMatrix> out(wdot, nsp, nStates);
+    out.noalias() = m_stoichMatrix * ropnet;
+}
+
+void GasKinetics::updateKcBatch(size_t nStates, const double* T)
+{
+    // Gibbs functions of the species in the reference state. The pressure
+    // dependence of the standard chemical potentials cancels with that of the
+    // standard concentrations.
+    size_t nsp = nTotalSpecies();
+    size_t nrxn = nReactions();
+    m_batch_grt.resize(nsp * nStates);
+    vector_fp cp_R(nsp), h_RT(nsp), s_R(nsp);
+    const MultiSpeciesThermo& spthermo = thermo().speciesThermo();
+    for (size_t m = 0; m < nStates; m++) {
+        spthermo.update(T[m], cp_R.data(), h_RT.data(), s_R.data());
+        for (size_t k = 0; k < nsp; k++) {
+            m_batch_grt[k * nStates + m] = h_RT[k] - s_R[k];
+        }
+    }
+
+    // Delta G^0 / RT of all reactions, which equals the difference between
+    // products of the reverse reaction and reactants for reversible reactions
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+        RowMatrix;
+    Eigen::Map<const RowMatrix> grt(m_batch_grt.data(), nsp, nStates);
+    Eigen::Map<RowMatrix> rkcn(m_batch_rkcn.data(), nrxn, nStates);
+    rkcn.noalias() = m_stoichMatrix.transpose() * grt;
+
+    // log of the standard concentration in the reference state
+    Eigen::Map<const Eigen::ArrayXd> temp(T, nStates);
+    Eigen::ArrayXd logStandConc =
+        (thermo().refPressure() / GasConstant * temp.inverse()).log();
+    for (size_t i = 0; i < m_revindex.size(); i++) {
+        size_t irxn = m_revindex[i];
+        auto row = rkcn.row(irxn).array();
+        row = (row - m_dn[irxn] * logStandConc.transpose()).exp()
+              .min(BigNumber);
+    }
+    for (size_t i = 0; i < m_irrev.size(); i++) {
+        rkcn.row(m_irrev[i]).setZero();
+    }
+}
+
 void GasKinetics::getFwdRateConstants(double* kfwd)
 {
     processFwdRateCoefficients(m_ropf.data());
@@ -306,37 +904,24 @@ void GasKinetics::assertDerivativesValid(const std::string& name)
 
 void GasKinetics::processEquilibriumConstants_ddT(double* drkcn)
 {
-    double T = thermo().temperature();
-    double P = thermo().pressure();
-    double rrt = 1. / thermo().RT();
-
-    vector_fp& grt = m_sbuf0;
-    vector_fp& delta_gibbs0 = m_rbuf1;
-    fill(delta_gibbs0.begin(), delta_gibbs0.end(), 0.0);
+    // The temperature derivative of the inverse equilibrium constant follows
+    // from the van 't Hoff equation,
+    //     d ln(1/Kc) / dT = (Delta n - Delta H^0 / RT) / T,
+    // using the standard state enthalpies of the species
+    double Tinv = 1. / thermo().temperature();
+    vector_fp& hrt = m_sbuf0;
+    vector_fp& delta_h0 = m_rbuf1;
+    thermo().getEnthalpy_RT(hrt.data());
+    getRevReactionDelta(hrt.data(), delta_h0.data());
 
-    // compute perturbed Delta G^0 for all reversible reactions
-    thermo().saveState(m_state);
-    thermo().setState_TP(T * (1. + m_jac_rtol_delta), P);
-    thermo().getStandardChemPotentials(grt.data());
-    getRevReactionDelta(grt.data(), delta_gibbs0.data());
-
-    // apply scaling for derivative of inverse equilibrium constant
-    double Tinv = 1. / T;
-    double rrt_dTinv = rrt * Tinv / m_jac_rtol_delta;
-    double rrtt = rrt * Tinv;
     for (size_t i = 0; i < m_revindex.size(); i++) {
         size_t irxn = m_revindex[i];
-        double factor = delta_gibbs0[irxn] - m_delta_gibbs0[irxn];
-        factor *= rrt_dTinv;
-        factor += m_dn[irxn] * Tinv - m_delta_gibbs0[irxn] * rrtt;
-        drkcn[irxn] *= factor;
+        drkcn[irxn] *= (m_dn[irxn] - delta_h0[irxn]) * Tinv;
     }
 
     for (size_t i = 0; i < m_irrev.size(); ++i) {
         drkcn[m_irrev[i]] = 0.0;
     }
-
-    thermo().restoreState(m_state);
 }
 
 void GasKinetics::process_ddT(const vector_fp& in, double* drop)
@@ -577,7 +1162,10 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
     bool added = BulkKinetics::addReaction(r, resize);
     if (!added) {
         return false;
-    } else if (!(r->usesLegacy())) {
+    }
+    m_table_ok = false;
+    m_qss_ok = false;
+    if (!(r->usesLegacy())) {
         // Rate object already added in BulkKinetics::addReaction
         return true;
     }
@@ -666,6 +1254,8 @@ void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 
     // invalidate all cached data
     invalidateCache();
+    m_table_ok = false;
+    m_qss_ok = false;
 
     if (!(rNew->usesLegacy())) {
         // Rate object already modified in BulkKinetics::modifyReaction
@@ -690,6 +1280,13 @@ void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
     }
 }
 
+void GasKinetics::resizeSpecies()
+{
+    BulkKinetics::resizeSpecies();
+    // species indices used by the QSS reactions need to be rebuilt
+    m_qss_ok = false;
+}
+
 void GasKinetics::modifyThreeBodyReaction(size_t i, ThreeBodyReaction2& r)
 {
     m_rates.replace(i, r.rate);
@@ -28,12 +28,18 @@ InterfaceKinetics::InterfaceKinetics(ThermoPhase* thermo) :
     m_has_electrochem_rxns(false),
     m_has_exchange_current_density_formulation(false),
     m_phaseExistsCheck(false),
+    m_phaseWords(0),
     m_ioFlag(0),
     m_nDim(2)
 {
     if (thermo != 0) {
         addPhase(*thermo);
     }
+    m_prof_updateROP = addProfilingSection("updateROP");
+    m_prof_rates_T = addProfilingSection("_update_rates_T");
+    m_prof_rates_C = addProfilingSection("_update_rates_C");
+    m_prof_updateKc = addProfilingSection("updateKc");
+    m_prof_stoich = addProfilingSection("StoichManagerN::multiply");
 }
 
 InterfaceKinetics::~InterfaceKinetics()
@@ -49,6 +55,7 @@ void InterfaceKinetics::setElectricPotential(int n, doublereal V)
 
 void InterfaceKinetics::_update_rates_T()
 {
+    ScopedTimer timer(profiler(m_prof_rates_T));
     // First task is update the electrical potentials from the Phases
     _update_rates_phi();
     if (m_has_coverage_dependence) {
@@ -87,6 +94,8 @@ void InterfaceKinetics::_update_rates_T()
         updateKc();
         m_ROP_ok = false;
         m_redo_rates = false;
+    } else {
+        timer.hit();
     }
 }
 
@@ -103,6 +112,7 @@ void InterfaceKinetics::_update_rates_phi()
 
 void InterfaceKinetics::_update_rates_C()
 {
+    ScopedTimer timer(profiler(m_prof_rates_C));
     for (size_t n = 0; n < nPhases(); n++) {
         const ThermoPhase* tp = m_thermo[n];
         /*
@@ -128,6 +138,7 @@ void InterfaceKinetics::getActivityConcentrations(doublereal* const conc)
 
 void InterfaceKinetics::updateKc()
 {
+    ScopedTimer timer(profiler(m_prof_updateKc));
     fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
 
     if (m_revindex.size() > 0) {
@@ -300,6 +311,7 @@ void InterfaceKinetics::getRevRateConstants(doublereal* krev, bool doIrreversibl
 
 void InterfaceKinetics::updateROP()
 {
+    ScopedTimer timer(profiler(m_prof_updateROP));
     // evaluate rate constants and equilibrium constants at temperature and phi
     // (electric potential)
     _update_rates_T();
@@ -307,6 +319,7 @@ void InterfaceKinetics::updateROP()
     _update_rates_C();
 
     if (m_ROP_ok) {
+        timer.hit();
         return;
     }
 
@@ -318,13 +331,20 @@ void InterfaceKinetics::updateROP()
         m_ropr[i] = m_ropf[i] * m_rkcn[i];
     }
 
-    // multiply ropf by the activity concentration reaction orders to obtain
-    // the forward rates of progress.
-    m_reactantStoich.multiply(m_actConc.data(), m_ropf.data());
+    {
+        ScopedTimer stoichTimer(profiler(m_prof_stoich));
+        if (m_fusedStoich) {
+            m_stoichFused.multiply(m_actConc.data(), m_ropf.data(), m_ropr.data());
+        } else {
+            // multiply ropf by the activity concentration reaction orders to
+            // obtain the forward rates of progress.
+            m_reactantStoich.multiply(m_actConc.data(), m_ropf.data());
 
-    // For reversible reactions, multiply ropr by the activity concentration
-    // products
-    m_revProductStoich.multiply(m_actConc.data(), m_ropr.data());
+            // For reversible reactions, multiply ropr by the activity
+            // concentration products
+            m_revProductStoich.multiply(m_actConc.data(), m_ropr.data());
+        }
+    }
 
     for (size_t j = 0; j != nReactions(); ++j) {
         m_ropnet[j] = m_ropf[j] - m_ropr[j];
@@ -336,44 +356,40 @@ void InterfaceKinetics::updateROP()
     // activity
     if (m_phaseExistsCheck) {
         for (size_t j = 0; j != nReactions(); ++j) {
+            const uint64_t* reac = &m_rxnPhaseIsReactant[j * m_phaseWords];
+            const uint64_t* prod = &m_rxnPhaseIsProduct[j * m_phaseWords];
+            uint64_t reacMissing = 0, prodMissing = 0;
+            uint64_t reacUnstable = 0, prodUnstable = 0;
+            for (size_t w = 0; w < m_phaseWords; w++) {
+                reacMissing |= reac[w] & m_phaseMissing[w];
+                prodMissing |= prod[w] & m_phaseMissing[w];
+                reacUnstable |= reac[w] & m_phaseUnstable[w];
+                prodUnstable |= prod[w] & m_phaseUnstable[w];
+            }
             if ((m_ropr[j] > m_ropf[j]) && (m_ropr[j] > 0.0)) {
-                for (size_t p = 0; p < nPhases(); p++) {
-                    if (m_rxnPhaseIsProduct[j][p] && !m_phaseExists[p]) {
-                        m_ropnet[j] = 0.0;
-                        m_ropr[j] = m_ropf[j];
-                        if (m_ropf[j] > 0.0) {
-                            for (size_t rp = 0; rp < nPhases(); rp++) {
-                                if (m_rxnPhaseIsReactant[j][rp] && !m_phaseExists[rp]) {
-                                    m_ropnet[j] = 0.0;
-                                    m_ropr[j] = m_ropf[j] = 0.0;
-                                }
-                            }
-                        }
-                    }
-                    if (m_rxnPhaseIsReactant[j][p] && !m_phaseIsStable[p]) {
-                        m_ropnet[j] = 0.0;
-                        m_ropr[j] = m_ropf[j];
+                if (prodMissing) {
+                    m_ropnet[j] = 0.0;
+                    m_ropr[j] = m_ropf[j];
+                    if (m_ropf[j] > 0.0 && reacMissing) {
+                        m_ropr[j] = m_ropf[j] = 0.0;
                     }
                 }
+                if (reacUnstable) {
+                    m_ropnet[j] = 0.0;
+                    m_ropr[j] = m_ropf[j];
+                }
             } else if ((m_ropf[j] > m_ropr[j]) && (m_ropf[j] > 0.0)) {
-                for (size_t p = 0; p < nPhases(); p++) {
-                    if (m_rxnPhaseIsReactant[j][p] && !m_phaseExists[p]) {
-                        m_ropnet[j] = 0.0;
-                        m_ropf[j] = m_ropr[j];
-                        if (m_ropf[j] > 0.0) {
-                            for (size_t rp = 0; rp < nPhases(); rp++) {
-                                if (m_rxnPhaseIsProduct[j][rp] && !m_phaseExists[rp]) {
-                                    m_ropnet[j] = 0.0;
-                                    m_ropf[j] = m_ropr[j] = 0.0;
-                                }
-                            }
-                        }
-                    }
-                    if (m_rxnPhaseIsProduct[j][p] && !m_phaseIsStable[p]) {
-                        m_ropnet[j] = 0.0;
-                        m_ropf[j] = m_ropr[j];
+                if (reacMissing) {
+                    m_ropnet[j] = 0.0;
+                    m_ropf[j] = m_ropr[j];
+                    if (m_ropf[j] > 0.0 && prodMissing) {
+                        m_ropf[j] = m_ropr[j] = 0.0;
                     }
                 }
+                if (prodUnstable) {
+                    m_ropnet[j] = 0.0;
+                    m_ropf[j] = m_ropr[j];
+                }
             }
         }
     }
@@ -503,19 +519,7 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base, bool resize)
             m_irrev.push_back(i);
         }
 
-        m_rxnPhaseIsReactant.emplace_back(nPhases(), false);
-        m_rxnPhaseIsProduct.emplace_back(nPhases(), false);
-
-        for (const auto& sp : r.reactants) {
-            size_t k = kineticsSpeciesIndex(sp.first);
-            size_t p = speciesPhaseIndex(k);
-            m_rxnPhaseIsReactant[i][p] = true;
-        }
-        for (const auto& sp : r.products) {
-            size_t k = kineticsSpeciesIndex(sp.first);
-            size_t p = speciesPhaseIndex(k);
-            m_rxnPhaseIsProduct[i][p] = true;
-        }
+        setReactionPhases(i, r);
 
     } else {
         InterfaceReaction& r = dynamic_cast<InterfaceReaction&>(*r_base);
@@ -544,19 +548,7 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base, bool resize)
             m_irrev.push_back(i);
         }
 
-        m_rxnPhaseIsReactant.emplace_back(nPhases(), false);
-        m_rxnPhaseIsProduct.emplace_back(nPhases(), false);
-
-        for (const auto& sp : r.reactants) {
-            size_t k = kineticsSpeciesIndex(sp.first);
-            size_t p = speciesPhaseIndex(k);
-            m_rxnPhaseIsReactant[i][p] = true;
-        }
-        for (const auto& sp : r.products) {
-            size_t k = kineticsSpeciesIndex(sp.first);
-            size_t p = speciesPhaseIndex(k);
-            m_rxnPhaseIsProduct[i][p] = true;
-        }
+        setReactionPhases(i, r);
     }
     deltaElectricEnergy_.push_back(0.0);
     m_deltaG0.push_back(0.0);
@@ -566,6 +558,39 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base, bool resize)
     return true;
 }
 
+void InterfaceKinetics::setReactionPhases(size_t i, const Reaction& r)
+{
+    if (i == 0) {
+        // all phases have been added when the first reaction is added
+        m_phaseWords = (nPhases() + 63) / 64;
+        m_phaseMissing.resize(m_phaseWords, 0);
+        m_phaseUnstable.resize(m_phaseWords, 0);
+    }
+    m_rxnPhaseIsReactant.resize((i + 1) * m_phaseWords, 0);
+    m_rxnPhaseIsProduct.resize((i + 1) * m_phaseWords, 0);
+    for (const auto& sp : r.reactants) {
+        size_t p = speciesPhaseIndex(kineticsSpeciesIndex(sp.first));
+        m_rxnPhaseIsReactant[i * m_phaseWords + p / 64] |= uint64_t(1) << (p % 64);
+    }
+    for (const auto& sp : r.products) {
+        size_t p = speciesPhaseIndex(kineticsSpeciesIndex(sp.first));
+        m_rxnPhaseIsProduct[i * m_phaseWords + p / 64] |= uint64_t(1) << (p % 64);
+    }
+}
+
+void InterfaceKinetics::setPhaseBit(std::vector<uint64_t>& bits, size_t p,
+                                    bool value)
+{
+    if (bits.size() <= p / 64) {
+        bits.resize(p / 64 + 1, 0);
+    }
+    if (value) {
+        bits[p / 64] |= uint64_t(1) << (p % 64);
+    } else {
+        bits[p / 64] &= ~(uint64_t(1) << (p % 64));
+    }
+}
+
 void InterfaceKinetics::modifyReaction(size_t i, shared_ptr<Reaction> r_base)
 {
     Kinetics::modifyReaction(i, r_base);
@@ -881,6 +906,8 @@ void InterfaceKinetics::setPhaseExistence(const size_t iphase, const int exists)
         }
         m_phaseIsStable[iphase] = false;
     }
+    setPhaseBit(m_phaseMissing, iphase, !exists);
+    setPhaseBit(m_phaseUnstable, iphase, !exists);
 }
 
 int InterfaceKinetics::phaseExistence(const size_t iphase) const
@@ -903,6 +930,7 @@ void InterfaceKinetics::setPhaseStability(const size_t iphase, const int isStabl
     } else {
         m_phaseIsStable[iphase] = false;
     }
+    setPhaseBit(m_phaseUnstable, iphase, !isStable);
 }
 
 void InterfaceKinetics::applyStickingCorrection(double T, double* kf)
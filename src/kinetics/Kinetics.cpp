@@ -17,6 +17,7 @@
 #include "cantera/base/utilities.h"
 #include "cantera/base/global.h"
 #include <unordered_set>
+#include <unordered_map>
 #include <boost/algorithm/string/join.hpp>
 
 using namespace std;
@@ -24,6 +25,7 @@ using namespace std;
 namespace Cantera
 {
 Kinetics::Kinetics() :
+    m_fusedStoich(false),
     m_ready(false),
     m_kk(0),
     m_thermo(0),
@@ -31,12 +33,50 @@ Kinetics::Kinetics() :
     m_rxnphase(npos),
     m_mindim(4),
     m_skipUndeclaredSpecies(false),
-    m_skipUndeclaredThirdBodies(false)
+    m_skipUndeclaredThirdBodies(false),
+    m_profiling(false)
 {
 }
 
 Kinetics::~Kinetics() {}
 
+void Kinetics::setProfiling(bool enable)
+{
+    m_profiling = enable;
+    resetProfiling();
+}
+
+void Kinetics::resetProfiling()
+{
+    for (auto& counter : m_profile) {
+        counter.reset();
+    }
+}
+
+AnyMap Kinetics::profilingReport() const
+{
+    AnyMap report;
+    for (const auto& counter : m_profile) {
+        AnyMap section;
+        section["calls"] = static_cast<long int>(counter.calls);
+        section["cache-hits"] = static_cast<long int>(counter.hits);
+        section["time"] = counter.time;
+        report[counter.name] = std::move(section);
+    }
+    return report;
+}
+
+size_t Kinetics::addProfilingSection(const std::string& name)
+{
+    for (size_t i = 0; i < m_profile.size(); i++) {
+        if (m_profile[i].name == name) {
+            return i;
+        }
+    }
+    m_profile.emplace_back(name);
+    return m_profile.size() - 1;
+}
+
 void Kinetics::checkReactionIndex(size_t i) const
 {
     if (i >= nReactions()) {
@@ -60,6 +100,7 @@ void Kinetics::resizeReactions()
     m_stoichMatrix = m_productStoich.stoichCoeffs();
     // reactants are destroyed for positive net rate of progress
     m_stoichMatrix -= m_reactantStoich.stoichCoeffs();
+    m_stoichFused.resizeCoeffs(m_stoichMatrix);
 
     m_ready = true;
 }
@@ -102,9 +143,27 @@ void Kinetics::checkSpeciesArraySize(size_t kk) const
 
 std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
 {
-    //! Map of (key indicating participating species) to reaction numbers
-    std::map<size_t, std::vector<size_t> > participants;
-    std::vector<std::map<int, double> > net_stoich;
+    //! Hash for the canonical participant lists used as keys below
+    struct ParticipantHash {
+        size_t operator()(const std::vector<int>& key) const {
+            size_t h = key.size();
+            for (int k : key) {
+                h ^= std::hash<int>()(k) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            }
+            return h;
+        }
+    };
+
+    //! Map of (key indicating participating species) to reaction numbers. The
+    //! key consists of the sorted indices of the species on each side of the
+    //! reaction, with the lexicographically smaller side first and preceded by
+    //! its length. Reactions can only be duplicates of one another if they have
+    //! the same key, irrespective of their direction and of any scaling of
+    //! their stoichiometric coefficients.
+    std::unordered_map<std::vector<int>, std::vector<size_t>,
+                       ParticipantHash> participants;
+    participants.reserve(m_reactions.size());
+    std::vector<std::map<int, double> > net_stoich(m_reactions.size());
     std::unordered_set<size_t> unmatched_duplicates;
     for (size_t i = 0; i < m_reactions.size(); i++) {
         if (m_reactions[i]->duplicate) {
@@ -112,24 +171,61 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
         }
     }
 
+    // Check for non-zero third body efficiencies for any species in both
+    // reactions, considering only the explicitly listed species and the
+    // default efficiencies rather than all species of the mechanism
+    auto thirdBodiesOverlap = [this](const ThirdBody& tb1, const ThirdBody& tb2) {
+        size_t nListed = 0;
+        for (const auto& eff : tb1.efficiencies) {
+            if (kineticsSpeciesIndex(eff.first) == npos) {
+                continue;
+            }
+            nListed++;
+            if (eff.second * tb2.efficiency(eff.first) != 0.0) {
+                return true;
+            }
+        }
+        for (const auto& eff : tb2.efficiencies) {
+            if (tb1.efficiencies.count(eff.first)
+                || kineticsSpeciesIndex(eff.first) == npos) {
+                continue;
+            }
+            nListed++;
+            if (tb1.default_efficiency * eff.second != 0.0) {
+                return true;
+            }
+        }
+        return nListed < nTotalSpecies()
+            && tb1.default_efficiency * tb2.default_efficiency != 0.0;
+    };
+
+    std::vector<int> rkey, pkey, key;
     for (size_t i = 0; i < m_reactions.size(); i++) {
         // Get data about this reaction
-        unsigned long int key = 0;
         Reaction& R = *m_reactions[i];
-        net_stoich.emplace_back();
-        std::map<int, double>& net = net_stoich.back();
+        std::map<int, double>& net = net_stoich[i];
+        rkey.clear();
+        pkey.clear();
         for (const auto& sp : R.reactants) {
             int k = static_cast<int>(kineticsSpeciesIndex(sp.first));
-            key += k*(k+1);
+            rkey.push_back(k);
             net[-1 -k] -= sp.second;
         }
         for (const auto& sp : R.products) {
             int k = static_cast<int>(kineticsSpeciesIndex(sp.first));
-            key += k*(k+1);
+            pkey.push_back(k);
             net[1+k] += sp.second;
         }
+        std::sort(rkey.begin(), rkey.end());
+        std::sort(pkey.begin(), pkey.end());
+        if (pkey < rkey) {
+            std::swap(rkey, pkey);
+        }
+        key.assign(1, static_cast<int>(rkey.size()));
+        key.insert(key.end(), rkey.begin(), rkey.end());
+        key.insert(key.end(), pkey.begin(), pkey.end());
 
-        // Compare this reaction to others with similar participants
+        // Compare this reaction to others with the same participants
         vector<size_t>& related = participants[key];
         for (size_t m : related) {
             Reaction& other = *m_reactions[m];
@@ -154,65 +250,25 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
                        R.type() == "chemically-activated-legacy") {
                 ThirdBody& tb1 = dynamic_cast<FalloffReaction2&>(R).third_body;
                 ThirdBody& tb2 = dynamic_cast<FalloffReaction2&>(other).third_body;
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
+                if (!thirdBodiesOverlap(tb1, tb2)) {
                     continue; // No overlap in third body efficiencies
                 }
             } else if (R.type() == "falloff" || R.type() == "chemically-activated") {
                 auto tb1 = dynamic_cast<FalloffReaction3&>(R).thirdBody();
                 auto tb2 = dynamic_cast<FalloffReaction3&>(other).thirdBody();
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1->efficiency(s) * tb2->efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
+                if (!thirdBodiesOverlap(*tb1, *tb2)) {
                     continue; // No overlap in third body efficiencies
                 }
             } else if (R.type() == "three-body") {
                 ThirdBody& tb1 = *(dynamic_cast<ThreeBodyReaction3&>(R).thirdBody());
                 ThirdBody& tb2 = *(dynamic_cast<ThreeBodyReaction3&>(other).thirdBody());
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
+                if (!thirdBodiesOverlap(tb1, tb2)) {
                     continue; // No overlap in third body efficiencies
                 }
             } else if (R.type() == "three-body-legacy") {
                 ThirdBody& tb1 = dynamic_cast<ThreeBodyReaction2&>(R).third_body;
                 ThirdBody& tb2 = dynamic_cast<ThreeBodyReaction2&>(other).third_body;
-                bool thirdBodyOk = true;
-                for (size_t k = 0; k < nTotalSpecies(); k++) {
-                    string s = kineticsSpeciesName(k);
-                    if (tb1.efficiency(s) * tb2.efficiency(s) != 0.0) {
-                        // non-zero third body efficiencies for species `s` in
-                        // both reactions
-                        thirdBodyOk = false;
-                        break;
-                    }
-                }
-                if (thirdBodyOk) {
+                if (!thirdBodiesOverlap(tb1, tb2)) {
                     continue; // No overlap in third body efficiencies
                 }
             }
@@ -226,7 +282,7 @@ std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
                 return {i,m};
             }
         }
-        participants[key].push_back(i);
+        related.push_back(i);
     }
     if (unmatched_duplicates.size()) {
         size_t i = *unmatched_duplicates.begin();
@@ -485,6 +541,11 @@ void Kinetics::getNetProductionRates(doublereal* net)
 {
     updateROP();
 
+    if (m_fusedStoich) {
+        m_stoichFused.netProductionRates(m_ropnet.data(), net);
+        return;
+    }
+
     fill(net, net + m_kk, 0.0);
     // products are created for positive net rate of progress
     m_productStoich.incrementSpecies(m_ropnet.data(), net);
@@ -724,6 +785,9 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r, bool resize)
     m_productStoich.add(irxn, pk, pstoich, pstoich);
     if (r->reversible) {
         m_revProductStoich.add(irxn, pk, pstoich, pstoich);
+        m_stoichFused.add(irxn, rk, rorder, rstoich, pk, pstoich);
+    } else {
+        m_stoichFused.add(irxn, rk, rorder, rstoich, {}, {});
     }
 
     m_reactions.push_back(r);
@@ -734,6 +798,9 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r, bool resize)
     m_ropr.push_back(0.0);
     m_ropnet.push_back(0.0);
     m_perturb.push_back(1.0);
+    if (!m_active.empty()) {
+        m_active.push_back(true);
+    }
     m_dH.push_back(0.0);
 
     if (resize) {
@@ -10,8 +10,10 @@
 #include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/kinetics/EdgeKinetics.h"
 #include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/ReactionFactory.h"
 #include "cantera/base/xml.h"
 #include "cantera/base/stringUtils.h"
+#include <thread>
 
 using namespace std;
 
@@ -98,6 +100,49 @@ unique_ptr<Kinetics> newKinetics(const std::vector<ThermoPhase*>& phases,
     }
 }
 
+namespace {
+
+//! Minimum number of reactions handled by each thread in createReactions()
+const size_t reactionsPerThread = 500;
+
+//! Create Reaction objects for the reaction entries in `nodes`, distributing
+//! the work over multiple threads for large mechanisms. The reaction created
+//! for `nodes[i]` is stored in `rxns[i]`; if creating the reaction fails, the
+//! exception is stored in `errors[i]` instead.
+void createReactions(const vector<AnyMap>& nodes, const Kinetics& kin,
+                     vector<shared_ptr<Reaction>>& rxns,
+                     vector<std::exception_ptr>& errors)
+{
+    auto create = [&](size_t start, size_t stop) {
+        for (size_t j = start; j < stop; j++) {
+            try {
+                rxns[j] = newReaction(nodes[j], kin);
+            } catch (...) {
+                errors[j] = std::current_exception();
+            }
+        }
+    };
+
+    size_t nThreads = std::min<size_t>(std::thread::hardware_concurrency(),
+                                       nodes.size() / reactionsPerThread);
+    if (nThreads < 2) {
+        create(0, nodes.size());
+        return;
+    }
+
+    vector<std::thread> threads;
+    size_t chunk = (nodes.size() + nThreads - 1) / nThreads;
+    for (size_t n = 0; n < nThreads; n++) {
+        threads.emplace_back(create, n * chunk,
+                             std::min(nodes.size(), (n + 1) * chunk));
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+}
+
 void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode)
 {
     kin.skipUndeclaredThirdBodies(
@@ -168,31 +213,43 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
                 rules[i], sections[i]);
         }
         const auto& slash = boost::ifind_last(sections[i], "/");
+        AnyMap reactions;
+        const vector<AnyMap>* nodes;
+        bool aggregateErrors;
         if (slash) {
             // specified section is in a different file
             string fileName (sections[i].begin(), slash.begin());
             string node(slash.end(), sections[i].end());
-            AnyMap reactions = AnyMap::fromYamlFile(fileName,
+            reactions = AnyMap::fromYamlFile(fileName,
                 rootNode.getString("__file__", ""));
-            for (const auto& R : reactions[node].asVector<AnyMap>()) {
-                try {
-                    kin.addReaction(newReaction(R, kin), false);
-                } catch (CanteraError& err) {
-                    fmt_append(add_rxn_err, "{}", err.what());
-                }
-            }
+            nodes = &reactions[node].asVector<AnyMap>();
+            aggregateErrors = true;
         } else {
             // specified section is in the current file
-            for (const auto& R : rootNode.at(sections[i]).asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
+            nodes = &rootNode.at(sections[i]).asVector<AnyMap>();
+            #ifdef NDEBUG
+                aggregateErrors = true;
+            #else
+                aggregateErrors = false;
+            #endif
+        }
+
+        // Reaction objects are created concurrently, and then added to the
+        // Kinetics object sequentially in the order of the input file
+        vector<shared_ptr<Reaction>> rxns(nodes->size());
+        vector<std::exception_ptr> errors(nodes->size());
+        createReactions(*nodes, kin, rxns, errors);
+        for (size_t j = 0; j < rxns.size(); j++) {
+            try {
+                if (errors[j]) {
+                    std::rethrow_exception(errors[j]);
+                }
+                kin.addReaction(rxns[j], false);
+            } catch (CanteraError& err) {
+                if (!aggregateErrors) {
+                    throw;
+                }
+                fmt_append(add_rxn_err, "{}", err.what());
             }
         }
     }
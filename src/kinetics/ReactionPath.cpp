@@ -11,6 +11,7 @@
 #include "cantera/thermo/ThermoPhase.h"
 
 #include <boost/algorithm/string.hpp>
+#include <queue>
 
 namespace ba = boost::algorithm;
 
@@ -817,4 +818,197 @@ int ReactionPathBuilder::build(Kinetics& s, const string& element,
     return 1;
 }
 
+DirectedRelationGraph::DirectedRelationGraph(Kinetics& kin, const string& method)
+    : m_kin(&kin)
+    , m_method(method)
+{
+    if (method != "DRG" && method != "DRGEP") {
+        throw CanteraError("DirectedRelationGraph::DirectedRelationGraph",
+                           "Unknown method '{}'", method);
+    }
+    size_t nsp = kin.nTotalSpecies();
+    size_t nr = kin.nReactions();
+
+    // Participating species and net stoichiometric coefficients
+    Eigen::SparseMatrix<double> reactants = kin.reactantStoichCoeffs();
+    Eigen::SparseMatrix<double> products = kin.productStoichCoeffs();
+    m_part0.assign(1, 0);
+    for (size_t i = 0; i < nr; i++) {
+        map<size_t, double> nu;
+        int col = static_cast<int>(i);
+        for (Eigen::SparseMatrix<double>::InnerIterator it(reactants, col); it; ++it) {
+            nu[it.row()] -= it.value();
+        }
+        for (Eigen::SparseMatrix<double>::InnerIterator it(products, col); it; ++it) {
+            nu[it.row()] += it.value();
+        }
+        for (const auto& item : nu) {
+            m_partSpecies.push_back(item.first);
+            m_partNu.push_back(item.second);
+        }
+        m_part0.push_back(m_partSpecies.size());
+    }
+
+    // Edges connect all pairs of species participating in the same reaction
+    vector<map<size_t, size_t>> adjacent(nsp);
+    for (size_t i = 0; i < nr; i++) {
+        for (size_t a = m_part0[i]; a < m_part0[i+1]; a++) {
+            for (size_t b = m_part0[i]; b < m_part0[i+1]; b++) {
+                if (a != b) {
+                    adjacent[m_partSpecies[a]][m_partSpecies[b]] = 0;
+                }
+            }
+        }
+    }
+    m_edge0.assign(1, 0);
+    for (size_t k = 0; k < nsp; k++) {
+        for (auto& edge : adjacent[k]) {
+            edge.second = m_edgeTarget.size();
+            m_edgeTarget.push_back(edge.first);
+        }
+        m_edge0.push_back(m_edgeTarget.size());
+    }
+    for (size_t i = 0; i < nr; i++) {
+        for (size_t a = m_part0[i]; a < m_part0[i+1]; a++) {
+            for (size_t b = m_part0[i]; b < m_part0[i+1]; b++) {
+                if (a != b) {
+                    m_pairEdge.push_back(
+                        adjacent[m_partSpecies[a]].at(m_partSpecies[b]));
+                }
+            }
+        }
+    }
+    m_coeffs.assign(m_edgeTarget.size(), 0.0);
+    m_importance.assign(nsp, 0.0);
+}
+
+void DirectedRelationGraph::setTargets(const vector<string>& species)
+{
+    m_targets.clear();
+    for (const auto& name : species) {
+        size_t k = m_kin->kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("DirectedRelationGraph::setTargets",
+                               "Unknown species '{}'", name);
+        }
+        m_targets.push_back(k);
+    }
+}
+
+void DirectedRelationGraph::update()
+{
+    // interaction coefficients are based on the full mechanism
+    vector<bool> active = m_kin->activeReactions();
+    if (!active.empty()) {
+        m_kin->setActiveReactions({});
+    }
+    m_ropnet.resize(m_kin->nReactions());
+    m_kin->getNetRatesOfProgress(m_ropnet.data());
+    if (!active.empty()) {
+        m_kin->setActiveReactions(active);
+    }
+    update(m_ropnet.data());
+}
+
+void DirectedRelationGraph::update(const double* ropnet)
+{
+    if (m_targets.empty()) {
+        throw CanteraError("DirectedRelationGraph::update",
+                           "No target species specified.");
+    }
+    size_t nsp = m_importance.size();
+    size_t nr = m_part0.size() - 1;
+    bool drgep = (m_method == "DRGEP");
+
+    // Accumulate numerators and denominators of the interaction coefficients
+    m_num.assign(m_edgeTarget.size(), 0.0);
+    m_prod.assign(nsp, 0.0);
+    m_cons.assign(nsp, 0.0);
+    size_t n = 0;
+    for (size_t i = 0; i < nr; i++) {
+        for (size_t a = m_part0[i]; a < m_part0[i+1]; a++) {
+            size_t kA = m_partSpecies[a];
+            double c = m_partNu[a] * ropnet[i];
+            if (!drgep) {
+                c = std::abs(c);
+                m_prod[kA] += c;
+            } else if (c > 0) {
+                m_prod[kA] += c;
+            } else {
+                m_cons[kA] -= c;
+            }
+            for (size_t b = m_part0[i]; b < m_part0[i+1]; b++) {
+                if (a != b) {
+                    m_num[m_pairEdge[n++]] += c;
+                }
+            }
+        }
+    }
+    for (size_t kA = 0; kA < nsp; kA++) {
+        double den = drgep ? std::max(m_prod[kA], m_cons[kA]) : m_prod[kA];
+        for (size_t e = m_edge0[kA]; e < m_edge0[kA+1]; e++) {
+            m_coeffs[e] = (den > 0) ? std::abs(m_num[e]) / den : 0.0;
+        }
+    }
+
+    // Find the path of maximum importance from the targets to each species.
+    // Since interaction coefficients do not exceed one, the importance does
+    // not increase along a path, and each species is final once it is taken
+    // from the queue with its current importance.
+    m_importance.assign(nsp, 0.0);
+    std::priority_queue<std::pair<double, size_t>> queue;
+    for (size_t k : m_targets) {
+        m_importance[k] = 1.0;
+        queue.emplace(1.0, k);
+    }
+    while (!queue.empty()) {
+        double R = queue.top().first;
+        size_t kA = queue.top().second;
+        queue.pop();
+        if (R < m_importance[kA]) {
+            continue; // outdated entry
+        }
+        for (size_t e = m_edge0[kA]; e < m_edge0[kA+1]; e++) {
+            size_t kB = m_edgeTarget[e];
+            double RB = drgep ? R * m_coeffs[e] : std::min(R, m_coeffs[e]);
+            if (RB > m_importance[kB]) {
+                m_importance[kB] = RB;
+                queue.emplace(RB, kB);
+            }
+        }
+    }
+}
+
+double DirectedRelationGraph::interactionCoefficient(size_t kA, size_t kB) const
+{
+    auto begin = m_edgeTarget.begin() + m_edge0[kA];
+    auto end = m_edgeTarget.begin() + m_edge0[kA+1];
+    auto iter = std::lower_bound(begin, end, kB);
+    if (iter == end || *iter != kB) {
+        return 0.0;
+    }
+    return m_coeffs[iter - m_edgeTarget.begin()];
+}
+
+size_t DirectedRelationGraph::nActiveSpecies(double threshold) const
+{
+    return std::count_if(m_importance.begin(), m_importance.end(),
+                         [threshold](double R) { return R >= threshold; });
+}
+
+void DirectedRelationGraph::getActiveReactions(double threshold,
+                                               vector<bool>& active) const
+{
+    size_t nr = m_part0.size() - 1;
+    active.assign(nr, true);
+    for (size_t i = 0; i < nr; i++) {
+        for (size_t a = m_part0[i]; a < m_part0[i+1]; a++) {
+            if (m_importance[m_partSpecies[a]] < threshold) {
+                active[i] = false;
+                break;
+            }
+        }
+    }
+}
+
 }
@@ -95,6 +95,126 @@ void SurfaceArrhenius::addCoverageDependence(size_t k, doublereal a,
     }
 }
 
+void SurfaceArrheniusBatchEvaluator::install(size_t rxnNumber,
+                                             const SurfaceArrhenius& rate)
+{
+    m_rxn.push_back(rxnNumber);
+    m_rates.push_back(rate);
+    m_indices[rxnNumber] = m_rxn.size() - 1;
+    m_ok = false;
+}
+
+void SurfaceArrheniusBatchEvaluator::replace(size_t rxnNumber,
+                                             const SurfaceArrhenius& rate)
+{
+    m_rates[rateIndex(rxnNumber)] = rate;
+    m_ok = false;
+}
+
+size_t SurfaceArrheniusBatchEvaluator::rateIndex(size_t irxn) const
+{
+    auto iter = m_indices.find(irxn);
+    if (iter == m_indices.end()) {
+        throw CanteraError("SurfaceArrheniusBatchEvaluator::rateIndex",
+                           "No rate installed for reaction {}", irxn);
+    }
+    return iter->second;
+}
+
+void SurfaceArrheniusBatchEvaluator::build()
+{
+    size_t n = m_rates.size();
+    m_A.resize(n);
+    m_b.resize(n);
+    m_E.resize(n);
+    m_nsp = 0;
+    std::vector<Eigen::Triplet<double>> atrips, etrips, mtrips;
+    for (size_t i = 0; i < n; i++) {
+        const SurfaceArrhenius& rate = m_rates[i];
+        m_A[i] = rate.m_A;
+        m_b[i] = rate.m_b;
+        m_E[i] = rate.m_E;
+        int row = static_cast<int>(i);
+        for (size_t j = 0; j < rate.m_sp.size(); j++) {
+            int k = static_cast<int>(rate.m_sp[j]);
+            atrips.emplace_back(row, k, rate.m_ac[j]);
+            etrips.emplace_back(row, k, rate.m_ec[j]);
+            m_nsp = std::max(m_nsp, rate.m_sp[j] + 1);
+        }
+        for (size_t j = 0; j < rate.m_msp.size(); j++) {
+            mtrips.emplace_back(row, static_cast<int>(rate.m_msp[j]), rate.m_mc[j]);
+            m_nsp = std::max(m_nsp, rate.m_msp[j] + 1);
+        }
+    }
+    // Duplicate entries for the same species are summed, which is consistent
+    // with SurfaceArrhenius::update_C
+    m_acov_coeffs.resize(n, m_nsp);
+    m_acov_coeffs.setFromTriplets(atrips.begin(), atrips.end());
+    m_acov_coeffs *= std::log(10.0);
+    m_ecov_coeffs.resize(n, m_nsp);
+    m_ecov_coeffs.setFromTriplets(etrips.begin(), etrips.end());
+    m_mcov_coeffs.resize(n, m_nsp);
+    m_mcov_coeffs.setFromTriplets(mtrips.begin(), mtrips.end());
+    m_theta.setZero(m_nsp);
+    m_logTheta.setZero(m_nsp);
+    m_acov.setZero(n);
+    m_ecov.setZero(n);
+    m_mcov.setZero(n);
+    m_kf.resize(n);
+    m_ok = true;
+}
+
+void SurfaceArrheniusBatchEvaluator::update_C(const double* theta)
+{
+    if (!m_ok) {
+        build();
+    }
+    if (m_nsp == 0) {
+        return;
+    }
+    m_theta = Eigen::Map<const Eigen::VectorXd>(theta, m_nsp);
+    m_logTheta = m_theta.array().max(Tiny).log();
+    m_acov.noalias() = m_acov_coeffs * m_theta;
+    m_ecov.noalias() = m_ecov_coeffs * m_theta;
+    m_mcov.noalias() = m_mcov_coeffs * m_logTheta;
+}
+
+void SurfaceArrheniusBatchEvaluator::update(double T, double logT, double* values)
+{
+    if (!m_ok) {
+        build();
+    }
+    double recipT = 1.0 / T;
+    m_kf = m_A * (m_acov.array() + m_b * logT - (m_E + m_ecov.array()) * recipT
+                  + m_mcov.array()).exp();
+    for (size_t i = 0; i < m_rxn.size(); i++) {
+        values[m_rxn[i]] = m_kf[i];
+    }
+}
+
+double SurfaceArrheniusBatchEvaluator::effectivePreExponentialFactor(size_t irxn)
+{
+    if (!m_ok) {
+        build();
+    }
+    size_t i = rateIndex(irxn);
+    return m_A[i] * std::exp(m_acov[i] + m_mcov[i]);
+}
+
+double SurfaceArrheniusBatchEvaluator::effectiveActivationEnergy_R(size_t irxn)
+{
+    if (!m_ok) {
+        build();
+    }
+    size_t i = rateIndex(irxn);
+    return m_E[i] + m_ecov[i];
+}
+
+double SurfaceArrheniusBatchEvaluator::effectiveTemperatureExponent(size_t irxn)
+{
+    return m_rates[rateIndex(irxn)].temperatureExponent();
+}
+
 PlogRate::PlogRate()
     : logP_(-1000)
     , logP1_(1000)
@@ -252,6 +372,150 @@ std::multimap<double, Arrhenius3> PlogRate::getRates() const
     return rateMap;
 }
 
+void PlogBatchEvaluator::clear()
+{
+    m_logP = NAN;
+    m_index.clear();
+    m_grid.clear();
+    m_node0.clear();
+    m_nodes.clear();
+    m_A.clear();
+    m_logA.clear();
+    m_b.clear();
+    m_E.clear();
+    m_gridIndex.clear();
+    m_grid0.assign(1, 0);
+    m_gridLogP.clear();
+}
+
+void PlogBatchEvaluator::add(size_t rxn_index, const PlogRate& rate)
+{
+    m_index.push_back(rxn_index);
+    m_node0.push_back(m_nodes.size());
+
+    // Pressure nodes, including the nodes added for P --> 0 and P --> infinity
+    size_t offset = m_A.size();
+    vector_fp logP;
+    for (const auto& node : rate.pressures_) {
+        logP.push_back(node.first);
+        m_nodes.emplace_back(offset + node.second.first,
+                             offset + node.second.second);
+    }
+    for (const auto& arrhenius : rate.rates_) {
+        m_A.push_back(arrhenius.preExponentialFactor());
+        m_logA.push_back(arrhenius.logPreExponentialFactor());
+        m_b.push_back(arrhenius.temperatureExponent());
+        m_E.push_back(arrhenius.activationEnergy_R());
+    }
+
+    auto iter = m_gridIndex.find(logP);
+    if (iter == m_gridIndex.end()) {
+        size_t g = m_grid0.size() - 1;
+        m_gridLogP.insert(m_gridLogP.end(), logP.begin(), logP.end());
+        m_grid0.push_back(m_gridLogP.size());
+        iter = m_gridIndex.emplace(std::move(logP), g).first;
+    }
+    m_grid.push_back(iter->second);
+    m_logP = NAN;
+}
+
+void PlogBatchEvaluator::update(const PlogData& shared_data)
+{
+    if (shared_data.logP == m_logP) {
+        return;
+    }
+    m_logP = shared_data.logP;
+
+    // find the interpolation interval once for each distinct pressure grid
+    size_t nGrids = m_grid0.size() - 1;
+    m_gridLow.resize(nGrids);
+    m_gridFrac.resize(nGrids);
+    for (size_t g = 0; g < nGrids; g++) {
+        auto begin = m_gridLogP.begin() + m_grid0[g];
+        auto end = m_gridLogP.begin() + m_grid0[g + 1];
+        auto iter = std::upper_bound(begin, end, m_logP);
+        AssertThrowMsg(iter != end, "PlogBatchEvaluator::update",
+                       "Pressure out of range: {}", m_logP);
+        AssertThrowMsg(iter != begin, "PlogBatchEvaluator::update",
+                       "Pressure out of range: {}", m_logP);
+        double logP2 = *iter;
+        double logP1 = *(--iter);
+        m_gridLow[g] = iter - begin;
+        m_gridFrac[g] = (m_logP - logP1) / (logP2 - logP1);
+    }
+
+    // gather parameters at the lower and upper interpolation pressures
+    size_t n = m_index.size();
+    m_low.resize(n);
+    m_frac.resize(n);
+    m_logA1.resize(n);
+    m_b1.resize(n);
+    m_E1.resize(n);
+    m_logA2.resize(n);
+    m_b2.resize(n);
+    m_E2.resize(n);
+    m_multi.clear();
+    for (size_t i = 0; i < n; i++) {
+        size_t g = m_grid[i];
+        size_t j = m_node0[i] + m_gridLow[g];
+        m_low[i] = j;
+        m_frac[i] = m_gridFrac[g];
+        const auto& low = m_nodes[j];
+        const auto& high = m_nodes[j + 1];
+        if (low.second - low.first == 1 && high.second - high.first == 1) {
+            m_logA1[i] = m_logA[low.first];
+            m_b1[i] = m_b[low.first];
+            m_E1[i] = m_E[low.first];
+            m_logA2[i] = m_logA[high.first];
+            m_b2[i] = m_b[high.first];
+            m_E2[i] = m_E[high.first];
+        } else {
+            m_logA1[i] = m_b1[i] = m_E1[i] = 0.;
+            m_logA2[i] = m_b2[i] = m_E2[i] = 0.;
+            m_multi.push_back(i);
+        }
+    }
+}
+
+void PlogBatchEvaluator::getRateConstants(const PlogData& shared_data, double* kf)
+{
+    update(shared_data);
+    double logT = shared_data.logT;
+    double recipT = shared_data.recipT;
+    m_logk1 = m_logA1 + m_b1 * logT - m_E1 * recipT;
+    m_logk2 = m_logA2 + m_b2 * logT - m_E2 * recipT;
+    for (size_t i : m_multi) {
+        m_logk1[i] = evalNode(m_low[i], logT, recipT);
+        m_logk2[i] = evalNode(m_low[i] + 1, logT, recipT);
+    }
+    m_kf = (m_logk1 + (m_logk2 - m_logk1) * m_frac).exp();
+    for (size_t i = 0; i < m_index.size(); i++) {
+        kf[m_index[i]] = m_kf[i];
+    }
+}
+
+double PlogBatchEvaluator::evalRate(size_t i, const PlogData& shared_data)
+{
+    update(shared_data);
+    double log_k1 = evalNode(m_low[i], shared_data.logT, shared_data.recipT);
+    double log_k2 = evalNode(m_low[i] + 1, shared_data.logT, shared_data.recipT);
+    return std::exp(log_k1 + (log_k2 - log_k1) * m_frac[i]);
+}
+
+double PlogBatchEvaluator::evalNode(size_t j, double logT, double recipT) const
+{
+    size_t k1 = m_nodes[j].first;
+    size_t k2 = m_nodes[j].second;
+    if (k2 - k1 == 1) {
+        return m_logA[k1] + m_b[k1] * logT - m_E[k1] * recipT;
+    }
+    double k = 1e-300; // non-zero to make log(k) finite
+    for (size_t m = k1; m < k2; m++) {
+        k += m_A[m] * std::exp(m_b[m] * logT - m_E[m] * recipT);
+    }
+    return std::log(k);
+}
+
 ChebyshevRate::ChebyshevRate(double Tmin, double Tmax, double Pmin, double Pmax,
                              const Array2D& coeffs) : ChebyshevRate()
 {
@@ -375,6 +639,126 @@ void ChebyshevRate::getParameters(AnyMap& rateNode) const
     coeffs = std::move(coeffs2d);
     rateNode["data"].setQuantity(coeffs, converter);
 }
+
+void ChebyshevBatchEvaluator::clear()
+{
+    m_log10P = NAN;
+    m_groups.clear();
+    m_groupIndex.clear();
+    m_position.clear();
+    m_pending.clear();
+    m_ready = true;
+}
+
+void ChebyshevBatchEvaluator::add(size_t rxn_index, const ChebyshevRate& rate)
+{
+    const Array2D& coeffs = rate.data();
+    auto key = std::make_tuple(rate.Tmin(), rate.Tmax(), rate.Pmin(), rate.Pmax(),
+                               coeffs.nRows(), coeffs.nColumns());
+    auto iter = m_groupIndex.find(key);
+    if (iter == m_groupIndex.end()) {
+        // reduced temperature and pressure as in ChebyshevRate::setLimits
+        Group group;
+        double logPmin = std::log10(rate.Pmin());
+        double logPmax = std::log10(rate.Pmax());
+        double TminInv = 1.0 / rate.Tmin();
+        double TmaxInv = 1.0 / rate.Tmax();
+        group.TrNum = - TminInv - TmaxInv;
+        group.TrDen = 1.0 / (TmaxInv - TminInv);
+        group.PrNum = - logPmin - logPmax;
+        group.PrDen = 1.0 / (logPmax - logPmin);
+        group.nT = coeffs.nRows();
+        group.nP = coeffs.nColumns();
+        iter = m_groupIndex.emplace(key, m_groups.size()).first;
+        m_groups.push_back(std::move(group));
+        m_pending.emplace_back();
+    }
+    Group& group = m_groups[iter->second];
+    m_position.emplace_back(iter->second, group.index.size());
+    group.index.push_back(rxn_index);
+    m_pending[iter->second].push_back(coeffs);
+    m_ready = false;
+}
+
+void ChebyshevBatchEvaluator::finalize()
+{
+    for (size_t g = 0; g < m_groups.size(); g++) {
+        Group& group = m_groups[g];
+        size_t n = group.index.size();
+        group.coeffs.resize(group.nT * n, group.nP);
+        for (size_t i = 0; i < n; i++) {
+            const Array2D& coeffs = m_pending[g][i];
+            for (size_t t = 0; t < group.nT; t++) {
+                for (size_t p = 0; p < group.nP; p++) {
+                    group.coeffs(t * n + i, p) = coeffs(t, p);
+                }
+            }
+        }
+        group.dotProd.resize(n, group.nT);
+        group.logk.resize(n);
+    }
+    m_pending.clear();
+    m_ready = true;
+    m_log10P = NAN;
+}
+
+void ChebyshevBatchEvaluator::chebyshev(double x, Eigen::VectorXd& out)
+{
+    if (out.size() > 0) {
+        out[0] = 1.;
+    }
+    if (out.size() > 1) {
+        out[1] = x;
+    }
+    for (Eigen::Index n = 2; n < out.size(); n++) {
+        out[n] = 2 * x * out[n-1] - out[n-2];
+    }
+}
+
+void ChebyshevBatchEvaluator::update(const ChebyshevData& shared_data)
+{
+    if (!m_ready) {
+        finalize();
+    }
+    if (shared_data.log10P == m_log10P) {
+        return;
+    }
+    m_log10P = shared_data.log10P;
+    for (auto& group : m_groups) {
+        double Pr = (2 * m_log10P + group.PrNum) * group.PrDen;
+        m_phiP.resize(group.nP);
+        chebyshev(Pr, m_phiP);
+        Eigen::Map<Eigen::VectorXd>(group.dotProd.data(), group.coeffs.rows())
+            .noalias() = group.coeffs * m_phiP;
+    }
+}
+
+void ChebyshevBatchEvaluator::getRateConstants(const ChebyshevData& shared_data,
+                                               double* kf)
+{
+    update(shared_data);
+    for (auto& group : m_groups) {
+        double Tr = (2 * shared_data.recipT + group.TrNum) * group.TrDen;
+        m_phiT.resize(group.nT);
+        chebyshev(Tr, m_phiT);
+        group.logk.noalias() = group.dotProd * m_phiT;
+        group.logk = (group.logk.array() * std::log(10.0)).exp().matrix();
+        for (size_t i = 0; i < group.index.size(); i++) {
+            kf[group.index[i]] = group.logk[i];
+        }
+    }
+}
+
+double ChebyshevBatchEvaluator::evalRate(size_t i, const ChebyshevData& shared_data)
+{
+    update(shared_data);
+    const Group& group = m_groups[m_position[i].first];
+    double Tr = (2 * shared_data.recipT + group.TrNum) * group.TrDen;
+    m_phiT.resize(group.nT);
+    chebyshev(Tr, m_phiT);
+    return std::pow(10, group.dotProd.row(m_position[i].second).dot(m_phiT));
+}
+
 BMSurfaceArrhenius::BMSurfaceArrhenius()
     : m_b(0.0)
     , m_A(0.0)
@@ -5,6 +5,7 @@
 
 #include "cantera/numerics/CVodesIntegrator.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 #include <iostream>
 using namespace std;
@@ -23,6 +24,10 @@ using namespace std;
         #include "sunlinsol/sunlinsol_band.h"
     #endif
     #include "sunlinsol/sunlinsol_spgmr.h"
+    #if CT_SUNDIALS_VERSION >= 50
+        #include "sunmatrix/sunmatrix_sparse.h"
+        #include "sundials/sundials_linearsolver.h"
+    #endif
     #include "cvodes/cvodes_direct.h"
     #include "cvodes/cvodes_diag.h"
     #include "cvodes/cvodes_spils.h"
@@ -57,6 +62,109 @@ N_Vector newNVector(size_t N, Cantera::SundialsContext& context)
 #endif
 }
 
+#if CT_SUNDIALS_VERSION >= 50
+
+//! Data used by the SUNLinearSolver wrapping the Eigen sparse LU solver
+struct SparseLUContent {
+    Eigen::SparseMatrix<double> M; //!< copy of the Newton iteration matrix
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> lu;
+    //! Sparsity pattern of the last matrix passed to analyzePattern()
+    std::vector<sunindextype> outer, inner;
+};
+
+SUNLinearSolver_Type sparseLU_gettype(SUNLinearSolver S)
+{
+    return SUNLINEARSOLVER_DIRECT;
+}
+
+SUNLinearSolver_ID sparseLU_getid(SUNLinearSolver S)
+{
+    return SUNLINEARSOLVER_CUSTOM;
+}
+
+//! Factorize the CSC matrix *A* = I - gamma*J assembled by CVODES
+int sparseLU_setup(SUNLinearSolver S, SUNMatrix A)
+{
+    SparseLUContent* content = static_cast<SparseLUContent*>(S->content);
+    if (!content) {
+        return SUNLS_MEM_NULL;
+    }
+    sunindextype n = SM_COLUMNS_S(A);
+    sunindextype* colptrs = SM_INDEXPTRS_S(A);
+    sunindextype* rowvals = SM_INDEXVALS_S(A);
+    sunindextype nnz = colptrs[n];
+    Eigen::Map<const Eigen::SparseMatrix<double, Eigen::ColMajor, sunindextype>>
+        mapped(n, n, nnz, colptrs, rowvals, SM_DATA_S(A));
+    content->M = mapped;
+
+    // The column ordering only needs to be recomputed if the sparsity
+    // pattern changed since the last factorization
+    if (content->outer.size() != static_cast<size_t>(n + 1)
+        || !std::equal(colptrs, colptrs + n + 1, content->outer.begin())
+        || content->inner.size() != static_cast<size_t>(nnz)
+        || !std::equal(rowvals, rowvals + nnz, content->inner.begin()))
+    {
+        content->outer.assign(colptrs, colptrs + n + 1);
+        content->inner.assign(rowvals, rowvals + nnz);
+        content->lu.analyzePattern(content->M);
+    }
+    content->lu.factorize(content->M);
+    if (content->lu.info() != Eigen::Success) {
+        return SUNLS_PACKAGE_FAIL_REC;
+    }
+    return SUNLS_SUCCESS;
+}
+
+int sparseLU_solve(SUNLinearSolver S, SUNMatrix A, N_Vector x, N_Vector b,
+                   realtype tol)
+{
+    SparseLUContent* content = static_cast<SparseLUContent*>(S->content);
+    if (!content) {
+        return SUNLS_MEM_NULL;
+    }
+    sunindextype n = SM_COLUMNS_S(A);
+    Eigen::Map<Eigen::VectorXd> xx(NV_DATA_S(x), n);
+    xx = content->lu.solve(Eigen::Map<const Eigen::VectorXd>(NV_DATA_S(b), n));
+    if (content->lu.info() != Eigen::Success) {
+        return SUNLS_PACKAGE_FAIL_REC;
+    }
+    return SUNLS_SUCCESS;
+}
+
+int sparseLU_free(SUNLinearSolver S)
+{
+    if (S == nullptr) {
+        return SUNLS_SUCCESS;
+    }
+    delete static_cast<SparseLUContent*>(S->content);
+    S->content = nullptr;
+    SUNLinSolFreeEmpty(S);
+    return SUNLS_SUCCESS;
+}
+
+//! Create a SUNDIALS direct linear solver which uses Eigen's sparse LU
+//! decomposition to solve systems with a SUNSparseMatrix in CSC format.
+SUNLinearSolver newSparseLULinearSolver(Cantera::SundialsContext& context)
+{
+    #if CT_SUNDIALS_VERSION >= 60
+        SUNLinearSolver S = SUNLinSolNewEmpty(context.get());
+    #else
+        SUNLinearSolver S = SUNLinSolNewEmpty();
+    #endif
+    if (S == nullptr) {
+        return nullptr;
+    }
+    S->ops->gettype = sparseLU_gettype;
+    S->ops->getid = sparseLU_getid;
+    S->ops->setup = sparseLU_setup;
+    S->ops->solve = sparseLU_solve;
+    S->ops->free = sparseLU_free;
+    S->content = new SparseLUContent();
+    return S;
+}
+
+#endif
+
 } // end anonymous namespace
 
 namespace Cantera
@@ -77,6 +185,101 @@ extern "C" {
         return f->eval_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot));
     }
 
+    /**
+     * Function called by cvodes to evaluate the root functions provided by
+     * FuncEval::evalRootFunctions().
+     * @ingroup odeGroup
+     */
+    static int cvodes_root(realtype t, N_Vector y, realtype* gout, void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalRootFunctions_nothrow(t, NV_DATA_S(y), gout);
+    }
+
+#if CT_SUNDIALS_VERSION >= 50
+    /**
+     * Function called by cvodes to evaluate the Jacobian of the right-hand
+     * side as a SUNSparseMatrix in compressed sparse column format. The
+     * Jacobian is provided by FuncEval::evalSparseJacobian().
+     * @ingroup odeGroup
+     */
+    static int cvodes_sparse_jac(realtype t, N_Vector y, N_Vector ydot,
+                                 SUNMatrix J, void* f_data, N_Vector tmp1,
+                                 N_Vector tmp2, N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        Eigen::SparseMatrix<double> jac;
+        int flag = f->evalSparseJacobian_nothrow(t, NV_DATA_S(y), jac);
+        if (flag != 0) {
+            return flag;
+        }
+        jac.makeCompressed();
+        sunindextype nnz = static_cast<sunindextype>(jac.nonZeros());
+        if (SM_NNZ_S(J) < nnz) {
+            if (SUNSparseMatrix_Reallocate(J, nnz) != 0) {
+                return -1;
+            }
+        }
+        sunindextype* colptrs = SM_INDEXPTRS_S(J);
+        sunindextype* rowvals = SM_INDEXVALS_S(J);
+        for (int j = 0; j <= jac.cols(); j++) {
+            colptrs[j] = jac.outerIndexPtr()[j];
+        }
+        std::copy(jac.innerIndexPtr(), jac.innerIndexPtr() + nnz, rowvals);
+        std::copy(jac.valuePtr(), jac.valuePtr() + nnz, SM_DATA_S(J));
+        return 0;
+    }
+#endif
+
+#if CT_SUNDIALS_VERSION >= 30
+    /**
+     * Function called by cvodes to evaluate the Jacobian of the right-hand
+     * side as a SUNDenseMatrix, which is stored in column-major order. The
+     * Jacobian is provided by FuncEval::evalDenseJacobian().
+     * @ingroup odeGroup
+     */
+    static int cvodes_dense_jac(realtype t, N_Vector y, N_Vector ydot,
+                                SUNMatrix J, void* f_data, N_Vector tmp1,
+                                N_Vector tmp2, N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalDenseJacobian_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot),
+                                            SM_DATA_D(J));
+    }
+
+    /**
+     * Function called by cvodes to set up the preconditioner for the current
+     * state and the scaling factor *gamma* of the Newton iteration matrix
+     * \f$ I - \gamma J \f$. Delegates to FuncEval::preconditionerSetup().
+     * If *jok* is true, the Jacobian from the previous call may be reused.
+     * @ingroup odeGroup
+     */
+    static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector ydot,
+                                 booleantype jok, booleantype* jcurPtr,
+                                 realtype gamma, void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        bool jacCurrent = true;
+        int flag = f->preconditionerSetup_nothrow(t, NV_DATA_S(y), gamma,
+                                                  jok == SUNTRUE, jacCurrent);
+        *jcurPtr = jacCurrent ? SUNTRUE : SUNFALSE;
+        return flag;
+    }
+
+    /**
+     * Function called by cvodes to solve the preconditioner system P z = r.
+     * Delegates to FuncEval::preconditionerSolve().
+     * @ingroup odeGroup
+     */
+    static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector ydot,
+                                 N_Vector r, N_Vector z, realtype gamma,
+                                 realtype delta, int lr, void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->preconditionerSolve_nothrow(NV_DATA_S(r), NV_DATA_S(z));
+    }
+#endif
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -115,6 +318,8 @@ CVodesIntegrator::CVodesIntegrator() :
     m_yS(nullptr),
     m_np(0),
     m_mupper(0), m_mlower(0),
+    m_nroots(0),
+    m_root_found(false),
     m_sens_ok(false)
 {
 }
@@ -388,7 +593,7 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
 
 void CVodesIntegrator::applyOptions()
 {
-    if (m_type == DENSE + NOJAC) {
+    if (m_type == DENSE + NOJAC || m_type == DENSE + JAC) {
         sd_size_t N = static_cast<sd_size_t>(m_neq);
         #if CT_SUNDIALS_VERSION >= 30
             SUNLinSolFree((SUNLinearSolver) m_linsol);
@@ -430,7 +635,21 @@ void CVodesIntegrator::applyOptions()
                     "Error connecting linear solver to CVODES. "
                     "Sundials error code: {}", flag);
             }
+            if (m_type == DENSE + JAC) {
+                #if CT_SUNDIALS_VERSION >= 40
+                    flag = CVodeSetJacFn(m_cvode_mem, cvodes_dense_jac);
+                #else
+                    flag = CVDlsSetJacFn(m_cvode_mem, cvodes_dense_jac);
+                #endif
+                if (flag != CV_SUCCESS) {
+                    throw CanteraError("CVodesIntegrator::applyOptions",
+                        "Error setting Jacobian function. "
+                        "Sundials error code: {}", flag);
+                }
+            }
         #else
+            // The difference quotient Jacobian computed by CVODES is used
+            // for problem type DENSE + JAC with older Sundials versions
             #if CT_SUNDIALS_USE_LAPACK
                 CVLapackDense(m_cvode_mem, N);
             #else
@@ -438,6 +657,46 @@ void CVodesIntegrator::applyOptions()
             #endif
 
         #endif
+    } else if (m_type == SPARSE + JAC) {
+        #if CT_SUNDIALS_VERSION >= 50
+            sd_size_t N = static_cast<sd_size_t>(m_neq);
+            SUNLinSolFree((SUNLinearSolver) m_linsol);
+            SUNMatDestroy((SUNMatrix) m_linsol_matrix);
+            // Initial storage is sized for a diagonal matrix; the storage is
+            // expanded as needed when the Jacobian is evaluated
+            #if CT_SUNDIALS_VERSION >= 60
+                m_linsol_matrix = SUNSparseMatrix(N, N, N, CSC_MAT,
+                                                  m_sundials_ctx.get());
+            #else
+                m_linsol_matrix = SUNSparseMatrix(N, N, N, CSC_MAT);
+            #endif
+            if (m_linsol_matrix == nullptr) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Unable to create SUNSparseMatrix of size {0} x {0}", N);
+            }
+            m_linsol = newSparseLULinearSolver(m_sundials_ctx);
+            if (m_linsol == nullptr) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Error creating sparse LU linear solver object");
+            }
+            int flag = CVodeSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol,
+                                            (SUNMatrix) m_linsol_matrix);
+            if (flag != CV_SUCCESS) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Error connecting linear solver to CVODES. "
+                    "Sundials error code: {}", flag);
+            }
+            flag = CVodeSetJacFn(m_cvode_mem, cvodes_sparse_jac);
+            if (flag != CV_SUCCESS) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Error setting Jacobian function. "
+                    "Sundials error code: {}", flag);
+            }
+        #else
+            throw CanteraError("CVodesIntegrator::applyOptions",
+                "Sparse linear solvers require Sundials 5.0 or newer "
+                "(found version {}).", CT_SUNDIALS_VERSION);
+        #endif
     } else if (m_type == DIAG) {
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
@@ -456,6 +715,49 @@ void CVodesIntegrator::applyOptions()
         #else
             CVSpgmr(m_cvode_mem, PREC_NONE, 0);
         #endif
+    } else if (m_type == GMRES + JAC) {
+        // GMRES with left preconditioning provided by the FuncEval object
+        #if CT_SUNDIALS_VERSION >= 30
+            SUNLinSolFree((SUNLinearSolver) m_linsol);
+            SUNMatDestroy((SUNMatrix) m_linsol_matrix);
+            m_linsol_matrix = nullptr;
+            int flag;
+            #if CT_SUNDIALS_VERSION >= 60
+                m_linsol = SUNLinSol_SPGMR(m_y, PREC_LEFT, 0, m_sundials_ctx.get());
+                flag = CVodeSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol,
+                                            nullptr);
+            #elif CT_SUNDIALS_VERSION >= 40
+                m_linsol = SUNLinSol_SPGMR(m_y, PREC_LEFT, 0);
+                flag = CVSpilsSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol);
+            #else
+                m_linsol = SUNSPGMR(m_y, PREC_LEFT, 0);
+                flag = CVSpilsSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol);
+            #endif
+            if (m_linsol == nullptr) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Error creating Sundials GMRES linear solver object");
+            } else if (flag != CV_SUCCESS) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Error connecting linear solver to CVODES. "
+                    "Sundials error code: {}", flag);
+            }
+            #if CT_SUNDIALS_VERSION >= 40
+                flag = CVodeSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                              cvodes_prec_solve);
+            #else
+                flag = CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                                cvodes_prec_solve);
+            #endif
+            if (flag != CV_SUCCESS) {
+                throw CanteraError("CVodesIntegrator::applyOptions",
+                    "Error setting preconditioner functions. "
+                    "Sundials error code: {}", flag);
+            }
+        #else
+            throw CanteraError("CVodesIntegrator::applyOptions",
+                "Preconditioned GMRES requires Sundials 3.0 or newer "
+                "(found version {}).", CT_SUNDIALS_VERSION);
+        #endif
     } else if (m_type == BAND + NOJAC) {
         sd_size_t N = static_cast<sd_size_t>(m_neq);
         long int nu = m_mupper;
@@ -521,15 +823,26 @@ void CVodesIntegrator::applyOptions()
     if (m_maxErrTestFails > 0) {
         CVodeSetMaxErrTestFails(m_cvode_mem, m_maxErrTestFails);
     }
+
+    m_nroots = m_func->nRootFunctions();
+    m_root_found = false;
+    int flag = CVodeRootInit(m_cvode_mem, static_cast<int>(m_nroots),
+                             m_nroots ? cvodes_root : nullptr);
+    if (flag != CV_SUCCESS) {
+        throw CanteraError("CVodesIntegrator::applyOptions",
+                           "CVodeRootInit failed.");
+    }
 }
 
 void CVodesIntegrator::integrate(double tout)
 {
     if (tout == m_time) {
+        m_root_found = false;
         return;
     }
     int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
-    if (flag != CV_SUCCESS) {
+    m_root_found = (flag == CV_ROOT_RETURN);
+    if (flag != CV_SUCCESS && flag != CV_ROOT_RETURN) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
             f_errs = "Exceptions caught during RHS evaluation:\n" + f_errs;
@@ -546,7 +859,8 @@ void CVodesIntegrator::integrate(double tout)
 double CVodesIntegrator::step(double tout)
 {
     int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP);
-    if (flag != CV_SUCCESS) {
+    m_root_found = (flag == CV_ROOT_RETURN);
+    if (flag != CV_SUCCESS && flag != CV_ROOT_RETURN) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
             f_errs = "Exceptions caught during RHS evaluation:\n" + f_errs;
@@ -578,6 +892,19 @@ double* CVodesIntegrator::derivative(double tout, int n)
     return NV_DATA_S(m_dky);
 }
 
+void CVodesIntegrator::getRootInfo(int* info)
+{
+    if (!m_root_found) {
+        std::fill(info, info + m_nroots, 0);
+        return;
+    }
+    int flag = CVodeGetRootInfo(m_cvode_mem, info);
+    if (flag != CV_SUCCESS) {
+        throw CanteraError("CVodesIntegrator::getRootInfo",
+                           "CVodeGetRootInfo failed. Error code: {}", flag);
+    }
+}
+
 int CVodesIntegrator::lastOrder() const
 {
     int ord;
@@ -9,10 +9,18 @@ FuncEval::FuncEval()
 {
 }
 
-int FuncEval::eval_nothrow(double t, double* y, double* ydot)
+template <class F>
+int FuncEval::callNoThrow(const F& func, const std::string& name)
 {
     try {
-        eval(t, y, ydot, m_sens_params.data());
+        func();
+    } catch (NotImplementedError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return -1; // unrecoverable error
     } catch (CanteraError& err) {
         if (suppressErrors()) {
             m_errors.push_back(err.what());
@@ -24,14 +32,13 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
         if (suppressErrors()) {
             m_errors.push_back(err.what());
         } else {
-            writelog("FuncEval::eval_nothrow: unhandled exception:\n");
+            writelog(name + ": unhandled exception:\n");
             writelog(err.what());
             writelogendl();
         }
         return -1; // unrecoverable error
     } catch (...) {
-        std::string msg = "FuncEval::eval_nothrow: unhandled exception"
-            " of unknown type\n";
+        std::string msg = name + ": unhandled exception of unknown type\n";
         if (suppressErrors()) {
             m_errors.push_back(msg);
         } else {
@@ -42,6 +49,51 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
     return 0; // successful evaluation
 }
 
+int FuncEval::eval_nothrow(double t, double* y, double* ydot)
+{
+    return callNoThrow([&]() {
+        eval(t, y, ydot, m_sens_params.data());
+    }, "FuncEval::eval_nothrow");
+}
+
+int FuncEval::evalDenseJacobian_nothrow(double t, double* y,
+                                        const double* ydot, double* jac)
+{
+    return callNoThrow([&]() {
+        evalDenseJacobian(t, y, ydot, jac);
+    }, "FuncEval::evalDenseJacobian_nothrow");
+}
+
+int FuncEval::evalSparseJacobian_nothrow(double t, double* y,
+                                         Eigen::SparseMatrix<double>& jac)
+{
+    return callNoThrow([&]() {
+        evalSparseJacobian(t, y, jac);
+    }, "FuncEval::evalSparseJacobian_nothrow");
+}
+
+int FuncEval::preconditionerSetup_nothrow(double t, double* y, double gamma,
+                                          bool jacOk, bool& jacCurrent)
+{
+    return callNoThrow([&]() {
+        jacCurrent = preconditionerSetup(t, y, gamma, jacOk);
+    }, "FuncEval::preconditionerSetup_nothrow");
+}
+
+int FuncEval::preconditionerSolve_nothrow(double* rhs, double* output)
+{
+    return callNoThrow([&]() {
+        preconditionerSolve(rhs, output);
+    }, "FuncEval::preconditionerSolve_nothrow");
+}
+
+int FuncEval::evalRootFunctions_nothrow(double t, double* y, double* gout)
+{
+    return callNoThrow([&]() {
+        evalRootFunctions(t, y, gout);
+    }, "FuncEval::evalRootFunctions_nothrow");
+}
+
 std::string FuncEval::getErrors() const {
     std::stringstream errs;
     for (const auto& err : m_errors) {
@@ -6,6 +6,8 @@
 #include "cantera/base/ct_defs.h"
 #include "cantera/numerics/Integrator.h"
 #include "cantera/numerics/CVodesIntegrator.h"
+#include "cantera/numerics/RosenbrockIntegrator.h"
+#include "cantera/numerics/RKCIntegrator.h"
 
 namespace Cantera
 {
@@ -14,6 +16,10 @@ Integrator* newIntegrator(const std::string& itype)
 {
     if (itype == "CVODE") {
         return new CVodesIntegrator();
+    } else if (itype == "ROS4" || itype == "RODAS3") {
+        return new RosenbrockIntegrator(itype);
+    } else if (itype == "RKC") {
+        return new RKCIntegrator();
     } else {
         throw CanteraError("newIntegrator",
                            "unknown ODE integrator: "+itype);
@@ -0,0 +1,450 @@
+//! @file OneStepIntegrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/OneStepIntegrator.h"
+
+namespace Cantera
+{
+
+namespace {
+// Safety factor and limits of the ratio of successive step sizes
+const double StepSafety = 0.9;
+const double MinStepRatio = 0.2;
+const double MaxStepRatio = 5.0;
+}
+
+OneStepIntegrator::OneStepIntegrator()
+    : m_func(nullptr)
+    , m_neq(0)
+    , m_type(DENSE + NOJAC)
+    , m_rtol(1.0e-9)
+    , m_atol(1, 1.0e-15)
+    , m_hmax(0.0)
+    , m_hmin(0.0)
+    , m_maxsteps(20000)
+    , m_maxErrTestFails(10)
+    , m_t(0.0)
+    , m_h(0.0)
+    , m_tprev(0.0)
+    , m_fnew_ok(false)
+    , m_rejected(false)
+    , m_nroots(0)
+    , m_tg(0.0)
+    , m_root_found(false)
+    , m_troot(0.0)
+    , m_nsteps(0)
+    , m_nreject(0)
+    , m_nfevals(0)
+{
+}
+
+void OneStepIntegrator::setTolerances(double reltol, size_t n, double* abstol)
+{
+    m_rtol = reltol;
+    m_atol.assign(abstol, abstol + n);
+}
+
+void OneStepIntegrator::setTolerances(double reltol, double abstol)
+{
+    m_rtol = reltol;
+    m_atol.assign(1, abstol);
+}
+
+void OneStepIntegrator::setProblemType(int probtype)
+{
+    m_type = probtype;
+}
+
+void OneStepIntegrator::setMaxStepSize(double hmax)
+{
+    m_hmax = hmax;
+}
+
+void OneStepIntegrator::setMinStepSize(double hmin)
+{
+    m_hmin = hmin;
+}
+
+void OneStepIntegrator::setMaxSteps(int nmax)
+{
+    m_maxsteps = nmax;
+}
+
+void OneStepIntegrator::setMaxErrTestFails(int n)
+{
+    if (n > 0) {
+        m_maxErrTestFails = n;
+    }
+}
+
+void OneStepIntegrator::initialize(double t0, FuncEval& func)
+{
+    if (func.nparams()) {
+        throw CanteraError("OneStepIntegrator::initialize",
+            "Sensitivity analysis is not supported by this integrator.");
+    }
+    m_neq = func.neq();
+    if (m_atol.size() != 1 && m_atol.size() != m_neq) {
+        throw CanteraError("OneStepIntegrator::initialize",
+            "Number of absolute tolerances ({}) does not match the number of "
+            "equations ({})", m_atol.size(), m_neq);
+    }
+    m_y.assign(m_neq, 0.0);
+    m_f.assign(m_neq, 0.0);
+    m_yprev.assign(m_neq, 0.0);
+    m_fprev.assign(m_neq, 0.0);
+    m_ynew.assign(m_neq, 0.0);
+    m_fnew.assign(m_neq, 0.0);
+    m_yout.assign(m_neq, 0.0);
+    m_dky.assign(m_neq, 0.0);
+    m_yg.assign(m_neq, 0.0);
+    m_nsteps = 0;
+    m_nreject = 0;
+    m_nfevals = 0;
+    m_func = &func;
+    setup();
+    reinitialize(t0, func);
+}
+
+void OneStepIntegrator::reinitialize(double t0, FuncEval& func)
+{
+    m_func = &func;
+    func.clearErrors();
+    m_t = t0;
+    m_tprev = t0;
+    m_h = 0.0;
+    m_rejected = false;
+    func.getState(m_y.data());
+    m_yout = m_y;
+    if (!evalRHS(m_t, m_y.data(), m_f.data())) {
+        throw CanteraError("OneStepIntegrator::reinitialize",
+            "Error evaluating the initial derivative:\n{}", func.getErrors());
+    }
+    m_nroots = func.nRootFunctions();
+    m_root_found = false;
+    m_tg = t0;
+    m_g.assign(m_nroots, 0.0);
+    m_glo.assign(m_nroots, 0.0);
+    m_ghi.assign(m_nroots, 0.0);
+    m_gmid.assign(m_nroots, 0.0);
+    m_rootInfo.assign(m_nroots, 0);
+    if (m_nroots) {
+        evalRoots(t0, m_g.data());
+    }
+}
+
+bool OneStepIntegrator::evalRHS(double t, double* y, double* ydot)
+{
+    m_nfevals++;
+    int flag = m_func->eval_nothrow(t, y, ydot);
+    if (flag < 0) {
+        throw CanteraError("OneStepIntegrator::evalRHS",
+            "Unrecoverable error evaluating the right hand side:\n{}",
+            m_func->getErrors());
+    }
+    return flag == 0;
+}
+
+double OneStepIntegrator::errorNorm(const double* v, const double* y0,
+                                    const double* y1) const
+{
+    double sum = 0.0;
+    for (size_t k = 0; k < m_neq; k++) {
+        double w = atol(k) + m_rtol * std::max(std::abs(y0[k]), std::abs(y1[k]));
+        sum += std::pow(v[k] / w, 2);
+    }
+    return sqrt(sum / m_neq);
+}
+
+double OneStepIntegrator::initialStepSize() const
+{
+    // Hairer, Norsett & Wanner, Solving Ordinary Differential Equations I,
+    // Section II.4
+    double d0 = errorNorm(m_y.data(), m_y.data(), m_y.data());
+    double d1 = errorNorm(m_f.data(), m_y.data(), m_y.data());
+    double h = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+    if (m_hmax > 0) {
+        h = std::min(h, m_hmax);
+    }
+    return std::max(h, m_hmin);
+}
+
+void OneStepIntegrator::takeStep(double tmax)
+{
+    if (m_h == 0.0) {
+        m_h = initialStepSize();
+    }
+    int nfail = 0;
+    while (true) {
+        double h = (m_hmax > 0) ? std::min(m_h, m_hmax) : m_h;
+        h = limitStep(h);
+        // avoid leaving a very short step before the output time
+        bool last = (m_t + 1.05 * h >= tmax);
+        if (last) {
+            h = tmax - m_t;
+        }
+        if (h < m_hmin || m_t + h == m_t) {
+            throw CanteraError("OneStepIntegrator::takeStep",
+                "Step size {} too small at t = {}.\n{}", h, m_t,
+                m_func->getErrors());
+        }
+
+        m_fnew_ok = false;
+        double err = attemptStep(h);
+        if (err >= 0 && !m_fnew_ok) {
+            if (evalRHS(m_t + h, m_ynew.data(), m_fnew.data())) {
+                m_fnew_ok = true;
+            } else {
+                err = -1.0;
+            }
+        }
+
+        if (err >= 0 && err <= 1.0) {
+            // accept the step
+            m_tprev = m_t;
+            m_t = last ? tmax : m_t + h;
+            m_yprev.swap(m_y);
+            m_y.swap(m_ynew);
+            m_fprev.swap(m_f);
+            m_f.swap(m_fnew);
+            double ratio = (err == 0.0) ? MaxStepRatio :
+                StepSafety * std::pow(err, -1.0 / errorOrder());
+            ratio = std::max(MinStepRatio, std::min(ratio, MaxStepRatio));
+            if (m_rejected) {
+                ratio = std::min(ratio, 1.0);
+            }
+            // A step shortened to reach the output time does not indicate
+            // that a smaller step size is needed
+            m_h = last ? std::max(m_h, h * ratio) : h * ratio;
+            m_rejected = false;
+            m_nsteps++;
+            return;
+        }
+
+        // reject the step
+        m_nreject++;
+        if (++nfail > m_maxErrTestFails) {
+            throw CanteraError("OneStepIntegrator::takeStep",
+                "Error test failed repeatedly at t = {} with step size {}.\n{}",
+                m_t, h, m_func->getErrors());
+        }
+        if (err < 0) {
+            m_h = 0.25 * h;
+        } else if (nfail > 1) {
+            // The error may not decrease at the asymptotic rate for large
+            // steps applied to stiff components
+            m_h = MinStepRatio * h;
+        } else {
+            m_h = h * std::max(MinStepRatio,
+                               StepSafety * std::pow(err, -1.0 / errorOrder()));
+        }
+        m_rejected = true;
+    }
+}
+
+void OneStepIntegrator::integrate(double tout)
+{
+    m_root_found = false;
+    if (tout < m_tprev) {
+        throw CanteraError("OneStepIntegrator::integrate",
+            "Output time {} is before the start of the last step ({}).",
+            tout, m_tprev);
+    }
+    // roots in the part of the last step not searched by the previous call
+    if (m_nroots && findRoot(std::min(tout, m_t))) {
+        return;
+    }
+    if (tout <= m_t) {
+        interpolate(tout, 0, m_yout.data());
+        return;
+    }
+    int nsteps = 0;
+    while (m_t < tout) {
+        if (++nsteps > m_maxsteps) {
+            throw CanteraError("OneStepIntegrator::integrate",
+                "Maximum number of steps ({}) taken before reaching t = {}. "
+                "Current time: {}", m_maxsteps, tout, m_t);
+        }
+        takeStep(tout);
+        if (m_nroots && findRoot(m_t)) {
+            return;
+        }
+    }
+    m_yout = m_y;
+}
+
+double OneStepIntegrator::step(double tout)
+{
+    m_root_found = false;
+    if (!(m_nroots && findRoot(m_t))) {
+        takeStep(std::numeric_limits<double>::infinity());
+        if (!(m_nroots && findRoot(m_t))) {
+            m_yout = m_y;
+            return m_t;
+        }
+    }
+    return m_troot;
+}
+
+void OneStepIntegrator::getRootInfo(int* info)
+{
+    for (size_t i = 0; i < m_nroots; i++) {
+        info[i] = m_root_found ? m_rootInfo[i] : 0;
+    }
+}
+
+void OneStepIntegrator::evalRoots(double t, double* g)
+{
+    if (t == m_t) {
+        m_yg = m_y;
+    } else {
+        interpolate(t, 0, m_yg.data());
+    }
+    if (m_func->evalRootFunctions_nothrow(t, m_yg.data(), g)) {
+        throw CanteraError("OneStepIntegrator::evalRoots",
+            "Error evaluating the root functions at t = {}:\n{}", t,
+            m_func->getErrors());
+    }
+}
+
+namespace {
+// Returns `true` if a root function changes sign from *g0* to *g1*. A root
+// function which is zero at the start of an interval was reported at the end
+// of the previous interval.
+bool signChange(double g0, double g1)
+{
+    return g0 != 0.0 && (g1 == 0.0 || (g0 < 0.0) != (g1 < 0.0));
+}
+}
+
+bool OneStepIntegrator::findRoot(double tend)
+{
+    if (tend <= m_tg) {
+        return false;
+    }
+    evalRoots(tend, m_ghi.data());
+    bool found = false;
+    for (size_t i = 0; i < m_nroots; i++) {
+        found |= signChange(m_g[i], m_ghi[i]);
+    }
+    if (!found) {
+        m_tg = tend;
+        m_g.swap(m_ghi);
+        return false;
+    }
+
+    // Locate the first root in [tlo, thi]. Each iteration uses the function
+    // with the largest relative change towards its root to compute a new trial
+    // point, with the weight of an endpoint which is retained repeatedly
+    // halved (Illinois method).
+    const double ttol = 100 * std::numeric_limits<double>::epsilon()
+                        * (std::abs(m_t) + std::abs(m_t - m_tprev));
+    double tlo = m_tg;
+    double thi = tend;
+    m_glo = m_g;
+    double wlo = 1.0, whi = 1.0;
+    int side = 0;
+    for (int iter = 0; iter < 100 && thi - tlo > ttol; iter++) {
+        size_t imax = npos;
+        double fracmax = -1.0;
+        for (size_t i = 0; i < m_nroots; i++) {
+            if (signChange(m_glo[i], m_ghi[i])) {
+                double frac = std::abs(m_ghi[i] / (m_ghi[i] - m_glo[i]));
+                if (frac > fracmax) {
+                    fracmax = frac;
+                    imax = i;
+                }
+            }
+        }
+        double ghi = whi * m_ghi[imax];
+        double glo = wlo * m_glo[imax];
+        double tmid = thi - (thi - tlo) * ghi / (ghi - glo);
+        if (!(tmid > tlo + 0.5 * ttol && tmid < thi - 0.5 * ttol)) {
+            tmid = 0.5 * (tlo + thi);
+        }
+        evalRoots(tmid, m_gmid.data());
+        bool lower = false;
+        for (size_t i = 0; i < m_nroots; i++) {
+            lower |= signChange(m_glo[i], m_gmid[i]);
+        }
+        if (lower) {
+            thi = tmid;
+            m_ghi.swap(m_gmid);
+            wlo = (side == 1) ? 0.5 * wlo : 1.0;
+            whi = 1.0;
+            side = 1;
+        } else {
+            tlo = tmid;
+            m_glo.swap(m_gmid);
+            whi = (side == 2) ? 0.5 * whi : 1.0;
+            wlo = 1.0;
+            side = 2;
+        }
+    }
+
+    // report the root at the end of the final bracket, where the root
+    // functions have changed sign
+    for (size_t i = 0; i < m_nroots; i++) {
+        if (signChange(m_g[i], m_ghi[i])) {
+            m_rootInfo[i] = (m_ghi[i] > m_g[i]) ? 1 : -1;
+        } else {
+            m_rootInfo[i] = 0;
+        }
+    }
+    m_troot = thi;
+    m_tg = thi;
+    m_g.swap(m_ghi);
+    interpolate(thi, 0, m_yout.data());
+    m_root_found = true;
+    return true;
+}
+
+double* OneStepIntegrator::derivative(double tout, int n)
+{
+    if (tout < m_tprev || tout > m_t || n < 0) {
+        throw CanteraError("OneStepIntegrator::derivative",
+            "Invalid arguments: t = {} outside [{}, {}] or n = {} < 0",
+            tout, m_tprev, m_t, n);
+    }
+    interpolate(tout, n, m_dky.data());
+    return m_dky.data();
+}
+
+void OneStepIntegrator::interpolate(double t, int n, double* out) const
+{
+    double h = m_t - m_tprev;
+    if (h == 0.0) {
+        for (size_t k = 0; k < m_neq; k++) {
+            out[k] = (n == 0) ? m_y[k] : 0.0;
+        }
+        return;
+    }
+    double th = (t - m_tprev) / h;
+    for (size_t k = 0; k < m_neq; k++) {
+        // coefficients of the interpolating polynomial in th
+        double dy = m_y[k] - m_yprev[k];
+        double a1 = h * m_fprev[k];
+        double a2 = 3 * dy - h * (2 * m_fprev[k] + m_f[k]);
+        double a3 = -2 * dy + h * (m_fprev[k] + m_f[k]);
+        switch (n) {
+        case 0:
+            out[k] = m_yprev[k] + th * (a1 + th * (a2 + th * a3));
+            break;
+        case 1:
+            out[k] = (a1 + th * (2 * a2 + 3 * th * a3)) / h;
+            break;
+        case 2:
+            out[k] = (2 * a2 + 6 * th * a3) / (h * h);
+            break;
+        case 3:
+            out[k] = 6 * a3 / (h * h * h);
+            break;
+        default:
+            out[k] = 0.0;
+        }
+    }
+}
+
+}
@@ -0,0 +1,226 @@
+//! @file RKCIntegrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/RKCIntegrator.h"
+
+namespace Cantera
+{
+
+namespace {
+// Number of accepted steps after which the spectral radius is re-estimated
+const size_t SpectralRadiusInterval = 25;
+}
+
+RKCIntegrator::RKCIntegrator()
+    : m_maxStages(250)
+    , m_maxStagesUsed(0)
+    , m_stages(2)
+    , m_spectralRadius(0.0)
+    , m_rho_step(npos)
+    , m_rho_nreject(0)
+{
+}
+
+void RKCIntegrator::setMaxStages(size_t nmax)
+{
+    if (nmax < 2) {
+        throw CanteraError("RKCIntegrator::setMaxStages",
+                           "At least two stages are required; got {}", nmax);
+    }
+    m_maxStages = nmax;
+}
+
+void RKCIntegrator::setup()
+{
+    m_eigvec.clear();
+    m_yjm1.assign(m_neq, 0.0);
+    m_yjm2.assign(m_neq, 0.0);
+    m_work.assign(m_neq, 0.0);
+    m_maxStagesUsed = 0;
+    m_rho_step = npos;
+}
+
+void RKCIntegrator::estimateSpectralRadius()
+{
+    // Nonlinear power method, following subroutine RKCRHO of Sommeijer et al.
+    const double uround = std::numeric_limits<double>::epsilon();
+    const double sqrtu = sqrt(uround);
+    auto norm = [](const vector_fp& x) {
+        double s = 0.0;
+        for (double v : x) {
+            s += v * v;
+        }
+        return sqrt(s);
+    };
+
+    // The starting direction is the previous eigenvector estimate, or the
+    // current derivative
+    vector_fp& v = m_work;
+    if (m_eigvec.size() == m_neq) {
+        v = m_eigvec;
+    } else {
+        v = m_f;
+    }
+    double ynorm = norm(m_y);
+    double vnorm = norm(v);
+    double dynorm;
+    if (ynorm != 0.0 && vnorm != 0.0) {
+        dynorm = ynorm * sqrtu;
+        for (size_t k = 0; k < m_neq; k++) {
+            v[k] = m_y[k] + v[k] * (dynorm / vnorm);
+        }
+    } else if (ynorm != 0.0) {
+        dynorm = ynorm * sqrtu;
+        for (size_t k = 0; k < m_neq; k++) {
+            v[k] = m_y[k] * (1.0 + sqrtu);
+        }
+    } else if (vnorm != 0.0) {
+        dynorm = uround;
+        for (size_t k = 0; k < m_neq; k++) {
+            v[k] *= dynorm / vnorm;
+        }
+    } else {
+        dynorm = uround;
+        v.assign(m_neq, dynorm);
+    }
+
+    double sigma = 0.0;
+    double sigmaMax = 0.0;
+    for (int iter = 0; iter < 20; iter++) {
+        if (!evalRHS(m_t, v.data(), m_yjm1.data())) {
+            throw CanteraError("RKCIntegrator::estimateSpectralRadius",
+                "Error evaluating the right hand side:\n{}", m_func->getErrors());
+        }
+        double dfnorm = 0.0;
+        for (size_t k = 0; k < m_neq; k++) {
+            dfnorm += std::pow(m_yjm1[k] - m_f[k], 2);
+        }
+        dfnorm = sqrt(dfnorm);
+        double sigmaLast = sigma;
+        sigma = dfnorm / dynorm;
+        sigmaMax = std::max(sigma, sigmaMax);
+        if (iter > 0 && std::abs(sigma - sigmaLast) <= 0.01 * sigma) {
+            sigmaMax = sigma;
+            break;
+        }
+        if (dfnorm != 0.0) {
+            for (size_t k = 0; k < m_neq; k++) {
+                v[k] = m_y[k] + (m_yjm1[k] - m_f[k]) * (dynorm / dfnorm);
+            }
+        } else {
+            // perturb one component to leave a fixed point
+            size_t k = iter % m_neq;
+            v[k] = m_y[k] - (v[k] - m_y[k]);
+        }
+    }
+
+    // The estimate may be somewhat smaller than the spectral radius, so a
+    // safety factor is applied. If the iteration does not converge, which
+    // happens when the dominant eigenvalues are complex, the largest estimate
+    // is used and the error control compensates for any remaining
+    // underestimate.
+    m_spectralRadius = 1.2 * sigmaMax;
+    m_eigvec.resize(m_neq);
+    for (size_t k = 0; k < m_neq; k++) {
+        m_eigvec[k] = v[k] - m_y[k];
+    }
+}
+
+double RKCIntegrator::limitStep(double h)
+{
+    if (m_rho_step == npos || m_nsteps >= m_rho_step + SpectralRadiusInterval
+        || m_nreject != m_rho_nreject) {
+        estimateSpectralRadius();
+        m_rho_step = m_nsteps;
+        m_rho_nreject = m_nreject;
+    }
+    // the stability region of the s-stage method contains the interval
+    // [-beta(s), 0], where beta(s) is approximately 0.653 s^2
+    double s = 1 + sqrt(1 + 1.54 * h * m_spectralRadius);
+    if (s > m_maxStages) {
+        s = m_maxStages;
+        h = (s * s - 1) / (1.54 * m_spectralRadius);
+    }
+    m_stages = std::max<size_t>(static_cast<size_t>(s), 2);
+    return h;
+}
+
+double RKCIntegrator::attemptStep(double h)
+{
+    size_t s = m_stages;
+    m_maxStagesUsed = std::max(m_maxStagesUsed, s);
+    double w0 = 1.0 + 2.0 / (13.0 * s * s);
+    double temp1 = w0 * w0 - 1.0;
+    double temp2 = sqrt(temp1);
+    double arg = s * log(w0 + temp2);
+    double w1 = sinh(arg) * temp1 / (cosh(arg) * s * temp2 - w0 * sinh(arg));
+    double bjm1 = 1.0 / std::pow(2.0 * w0, 2);
+    double bjm2 = bjm1;
+
+    // first stage
+    m_yjm2 = m_y;
+    double mus = w1 * bjm1;
+    for (size_t k = 0; k < m_neq; k++) {
+        m_yjm1[k] = m_y[k] + h * mus * m_f[k];
+    }
+    double thjm2 = 0.0;
+    double thjm1 = mus;
+    double zjm1 = w0;
+    double zjm2 = 1.0;
+    double dzjm1 = 1.0;
+    double dzjm2 = 0.0;
+    double d2zjm1 = 0.0;
+    double d2zjm2 = 0.0;
+
+    // stages 2 through s, using the recursion of the Chebyshev polynomials
+    for (size_t j = 2; j <= s; j++) {
+        double zj = 2.0 * w0 * zjm1 - zjm2;
+        double dzj = 2.0 * w0 * dzjm1 - dzjm2 + 2.0 * zjm1;
+        double d2zj = 2.0 * w0 * d2zjm1 - d2zjm2 + 4.0 * dzjm1;
+        double bj = d2zj / (dzj * dzj);
+        double ajm1 = 1.0 - zjm1 * bjm1;
+        double mu = 2.0 * w0 * bj / bjm1;
+        double nu = -bj / bjm2;
+        mus = mu * w1 / w0;
+        if (!evalRHS(m_t + h * thjm1, m_yjm1.data(), m_work.data())) {
+            return -1.0;
+        }
+        for (size_t k = 0; k < m_neq; k++) {
+            double yj = mu * m_yjm1[k] + nu * m_yjm2[k] + (1.0 - mu - nu) * m_y[k]
+                        + h * mus * (m_work[k] - ajm1 * m_f[k]);
+            m_yjm2[k] = m_yjm1[k];
+            m_yjm1[k] = yj;
+        }
+        double thj = mu * thjm1 + nu * thjm2 + mus * (1.0 - ajm1);
+        thjm2 = thjm1;
+        thjm1 = thj;
+        bjm2 = bjm1;
+        bjm1 = bj;
+        zjm2 = zjm1;
+        zjm1 = zj;
+        dzjm2 = dzjm1;
+        dzjm1 = dzj;
+        d2zjm2 = d2zjm1;
+        d2zjm1 = d2zj;
+    }
+    m_ynew = m_yjm1;
+    for (size_t k = 0; k < m_neq; k++) {
+        if (!std::isfinite(m_ynew[k])) {
+            return -1.0;
+        }
+    }
+
+    // error estimate, which requires the derivative at the new solution
+    if (!evalRHS(m_t + h, m_ynew.data(), m_fnew.data())) {
+        return -1.0;
+    }
+    m_fnew_ok = true;
+    for (size_t k = 0; k < m_neq; k++) {
+        m_work[k] = 0.8 * (m_y[k] - m_ynew[k]) + 0.4 * h * (m_f[k] + m_fnew[k]);
+    }
+    return errorNorm(m_work.data(), m_y.data(), m_ynew.data());
+}
+
+}
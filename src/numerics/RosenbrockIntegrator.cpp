@@ -0,0 +1,208 @@
+//! @file RosenbrockIntegrator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/numerics/RosenbrockIntegrator.h"
+
+namespace Cantera
+{
+
+RosenbrockIntegrator::RosenbrockIntegrator(const std::string& method)
+    : m_method(method)
+    , m_sparse(false)
+    , m_jac_step(npos)
+    , m_njevals(0)
+{
+    // Coefficients in the notation of Sandu et al. (1997). Coefficients of the
+    // lower triangular matrices are stored row by row.
+    if (method == "ROS4") {
+        m_order = 4;
+        m_a = {2.0,
+               1.867943637803922, 0.2344449711399156,
+               1.867943637803922, 0.2344449711399156, 0.0};
+        m_c = {-7.137615036412310,
+               2.580708087951457, 0.6515950076447975,
+               -2.137148994382534, -0.3214669691237626, -0.6949742501781779};
+        m_m = {2.255570073418735, 0.2870493262186792, 0.4353179431840180,
+               1.093502252409163};
+        m_e = {-0.2815431932141155, -0.07276199124938920, -0.1082196201495311,
+               -1.093502252409163};
+        m_alpha = {0.0, 1.14564, 0.65521686381559, 0.65521686381559};
+        m_gamma = {0.57282, -1.769193891319233, 0.7592633437920482,
+                   -0.1049021087100450};
+        m_newF = {true, true, true, false};
+    } else if (method == "RODAS3") {
+        m_order = 3;
+        m_a = {0.0,
+               2.0, 0.0,
+               2.0, 0.0, 1.0};
+        m_c = {4.0,
+               1.0, -1.0,
+               1.0, -1.0, -8.0 / 3.0};
+        m_m = {2.0, 0.0, 1.0, 1.0};
+        m_e = {0.0, 0.0, 0.0, 1.0};
+        m_alpha = {0.0, 0.0, 1.0, 1.0};
+        m_gamma = {0.5, 1.5, 0.0, 0.0};
+        m_newF = {true, false, true, true};
+    } else {
+        throw CanteraError("RosenbrockIntegrator::RosenbrockIntegrator",
+                           "Unknown method '{}'", method);
+    }
+    m_nstages = m_m.size();
+}
+
+void RosenbrockIntegrator::setProblemType(int probtype)
+{
+    if (probtype == SPARSE + JAC) {
+        m_sparse = true;
+    } else if (probtype == DENSE + NOJAC || probtype == DENSE + JAC) {
+        m_sparse = false;
+    } else {
+        throw CanteraError("RosenbrockIntegrator::setProblemType",
+            "Unsupported problem type: {}. Rosenbrock integrators require a "
+            "direct linear solver (DENSE or SPARSE).", probtype);
+    }
+    OneStepIntegrator::setProblemType(probtype);
+}
+
+void RosenbrockIntegrator::setup()
+{
+    m_dfdt.assign(m_neq, 0.0);
+    m_ystage.assign(m_neq, 0.0);
+    m_fstage.assign(m_neq, 0.0);
+    m_K.assign(m_nstages, Eigen::VectorXd::Zero(m_neq));
+    if (!m_sparse) {
+        m_dense_jac.resize(m_neq, m_neq);
+    }
+    m_njevals = 0;
+}
+
+void RosenbrockIntegrator::reinitialize(double t0, FuncEval& func)
+{
+    m_jac_step = npos;
+    OneStepIntegrator::reinitialize(t0, func);
+}
+
+bool RosenbrockIntegrator::evalJacobian()
+{
+    m_njevals++;
+    const double sqrtEps = sqrt(std::numeric_limits<double>::epsilon());
+    if (m_sparse) {
+        if (m_func->evalSparseJacobian_nothrow(m_t, m_y.data(), m_jac)) {
+            return false;
+        }
+    } else if (m_type == DENSE + JAC) {
+        m_ystage = m_y;
+        if (m_func->evalDenseJacobian_nothrow(m_t, m_ystage.data(), m_f.data(),
+                                              m_dense_jac.data())) {
+            return false;
+        }
+    } else {
+        m_ystage = m_y;
+        for (size_t j = 0; j < m_neq; j++) {
+            double delta = sqrtEps * std::max(std::abs(m_y[j]), atol(j) / m_rtol);
+            m_ystage[j] = m_y[j] + delta;
+            delta = m_ystage[j] - m_y[j];
+            if (!evalRHS(m_t, m_ystage.data(), m_fstage.data())) {
+                return false;
+            }
+            for (size_t i = 0; i < m_neq; i++) {
+                m_dense_jac(i, j) = (m_fstage[i] - m_f[i]) / delta;
+            }
+            m_ystage[j] = m_y[j];
+        }
+    }
+
+    // time derivative of the right hand side
+    double dt = sqrtEps * std::max(std::abs(m_t), 1.0e-5);
+    if (!evalRHS(m_t + dt, m_y.data(), m_dfdt.data())) {
+        return false;
+    }
+    for (size_t i = 0; i < m_neq; i++) {
+        m_dfdt[i] = (m_dfdt[i] - m_f[i]) / dt;
+    }
+    m_jac_step = m_nsteps;
+    return true;
+}
+
+bool RosenbrockIntegrator::factorize(double h)
+{
+    double ghinv = 1.0 / (m_gamma[0] * h);
+    if (m_sparse) {
+        Eigen::SparseMatrix<double> ident(m_neq, m_neq);
+        ident.setIdentity();
+        m_iter = ghinv * ident - m_jac;
+        m_sparseLU.compute(m_iter);
+        return m_sparseLU.info() == Eigen::Success;
+    } else {
+        m_denseLU.compute(ghinv * Eigen::MatrixXd::Identity(m_neq, m_neq)
+                          - m_dense_jac);
+        // PartialPivLU does not detect singular matrices
+        return std::isfinite(m_denseLU.rcond()) && m_denseLU.rcond() > 1e-300;
+    }
+}
+
+void RosenbrockIntegrator::solve(Eigen::VectorXd& x)
+{
+    if (m_sparse) {
+        x = m_sparseLU.solve(x);
+    } else {
+        x = m_denseLU.solve(x);
+    }
+}
+
+double RosenbrockIntegrator::attemptStep(double h)
+{
+    if (m_jac_step != m_nsteps && !evalJacobian()) {
+        return -1.0;
+    }
+    if (!factorize(h)) {
+        return -1.0;
+    }
+
+    const double* F = m_f.data();
+    for (size_t i = 0; i < m_nstages; i++) {
+        size_t offset = i * (i - 1) / 2;
+        if (i > 0 && m_newF[i]) {
+            m_ystage = m_y;
+            for (size_t j = 0; j < i; j++) {
+                double a = m_a[offset + j];
+                if (a != 0.0) {
+                    for (size_t k = 0; k < m_neq; k++) {
+                        m_ystage[k] += a * m_K[j][k];
+                    }
+                }
+            }
+            if (!evalRHS(m_t + m_alpha[i] * h, m_ystage.data(), m_fstage.data())) {
+                return -1.0;
+            }
+            F = m_fstage.data();
+        }
+        Eigen::VectorXd& K = m_K[i];
+        for (size_t k = 0; k < m_neq; k++) {
+            K[k] = F[k] + h * m_gamma[i] * m_dfdt[k];
+        }
+        for (size_t j = 0; j < i; j++) {
+            K += (m_c[offset + j] / h) * m_K[j];
+        }
+        solve(K);
+    }
+
+    m_ynew = m_y;
+    m_ystage.assign(m_neq, 0.0);
+    for (size_t j = 0; j < m_nstages; j++) {
+        for (size_t k = 0; k < m_neq; k++) {
+            m_ynew[k] += m_m[j] * m_K[j][k];
+            m_ystage[k] += m_e[j] * m_K[j][k];
+        }
+    }
+    for (size_t k = 0; k < m_neq; k++) {
+        if (!std::isfinite(m_ynew[k])) {
+            return -1.0;
+        }
+    }
+    return errorNorm(m_ystage.data(), m_y.data(), m_ynew.data());
+}
+
+}
@@ -66,6 +66,14 @@ void ConstCpPoly::updatePropertiesTemp(const doublereal temp,
     *s_R = m_s0_R + m_cp0_R * (logt - m_logt0);
 }
 
+void ConstCpPoly::updatePropertiesTemp_ddT(double temp, double* cp_R,
+                                           double* h_RT, double* s_R,
+                                           double* dcp_R_dT) const
+{
+    updatePropertiesTemp(temp, cp_R, h_RT, s_R);
+    *dcp_R_dT = 0.0;
+}
+
 void ConstCpPoly::reportParameters(size_t& n, int& type,
                                    doublereal& tlow, doublereal& thigh,
                                    doublereal& pref,
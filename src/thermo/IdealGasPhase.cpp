@@ -12,6 +12,8 @@
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/base/utilities.h"
 
+#include <thread>
+
 using namespace std;
 
 namespace Cantera
@@ -170,6 +172,12 @@ void IdealGasPhase::getCp_R(doublereal* cpr) const
     copy(_cpr.begin(), _cpr.end(), cpr);
 }
 
+void IdealGasPhase::getCp_R_ddT(double* dcpr) const
+{
+    _updateThermo_ddT();
+    copy(m_dcp0_R.begin(), m_dcp0_R.end(), dcpr);
+}
+
 void IdealGasPhase::getStandardVolumes(doublereal* vol) const
 {
     double tmp = 1.0 / molarDensity();
@@ -238,11 +246,269 @@ bool IdealGasPhase::addSpecies(shared_ptr<Species> spec)
         m_expg0_RT.push_back(0.0);
         m_cp0_R.push_back(0.0);
         m_s0_R.push_back(0.0);
+        m_dcp0_R.push_back(0.0);
         m_pp.push_back(0.0);
     }
     return added;
 }
 
+void IdealGasPhase::getPropertiesBatch(size_t nStates, const double* T,
+                                       const double* P, const double* Y,
+                                       double* h, double* cp, double* rho,
+                                       double* mw)
+{
+    auto eval = [&](size_t m0, size_t m1) {
+        evalPropertiesBatch(m0, m1, nStates, T, P, Y, h, cp, rho, mw);
+    };
+    if (!m_spthermo.prepareConcurrentUpdate()) {
+        eval(0, nStates);
+    } else {
+        evalChunks(nStates, eval);
+    }
+}
+
+void IdealGasPhase::solveTemperatureBatch_HP(size_t nStates, const double* h,
+                                             const double* P, const double* Y,
+                                             double* T, double tol)
+{
+    if (!m_spthermo.prepareConcurrentUpdate()) {
+        ThermoPhase::solveTemperatureBatch_HP(nStates, h, P, Y, T, tol);
+        return;
+    }
+    std::vector<char> failed(nStates, 0);
+    evalChunks(nStates, [&](size_t m0, size_t m1) {
+        solveTemperatureBatch(m0, m1, nStates, h, P, Y, T, tol, failed.data());
+    });
+
+    // Use the general method for any states where the iteration failed, which
+    // either finds a solution or provides a detailed error message
+    vector_fp y(m_kk);
+    for (size_t m = 0; m < nStates; m++) {
+        if (failed[m]) {
+            for (size_t k = 0; k < m_kk; k++) {
+                y[k] = Y[k * nStates + m];
+            }
+            ThermoPhase::solveTemperatureBatch_HP(1, &h[m], &P[m], y.data(),
+                                                  &T[m], tol);
+        }
+    }
+}
+
+void IdealGasPhase::evalChunks(size_t nStates,
+                               const std::function<void(size_t, size_t)>& eval) const
+{
+    // Minimum number of states evaluated by each thread, so that small
+    // batches are not dominated by the cost of starting threads
+    const size_t minChunk = 1024;
+    size_t nThreads = std::min(batchThreads(),
+                               (nStates + minChunk - 1) / minChunk);
+    if (nThreads <= 1) {
+        eval(0, nStates);
+        return;
+    }
+
+    // The first chunk is evaluated by the calling thread
+    size_t chunk = (nStates + nThreads - 1) / nThreads;
+    std::vector<std::thread> threads;
+    for (size_t m0 = chunk; m0 < nStates; m0 += chunk) {
+        threads.emplace_back(eval, m0, std::min(m0 + chunk, nStates));
+    }
+    eval(0, chunk);
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void IdealGasPhase::evalPropertiesBatch(size_t m0, size_t m1, size_t nStates,
+                                        const double* T, const double* P,
+                                        const double* Y, double* h, double* cp,
+                                        double* rho, double* mw) const
+{
+    const vector_fp& molwts = molecularWeights();
+    vector_fp rmolwts(m_kk), ym(m_kk);
+    for (size_t k = 0; k < m_kk; k++) {
+        rmolwts[k] = 1.0 / molwts[k];
+    }
+    vector_fp cp_R, h_RT, s_R;
+    if (h || cp) {
+        cp_R.resize(m_kk);
+        h_RT.resize(m_kk);
+        s_R.resize(m_kk);
+    }
+    for (size_t m = m0; m < m1; m++) {
+        // Normalize the mass fractions as in setMassFractions()
+        double sumY = 0.0;
+        double sumYM = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            double y = std::max(Y[k * nStates + m], 0.0);
+            ym[k] = y * rmolwts[k];
+            sumY += y;
+            sumYM += ym[k];
+        }
+        double mmw = sumY / sumYM;
+        if (h || cp) {
+            m_spthermo.update(T[m], cp_R.data(), h_RT.data(), s_R.data());
+            double hsum = 0.0;
+            double cpsum = 0.0;
+            for (size_t k = 0; k < m_kk; k++) {
+                hsum += ym[k] * h_RT[k];
+                cpsum += ym[k] * cp_R[k];
+            }
+            if (h) {
+                h[m] = GasConstant * T[m] * hsum / sumY;
+            }
+            if (cp) {
+                cp[m] = GasConstant * cpsum / sumY;
+            }
+        }
+        if (rho) {
+            rho[m] = P[m] * mmw / (GasConstant * T[m]);
+        }
+        if (mw) {
+            mw[m] = mmw;
+        }
+    }
+}
+
+void IdealGasPhase::solveTemperatureBatch(size_t m0, size_t m1,
+                                          size_t nStates, const double* h,
+                                          const double* P, const double* Y,
+                                          double* T, double tol,
+                                          char* failed) const
+{
+    const vector_fp& molwts = molecularWeights();
+    vector_fp w(m_kk);
+    for (size_t m = m0; m < m1; m++) {
+        // Normalize the mass fractions as in setMassFractions()
+        double sumY = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            double y = std::max(Y[k * nStates + m], 0.0);
+            w[k] = y / molwts[k];
+            sumY += y;
+        }
+        scale(w.begin(), w.end(), w.begin(), 1.0 / sumY);
+        double Tm = T[m];
+        if (solveTemperature(w.data(), h[m], P[m], false, false, Tm, tol)) {
+            T[m] = Tm;
+        } else {
+            failed[m] = 1;
+        }
+    }
+}
+
+void IdealGasPhase::setState_HP(double h, double p, double tol)
+{
+    double T = temperature();
+    if (p > 0 && solveTemperature(moleFractdivMMW(), h, p, false, false, T, tol)) {
+        setState_TP(T, p);
+    } else {
+        ThermoPhase::setState_HP(h, p, tol);
+    }
+}
+
+void IdealGasPhase::setState_UV(double u, double v, double tol)
+{
+    double T = temperature();
+    if (v > 0 && solveTemperature(moleFractdivMMW(), u, v, false, true, T, tol)) {
+        setState_TR(T, 1.0 / v);
+    } else {
+        ThermoPhase::setState_UV(u, v, tol);
+    }
+}
+
+void IdealGasPhase::setState_SP(double s, double p, double tol)
+{
+    double T = temperature();
+    if (p > 0 && solveTemperature(moleFractdivMMW(), s, p, true, false, T, tol)) {
+        setState_TP(T, p);
+    } else {
+        ThermoPhase::setState_SP(s, p, tol);
+    }
+}
+
+void IdealGasPhase::setState_SV(double s, double v, double tol)
+{
+    double T = temperature();
+    if (v > 0 && solveTemperature(moleFractdivMMW(), s, v, true, true, T, tol)) {
+        setState_TR(T, 1.0 / v);
+    } else {
+        ThermoPhase::setState_SV(s, v, tol);
+    }
+}
+
+bool IdealGasPhase::solveTemperature(const double* w, double target, double pv,
+                                     bool entropy, bool constV, double& T,
+                                     double rtol) const
+{
+    if (!std::isfinite(target) || !std::isfinite(pv) || !(T > 0)) {
+        return false;
+    }
+    // The sum of the weights is the inverse of the mean molecular weight
+    double wsum = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        wsum += w[k];
+    }
+    // Terms of the non-dimensional entropy which don't depend on the
+    // temperature: the entropy of mixing and the pressure correction. At
+    // constant volume, the pressure correction also includes a term in
+    // log(T), which is included in the iteration.
+    double sOffset = 0.0;
+    if (entropy) {
+        for (size_t k = 0; k < m_kk; k++) {
+            if (w[k] > 0) {
+                sOffset += w[k] * std::log(w[k] / wsum);
+            }
+        }
+        if (constV) {
+            sOffset += wsum * std::log(wsum * GasConstant / (pv * m_p0));
+        } else {
+            sOffset += wsum * std::log(pv / m_p0);
+        }
+    }
+    double target_R = target / GasConstant;
+
+    // Coefficients of the combined polynomial, valid for Tlow < T <= Thigh
+    double c[9];
+    double Tlow = 0.0;
+    double Thigh = -1.0;
+    for (int n = 0; n < 100; n++) {
+        if (!(T > Tlow && T <= Thigh)) {
+            if (!m_spthermo.combinedCoeffs(T, w, c, Tlow, Thigh)) {
+                return false;
+            }
+        }
+        double cp_R, h_RT, s_R;
+        PolyThermoBatchEvaluator::evalCoeffs(T, c, cp_R, h_RT, s_R);
+        // Residual and derivative of the (non-dimensional) target property
+        double f, dfdT;
+        if (entropy) {
+            f = s_R - sOffset;
+            dfdT = cp_R / T;
+            if (constV) {
+                f -= wsum * std::log(T);
+                dfdT -= wsum / T;
+            }
+        } else {
+            f = h_RT * T;
+            dfdT = cp_R;
+            if (constV) {
+                f -= wsum * T;
+                dfdT -= wsum;
+            }
+        }
+        if (!(dfdT > 0)) {
+            return false;
+        }
+        double Tnew = clip(T + (target_R - f) / dfdT, 0.5 * T, 2.0 * T);
+        if (std::abs(Tnew - T) <= rtol * Tnew) {
+            T = Tnew;
+            return true;
+        }
+        T = Tnew;
+    }
+    return false;
+}
+
 void IdealGasPhase::setToEquilState(const doublereal* mu_RT)
 {
     const vector_fp& grt = gibbs_RT_ref();
@@ -288,4 +554,24 @@ void IdealGasPhase::_updateThermo() const
         }
     }
 }
+
+void IdealGasPhase::_updateThermo_ddT() const
+{
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    double tnow = temperature();
+
+    if (cached.state1 != tnow) {
+        // Make sure that _updateThermo() considers the properties to be
+        // current, since they are overwritten here with the values computed
+        // together with the derivatives
+        _updateThermo();
+        m_spthermo.update_ddT(tnow, &m_cp0_R[0], &m_h0_RT[0], &m_s0_R[0],
+                              &m_dcp0_R[0]);
+        cached.state1 = tnow;
+        for (size_t k = 0; k < m_kk; k++) {
+            m_g0_RT[k] = m_h0_RT[k] - m_s0_R[k];
+        }
+    }
+}
 }
@@ -297,6 +297,42 @@ void MixtureFugacityTP::setPressure(doublereal p)
     }
 }
 
+void MixtureFugacityTP::getPropertiesBatch(size_t nStates, const double* T,
+                                           const double* P, const double* Y,
+                                           double* h, double* cp, double* rho,
+                                           double* mw)
+{
+    vector_fp state;
+    saveState(state);
+    vector_fp y(m_kk);
+    for (size_t m = 0; m < nStates; m++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            y[k] = Y[k * nStates + m];
+        }
+        // The mixing rules are evaluated by compositionChanged() for the new
+        // temperature, and are not re-evaluated when densityCalc() sets the
+        // same temperature again.
+        Phase::setTemperature(T[m]);
+        setMassFractions(y.data());
+        _updateReferenceStateThermo();
+        iState_ = phaseState(true);
+        setPressure(P[m]);
+        if (h) {
+            h[m] = enthalpy_mass();
+        }
+        if (cp) {
+            cp[m] = cp_mass();
+        }
+        if (rho) {
+            rho[m] = density();
+        }
+        if (mw) {
+            mw[m] = meanMolecularWeight();
+        }
+    }
+    restoreState(state);
+}
+
 void MixtureFugacityTP::compositionChanged()
 {
     Phase::compositionChanged();
@@ -132,6 +132,14 @@ void Mu0Poly::updatePropertiesTemp(const doublereal T,
     updateProperties(&T, cp_R, h_RT, s_R);
 }
 
+void Mu0Poly::updatePropertiesTemp_ddT(double T, double* cp_R, double* h_RT,
+                                       double* s_R, double* dcp_R_dT) const
+{
+    updateProperties(&T, cp_R, h_RT, s_R);
+    // the heat capacity is constant within each interval
+    *dcp_R_dT = 0.0;
+}
+
 size_t Mu0Poly::nCoeffs() const
 {
   return 2*m_numIntervals + 4;
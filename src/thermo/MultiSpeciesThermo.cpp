@@ -10,12 +10,328 @@
 
 #include "cantera/thermo/MultiSpeciesThermo.h"
 #include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/NasaPoly2.h"
+#include "cantera/thermo/ShomatePoly.h"
+#include "cantera/thermo/Nasa9PolyMultiTempRegion.h"
+#include "cantera/thermo/Nasa9Poly1.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/ctexceptions.h"
 
 namespace Cantera
 {
+
+namespace {
+const double Inf = std::numeric_limits<double>::infinity();
+
+//! Evaluate the NASA 9 polynomials of the *n* packed species with *R*
+//! temperature regions, with the arrays laid out as described for
+//! PolyThermoBatchEvaluator, and scatter the results to the species indices
+//! given by *species*. If *ddT* is `true`, the temperature derivative of the
+//! heat capacity is also computed.
+template <size_t R, bool ddT>
+void evalPackedPoly(size_t n, double T, const double* bounds,
+                    const double* coeffs, const size_t* species,
+                    double* cp_R, double* h_RT, double* s_R, double* dcp_R)
+{
+    double Tm1 = 1.0 / T;
+    double Tm2 = Tm1 * Tm1;
+    double logT = std::log(T);
+    double T2 = T * T;
+    double T3 = T2 * T;
+    double T4 = T3 * T;
+    // Basis functions for h/RT and s/R which differ from those for cp/R
+    double hTm1 = logT * Tm1;
+    double hT = 0.5 * T;
+    double hT2 = T2 / 3.0;
+    double hT3 = 0.25 * T3;
+    double hT4 = 0.2 * T4;
+    double sTm2 = 0.5 * Tm2;
+    double sT2 = 0.5 * T2;
+    double sT3 = T3 / 3.0;
+    double sT4 = 0.25 * T4;
+    // Basis functions for d(cp/R)/dT
+    double dTm3 = -2.0 * Tm2 * Tm1;
+    double dT = 2.0 * T;
+    double dT2 = 3.0 * T2;
+    double dT3 = 4.0 * T3;
+
+    // The species are processed in blocks, with the results stored in local
+    // arrays which can't alias the coefficients, so that the loop over the
+    // species in each block can be vectorized.
+    const size_t blockSize = 16;
+    double cp[blockSize], h[blockSize], s[blockSize], dcp[blockSize];
+    for (size_t i0 = 0; i0 < n; i0 += blockSize) {
+        size_t m = std::min(blockSize, n - i0);
+        const double* c_r[R][9];
+        for (size_t r = 0; r < R; r++) {
+            for (size_t j = 0; j < 9; j++) {
+                c_r[r][j] = coeffs + (r * 9 + j) * n + i0;
+            }
+        }
+        const double* b = bounds + i0;
+        for (size_t i = 0; i < m; i++) {
+            // select the coefficients for the current temperature region
+            double c[9];
+            for (size_t j = 0; j < 9; j++) {
+                c[j] = c_r[0][j][i];
+            }
+            for (size_t r = 1; r < R; r++) {
+                bool above = T > b[(r - 1) * n + i];
+                for (size_t j = 0; j < 9; j++) {
+                    double cj = c_r[r][j][i];
+                    c[j] = above ? cj : c[j];
+                }
+            }
+            cp[i] = c[0] * Tm2 + c[1] * Tm1 + c[2] + c[3] * T + c[4] * T2
+                    + c[5] * T3 + c[6] * T4;
+            h[i] = -c[0] * Tm2 + c[1] * hTm1 + c[2] + c[3] * hT + c[4] * hT2
+                   + c[5] * hT3 + c[6] * hT4 + c[7] * Tm1;
+            s[i] = -c[0] * sTm2 - c[1] * Tm1 + c[2] * logT + c[3] * T
+                   + c[4] * sT2 + c[5] * sT3 + c[6] * sT4 + c[8];
+            if (ddT) {
+                dcp[i] = c[0] * dTm3 - c[1] * Tm2 + c[3] + c[4] * dT
+                         + c[5] * dT2 + c[6] * dT3;
+            }
+        }
+        for (size_t i = 0; i < m; i++) {
+            size_t k = species[i0 + i];
+            cp_R[k] = cp[i];
+            h_RT[k] = h[i];
+            s_R[k] = s[i];
+            if (ddT) {
+                dcp_R[k] = dcp[i];
+            }
+        }
+    }
+}
+}
+
+bool PolyThermoBatchEvaluator::install(size_t k,
+                                       const SpeciesThermoInterpType& stit)
+{
+    vector_fp bounds, coeffs;
+    if (!convert(stit, bounds, coeffs)) {
+        return false;
+    }
+    if (k >= m_pos.size()) {
+        m_pos.resize(k + 1, npos);
+    }
+    if (m_pos[k] == npos) {
+        m_pos[k] = m_species.size();
+        m_species.push_back(k);
+        m_speciesBounds.emplace_back();
+        m_speciesCoeffs.emplace_back();
+    }
+    m_speciesBounds[m_pos[k]] = std::move(bounds);
+    m_speciesCoeffs[m_pos[k]] = std::move(coeffs);
+    m_ok = false;
+    return true;
+}
+
+bool PolyThermoBatchEvaluator::replace(size_t k,
+                                       const SpeciesThermoInterpType& stit)
+{
+    if (!contains(k)) {
+        return false;
+    }
+    if (!install(k, stit)) {
+        remove(k);
+        return false;
+    }
+    return true;
+}
+
+void PolyThermoBatchEvaluator::remove(size_t k)
+{
+    if (!contains(k)) {
+        return;
+    }
+    size_t pos = m_pos[k];
+    m_species.erase(m_species.begin() + pos);
+    m_speciesBounds.erase(m_speciesBounds.begin() + pos);
+    m_speciesCoeffs.erase(m_speciesCoeffs.begin() + pos);
+    m_pos[k] = npos;
+    for (size_t i = pos; i < m_species.size(); i++) {
+        m_pos[m_species[i]] = i;
+    }
+    m_ok = false;
+}
+
+bool PolyThermoBatchEvaluator::convert(const SpeciesThermoInterpType& stit,
+                                       vector_fp& bounds, vector_fp& coeffs)
+{
+    size_t n;
+    int type;
+    double tlow, thigh, pref;
+    vector_fp c(15);
+    bounds.clear();
+    coeffs.clear();
+
+    // NASA 7-coefficient polynomial [a0, ..., a6]
+    auto addNasa7 = [&](const double* a) {
+        coeffs.insert(coeffs.end(), {0.0, 0.0, a[0], a[1], a[2], a[3], a[4],
+                                     a[5], a[6]});
+    };
+    // Shomate polynomial [A, ..., G] on a kJ/mol basis, where t = T/1000
+    auto addShomate = [&](const double* a) {
+        double f = 1000 / GasConstant;
+        coeffs.insert(coeffs.end(), {a[4] * f * 1e6, 0.0, a[0] * f,
+            a[1] * f * 1e-3, a[2] * f * 1e-6, a[3] * f * 1e-9, 0.0,
+            a[5] * f * 1e3, (a[6] - a[0] * log(1000.0)) * f});
+    };
+
+    if (dynamic_cast<const NasaPoly2*>(&stit)) {
+        stit.reportParameters(n, type, tlow, thigh, pref, c.data());
+        bounds.push_back(c[0]);
+        addNasa7(&c[8]);
+        addNasa7(&c[1]);
+    } else if (dynamic_cast<const NasaPoly1*>(&stit)) {
+        stit.reportParameters(n, type, tlow, thigh, pref, c.data());
+        addNasa7(&c[0]);
+    } else if (dynamic_cast<const ShomatePoly2*>(&stit)) {
+        stit.reportParameters(n, type, tlow, thigh, pref, c.data());
+        bounds.push_back(c[0]);
+        addShomate(&c[1]);
+        addShomate(&c[8]);
+    } else if (dynamic_cast<const ShomatePoly*>(&stit)) {
+        stit.reportParameters(n, type, tlow, thigh, pref, c.data());
+        addShomate(&c[0]);
+    } else if (dynamic_cast<const Nasa9PolyMultiTempRegion*>(&stit)
+               || dynamic_cast<const Nasa9Poly1*>(&stit)) {
+        // [nRegions, (tlow, thigh, a0, ..., a8) for each region]
+        if (dynamic_cast<const Nasa9PolyMultiTempRegion*>(&stit)) {
+            c.resize(stit.nCoeffs());
+        }
+        stit.reportParameters(n, type, tlow, thigh, pref, c.data());
+        size_t nRegions = static_cast<size_t>(c[0]);
+        if (nRegions > 3) {
+            return false;
+        }
+        for (size_t i = 0; i < nRegions; i++) {
+            if (i > 0) {
+                // regions start at their lower limit, inclusive
+                bounds.push_back(std::nextafter(c[1 + 11*i], -Inf));
+            }
+            coeffs.insert(coeffs.end(), &c[3 + 11*i], &c[12 + 11*i]);
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void PolyThermoBatchEvaluator::build()
+{
+    size_t n = m_species.size();
+    m_nregions = 1;
+    for (const auto& bounds : m_speciesBounds) {
+        m_nregions = std::max(m_nregions, bounds.size() + 1);
+    }
+    m_bounds.assign((m_nregions - 1) * n, Inf);
+    m_coeffs.assign(m_nregions * 9 * n, 0.0);
+    for (size_t i = 0; i < n; i++) {
+        const vector_fp& bounds = m_speciesBounds[i];
+        const vector_fp& coeffs = m_speciesCoeffs[i];
+        for (size_t r = 0; r < bounds.size(); r++) {
+            m_bounds[r * n + i] = bounds[r];
+        }
+        for (size_t r = 0; r < m_nregions; r++) {
+            // regions beyond the last one of this species are never selected
+            size_t rr = std::min(r, bounds.size());
+            for (size_t j = 0; j < 9; j++) {
+                m_coeffs[(r * 9 + j) * n + i] = coeffs[rr * 9 + j];
+            }
+        }
+    }
+    m_ok = true;
+}
+
+void PolyThermoBatchEvaluator::update(double T, double* cp_R, double* h_RT,
+                                      double* s_R, double* dcp_R_dT)
+{
+    prepare();
+    if (dcp_R_dT) {
+        evalPacked<true>(T, cp_R, h_RT, s_R, dcp_R_dT);
+    } else {
+        evalPacked<false>(T, cp_R, h_RT, s_R, dcp_R_dT);
+    }
+}
+
+void PolyThermoBatchEvaluator::combine(double T, const double* w,
+                                       double* coeffs, double& Tlow,
+                                       double& Thigh) const
+{
+    std::fill(coeffs, coeffs + 9, 0.0);
+    Tlow = 0.0;
+    Thigh = Inf;
+    for (size_t i = 0; i < m_species.size(); i++) {
+        double wi = w[m_species[i]];
+        if (wi == 0.0) {
+            continue;
+        }
+        const vector_fp& bounds = m_speciesBounds[i];
+        size_t r = 0;
+        while (r < bounds.size() && T > bounds[r]) {
+            r++;
+        }
+        if (r > 0) {
+            Tlow = std::max(Tlow, bounds[r - 1]);
+        }
+        if (r < bounds.size()) {
+            Thigh = std::min(Thigh, bounds[r]);
+        }
+        const double* c = &m_speciesCoeffs[i][9 * r];
+        for (size_t j = 0; j < 9; j++) {
+            coeffs[j] += wi * c[j];
+        }
+    }
+}
+
+void PolyThermoBatchEvaluator::evalCoeffs(double T, const double* c,
+                                          double& cp_R, double& h_RT,
+                                          double& s_R)
+{
+    double Tm1 = 1.0 / T;
+    double Tm2 = Tm1 * Tm1;
+    double logT = std::log(T);
+    double T2 = T * T;
+    double T3 = T2 * T;
+    double T4 = T3 * T;
+    cp_R = c[0] * Tm2 + c[1] * Tm1 + c[2] + c[3] * T + c[4] * T2 + c[5] * T3
+           + c[6] * T4;
+    h_RT = -c[0] * Tm2 + c[1] * logT * Tm1 + c[2] + 0.5 * c[3] * T
+           + c[4] * T2 / 3.0 + 0.25 * c[5] * T3 + 0.2 * c[6] * T4 + c[7] * Tm1;
+    s_R = -0.5 * c[0] * Tm2 - c[1] * Tm1 + c[2] * logT + c[3] * T
+          + 0.5 * c[4] * T2 + c[5] * T3 / 3.0 + 0.25 * c[6] * T4 + c[8];
+}
+
+template <bool ddT>
+void PolyThermoBatchEvaluator::evalPacked(double T, double* cp_R, double* h_RT,
+                                          double* s_R, double* dcp_R_dT) const
+{
+    // The kernel is instantiated for each supported number of regions so that
+    // the loops over the regions can be unrolled
+    size_t n = m_species.size();
+    const double* b = m_bounds.data();
+    const double* c = m_coeffs.data();
+    const size_t* k = m_species.data();
+    switch (m_nregions) {
+    case 1:
+        evalPackedPoly<1, ddT>(n, T, b, c, k, cp_R, h_RT, s_R, dcp_R_dT);
+        break;
+    case 2:
+        evalPackedPoly<2, ddT>(n, T, b, c, k, cp_R, h_RT, s_R, dcp_R_dT);
+        break;
+    case 3:
+        evalPackedPoly<3, ddT>(n, T, b, c, k, cp_R, h_RT, s_R, dcp_R_dT);
+        break;
+    default:
+        throw CanteraError("PolyThermoBatchEvaluator::update",
+                           "Unexpected number of regions: {}", m_nregions);
+    }
+}
+
 MultiSpeciesThermo::MultiSpeciesThermo() :
     m_tlow_max(0.0),
     m_thigh_min(1.0E30),
@@ -36,6 +352,9 @@ void MultiSpeciesThermo::install_STIT(size_t index,
     int type = stit_ptr->reportType();
     m_speciesLoc[index] = {type, m_sp[type].size()};
     m_sp[type].emplace_back(index, stit_ptr);
+    if (!m_packed.install(index, *stit_ptr)) {
+        m_unpackedTypes.insert(type);
+    }
     if (m_sp[type].size() == 1) {
         m_tpoly[type].resize(stit_ptr->temperaturePolySize());
     }
@@ -76,6 +395,9 @@ void MultiSpeciesThermo::modifySpecies(size_t index,
     }
 
     m_sp[type][m_speciesLoc[index].second] = {index, spthermo};
+    if (!m_packed.replace(index, *spthermo)) {
+        m_unpackedTypes.insert(type);
+    }
 }
 
 void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
@@ -90,9 +412,15 @@ void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
 void MultiSpeciesThermo::update(doublereal t, doublereal* cp_R,
                                   doublereal* h_RT, doublereal* s_R) const
 {
+    if (m_packed.nSpecies()) {
+        m_packed.update(t, cp_R, h_RT, s_R);
+    }
     auto iter = m_sp.begin();
     auto jter = m_tpoly.begin();
     for (; iter != m_sp.end(); iter++, jter++) {
+        if (!m_unpackedTypes.count(iter->first)) {
+            continue;
+        }
         const std::vector<index_STIT>& species = iter->second;
         double* tpoly = &jter->second[0];
         species[0].second->updateTemperaturePoly(t, tpoly);
@@ -103,6 +431,42 @@ void MultiSpeciesThermo::update(doublereal t, doublereal* cp_R,
     }
 }
 
+bool MultiSpeciesThermo::prepareConcurrentUpdate() const
+{
+    if (m_packed.nSpecies()) {
+        m_packed.prepare();
+    }
+    return m_unpackedTypes.empty();
+}
+
+bool MultiSpeciesThermo::combinedCoeffs(double T, const double* w,
+                                        double* coeffs, double& Tlow,
+                                        double& Thigh) const
+{
+    if (!m_unpackedTypes.empty()) {
+        return false;
+    }
+    m_packed.combine(T, w, coeffs, Tlow, Thigh);
+    return true;
+}
+
+void MultiSpeciesThermo::update_ddT(double t, double* cp_R, double* h_RT,
+                                    double* s_R, double* dcp_R_dT) const
+{
+    if (m_packed.nSpecies()) {
+        m_packed.update(t, cp_R, h_RT, s_R, dcp_R_dT);
+    }
+    for (const auto& type : m_unpackedTypes) {
+        for (const auto& sp : m_sp.at(type)) {
+            size_t i = sp.first;
+            if (!m_packed.contains(i)) {
+                sp.second->updatePropertiesTemp_ddT(t, cp_R+i, h_RT+i, s_R+i,
+                                                    dcp_R_dT+i);
+            }
+        }
+    }
+}
+
 int MultiSpeciesThermo::reportType(size_t index) const
 {
     const SpeciesThermoInterpType* sp = provideSTIT(index);
@@ -194,6 +558,9 @@ void MultiSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298Ne
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
+        if (!m_packed.replace(k, *sp_ptr)) {
+            m_unpackedTypes.insert(m_speciesLoc[k].first);
+        }
     }
 }
 
@@ -202,6 +569,9 @@ void MultiSpeciesThermo::resetHf298(const size_t k)
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->resetHf298();
+        if (!m_packed.replace(k, *sp_ptr)) {
+            m_unpackedTypes.insert(m_speciesLoc[k].first);
+        }
     }
 }
 
@@ -89,6 +89,21 @@ void Nasa9Poly1::updatePropertiesTemp(const doublereal temp,
     updateProperties(tPoly, cp_R, h_RT, s_R);
 }
 
+void Nasa9Poly1::updatePropertiesTemp_ddT(double temp, double* cp_R,
+                                          double* h_RT, double* s_R,
+                                          double* dcp_R_dT) const
+{
+    double tPoly[7];
+    updateTemperaturePoly(temp, tPoly);
+    updateProperties(tPoly, cp_R, h_RT, s_R);
+    *dcp_R_dT = - 2.0 * m_coeff[0] * tPoly[5] * tPoly[4] // -2 a0 / T^3
+                - m_coeff[1] * tPoly[5] // -a1 / T^2
+                + m_coeff[3] // a3
+                + 2.0 * m_coeff[4] * tPoly[0] // 2 a4 * T
+                + 3.0 * m_coeff[5] * tPoly[1] // 3 a5 * T^2
+                + 4.0 * m_coeff[6] * tPoly[2]; // 4 a6 * T^3
+}
+
 void Nasa9Poly1::reportParameters(size_t& n, int& type,
                                   doublereal& tlow, doublereal& thigh,
                                   doublereal& pref,
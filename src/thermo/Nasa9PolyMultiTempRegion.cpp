@@ -157,6 +157,21 @@ void Nasa9PolyMultiTempRegion::updatePropertiesTemp(const doublereal temp,
     m_regionPts[m_currRegion]->updatePropertiesTemp(temp, cp_R, h_RT, s_R);
 }
 
+void Nasa9PolyMultiTempRegion::updatePropertiesTemp_ddT(double temp,
+        double* cp_R, double* h_RT, double* s_R, double* dcp_R_dT) const
+{
+    m_currRegion = 0;
+    for (size_t i = 1; i < m_regionPts.size(); i++) {
+        if (temp < m_lowerTempBounds[i]) {
+            break;
+        }
+        m_currRegion++;
+    }
+
+    m_regionPts[m_currRegion]->updatePropertiesTemp_ddT(temp, cp_R, h_RT, s_R,
+                                                        dcp_R_dT);
+}
+
 size_t Nasa9PolyMultiTempRegion::nCoeffs() const
 {
     return 11*m_regionPts.size() + 1;
@@ -24,6 +24,8 @@ PengRobinson::PengRobinson(const std::string& infile, const std::string& id_) :
     m_b(0.0),
     m_a(0.0),
     m_aAlpha_mix(0.0),
+    m_mixTemp(NAN),
+    m_mixStateNum(-2),
     m_NSolns(0),
     m_dpdV(0.0),
     m_dpdT(0.0)
@@ -50,15 +52,7 @@ void PengRobinson::setSpeciesCoeffs(const std::string& species, double a, double
     }
     m_acentric[k] = w; // store the original acentric factor to enable serialization
 
-    // Calculate alpha (temperature dependent interaction parameter)
-    double critTemp = speciesCritTemperature(a, b);
-    double sqt_T_r = sqrt(temperature() / critTemp);
-    double sqt_alpha = 1 + m_kappa[k] * (1 - sqt_T_r);
-    m_alpha[k] = sqt_alpha*sqt_alpha;
-
     m_a_coeffs(k,k) = a;
-    double aAlpha_k = a*m_alpha[k];
-    m_aAlpha_binary(k,k) = aAlpha_k;
 
     // standard mixing rule for cross-species interaction term
     for (size_t j = 0; j < m_kk; j++) {
@@ -66,16 +60,16 @@ void PengRobinson::setSpeciesCoeffs(const std::string& species, double a, double
             continue;
         }
         double a0kj = sqrt(m_a_coeffs(j,j) * a);
-        double aAlpha_j = a*m_alpha[j];
-        double a_Alpha = sqrt(aAlpha_j*aAlpha_k);
         if (m_a_coeffs(j, k) == 0) {
             m_a_coeffs(j, k) = a0kj;
-            m_aAlpha_binary(j, k) = a_Alpha;
             m_a_coeffs(k, j) = a0kj;
-            m_aAlpha_binary(k, j) = a_Alpha;
         }
     }
     m_b_coeffs[k] = b;
+
+    // alpha and the mixing rule sums are re-evaluated for the new coefficients
+    // at the next call to updateMixingExpressions()
+    m_mixTemp = NAN;
 }
 
 void PengRobinson::setBinaryCoeffs(const std::string& species_i,
@@ -95,9 +89,7 @@ void PengRobinson::setBinaryCoeffs(const std::string& species_i,
     m_a_coeffs(ki, kj) = m_a_coeffs(kj, ki) = a0;
     m_binaryParameters[species_i][species_j] = a0;
     m_binaryParameters[species_j][species_i] = a0;
-    // Calculate alpha_ij
-    double alpha_ij = m_alpha[ki] * m_alpha[kj];
-    m_aAlpha_binary(ki, kj) = m_aAlpha_binary(kj, ki) = a0*alpha_ij;
+    m_mixTemp = NAN;
 }
 
 // ------------Molar Thermodynamic Properties -------------------------
@@ -148,18 +140,12 @@ void PengRobinson::getActivityCoefficients(double* ac) const
     double vmb = mv - m_b;
     double pres = pressure();
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            m_pp[k] += moleFractions_[i] * m_aAlpha_binary(k, i);
-        }
-    }
     double num = 0;
     double denom = 2 * Sqrt2 * m_b * m_b;
     double denom2 = m_b * (mv * mv + 2 * mv * m_b - m_b * m_b);
     double RT_ = RT();
     for (size_t k = 0; k < m_kk; k++) {
-        num = 2 * m_b * m_pp[k] - m_aAlpha_mix * m_b_coeffs[k];
+        num = 2 * m_b * m_aAlphaSum[k] - m_aAlpha_mix * m_b_coeffs[k];
         ac[k] = (-RT_ * log(pres * mv/ RT_) + RT_ * log(mv / vmb)
                  + RT_ * m_b_coeffs[k] / vmb
                  - (num /denom) * log(vpb2/vmb2)
@@ -187,19 +173,13 @@ void PengRobinson::getChemPotentials(double* mu) const
     double vpb2 = mv + (1 + Sqrt2) * m_b;
     double vmb2 = mv + (1 - Sqrt2) * m_b;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            m_pp[k] += moleFractions_[i] * m_aAlpha_binary(k, i);
-        }
-    }
     double pres = pressure();
     double refP = refPressure();
     double denom = 2 * Sqrt2 * m_b * m_b;
     double denom2 = m_b * (mv * mv + 2 * mv * m_b - m_b * m_b);
 
     for (size_t k = 0; k < m_kk; k++) {
-        double num = 2 * m_b * m_pp[k] - m_aAlpha_mix * m_b_coeffs[k];
+        double num = 2 * m_b * m_aAlphaSum[k] - m_aAlpha_mix * m_b_coeffs[k];
 
         mu[k] += RT_ * log(pres/refP) - RT_ * log(pres * mv / RT_)
                  + RT_ * log(mv / vmb) + RT_ * m_b_coeffs[k] / vmb
@@ -225,13 +205,7 @@ void PengRobinson::getPartialMolarEnthalpies(double* hbar) const
     double daAlphadT = daAlpha_dT();
 
     for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        tmp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            double grad_aAlpha = m_dalphadT[i]/m_alpha[i] + m_dalphadT[k]/m_alpha[k];
-            m_pp[k] += moleFractions_[i] * m_aAlpha_binary(k, i);
-            tmp[k] +=moleFractions_[i] * m_aAlpha_binary(k, i) * grad_aAlpha;
-        }
+        tmp[k] = m_aAlphaDerivSum[k] + m_dalphadT[k] / m_alpha[k] * m_aAlphaSum[k];
     }
 
     double denom = mv * mv + 2 * mv * m_b - m_b * m_b;
@@ -239,7 +213,7 @@ void PengRobinson::getPartialMolarEnthalpies(double* hbar) const
     double RT_ = RT();
     for (size_t k = 0; k < m_kk; k++) {
         m_dpdni[k] = RT_ / vmb + RT_ * m_b_coeffs[k] / (vmb * vmb)
-            - 2.0 * m_pp[k] / denom + 2 * vmb * m_aAlpha_mix * m_b_coeffs[k] / denom2;
+            - 2.0 * m_aAlphaSum[k] / denom + 2 * vmb * m_aAlpha_mix * m_b_coeffs[k] / denom2;
     }
 
     double fac = T * daAlphadT - m_aAlpha_mix;
@@ -248,7 +222,7 @@ void PengRobinson::getPartialMolarEnthalpies(double* hbar) const
     double fac3 = 2 * Sqrt2 * m_b * m_b;
     double fac4 = 0;
     for (size_t k = 0; k < m_kk; k++) {
-        fac4 = T*tmp[k] -2 * m_pp[k];
+        fac4 = T*tmp[k] -2 * m_aAlphaSum[k];
         double hE_v = mv * m_dpdni[k] - RT_
                      - m_b_coeffs[k] / fac3 * log(vpb2 / vmb2) * fac
                      + (mv * m_b_coeffs[k]) / (m_b * denom) * fac
@@ -287,12 +261,6 @@ void PengRobinson::getPartialMolarCp(double* cpbar) const
 
 void PengRobinson::getPartialMolarVolumes(double* vbar) const
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            m_pp[k] += moleFractions_[i] * m_aAlpha_binary(k, i);
-        }
-    }
 
     double mv = molarVolume();
     double vmb = mv - m_b;
@@ -303,7 +271,7 @@ void PengRobinson::getPartialMolarVolumes(double* vbar) const
 
     for (size_t k = 0; k < m_kk; k++) {
         double num = RT_ + RT_ * m_b/ vmb + RT_ * m_b_coeffs[k] / vmb
-                     + RT_ * m_b * m_b_coeffs[k] /(vmb * vmb) - 2 * mv * m_pp[k] / fac
+                     + RT_ * m_b * m_b_coeffs[k] /(vmb * vmb) - 2 * mv * m_aAlphaSum[k] / fac
                      + 2 * mv * vmb * m_aAlpha_mix * m_b_coeffs[k] / fac2;
         double denom = pressure() + RT_ * m_b / (vmb * vmb) + m_aAlpha_mix/fac
                        - 2 * mv* vpb * m_aAlpha_mix / fac2;
@@ -328,16 +296,17 @@ bool PengRobinson::addSpecies(shared_ptr<Species> spec)
     if (added) {
         m_a_coeffs.resize(m_kk, m_kk, 0.0);
         m_b_coeffs.push_back(0.0);
-        m_aAlpha_binary.resize(m_kk, m_kk, 0.0);
         m_kappa.push_back(0.0);
         m_acentric.push_back(0.0);
         m_alpha.push_back(0.0);
         m_dalphadT.push_back(0.0);
         m_d2alphadT2.push_back(0.0);
-        m_pp.push_back(0.0);
+        m_aAlphaSum.push_back(0.0);
+        m_aAlphaDerivSum.push_back(0.0);
         m_partialMolarVolumes.push_back(0.0);
         m_dpdni.push_back(0.0);
         m_coeffSource.push_back(CoeffSource::EoS);
+        m_mixTemp = NAN;
     }
     return added;
 }
@@ -646,87 +615,80 @@ void PengRobinson::calculatePressureDerivatives() const
 void PengRobinson::updateMixingExpressions()
 {
     double temp = temperature();
+    if (temp == m_mixTemp && stateMFNumber() == m_mixStateNum) {
+        return;
+    }
 
-    // Update individual alpha
-    for (size_t j = 0; j < m_kk; j++) {
-        double critTemp_j = speciesCritTemperature(m_a_coeffs(j,j), m_b_coeffs[j]);
-        double sqt_alpha = 1 + m_kappa[j] * (1 - sqrt(temp / critTemp_j));
-        m_alpha[j] = sqt_alpha*sqt_alpha;
+    if (temp != m_mixTemp) {
+        // Update individual alpha and its temperature derivatives
+        for (size_t j = 0; j < m_kk; j++) {
+            double critTemp_j = speciesCritTemperature(m_a_coeffs(j,j), m_b_coeffs[j]);
+            double sqt_Tr = sqrt(temp / critTemp_j);
+            double sqt_alpha = 1 + m_kappa[j] * (1 - sqt_Tr);
+            m_alpha[j] = sqt_alpha*sqt_alpha;
+            double coeff1 = 1 / (critTemp_j*sqt_Tr);
+            double k = m_kappa[j];
+            m_dalphadT[j] = coeff1 * (k*k*(sqt_Tr - 1) - k);
+            m_d2alphadT2[j] = (k*k + k) * coeff1 / (2*sqt_Tr*sqt_Tr*critTemp_j);
+        }
     }
 
-    // Update aAlpha_i, j
+    // Accumulate the species sums column by column, using
+    // (a alpha)_ki = a_ki sqrt(alpha_k) sqrt(alpha_i), which avoids evaluating
+    // m_kk^2 square roots and leaves a contiguous inner loop.
+    std::fill(m_aAlphaSum.begin(), m_aAlphaSum.end(), 0.0);
+    std::fill(m_aAlphaDerivSum.begin(), m_aAlphaDerivSum.end(), 0.0);
+    m_a = 0.0;
+    m_b = 0.0;
     for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j < m_kk; j++) {
-            m_aAlpha_binary(i, j) = sqrt(m_alpha[i] * m_alpha[j]) * m_a_coeffs(i,j);
+        double w = moleFractions_[i] * sqrt(m_alpha[i]);
+        double wg = w * m_dalphadT[i] / m_alpha[i];
+        const double* a_i = m_a_coeffs.ptrColumn(i);
+        double ax = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            m_aAlphaSum[k] += a_i[k] * w;
+            m_aAlphaDerivSum[k] += a_i[k] * wg;
+            ax += a_i[k] * moleFractions_[k];
         }
+        m_a += moleFractions_[i] * ax;
+        m_b += moleFractions_[i] * m_b_coeffs[i];
+    }
+    m_aAlpha_mix = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        double sqt_alpha = sqrt(m_alpha[k]);
+        m_aAlphaSum[k] *= sqt_alpha;
+        m_aAlphaDerivSum[k] *= sqt_alpha;
+        m_aAlpha_mix += moleFractions_[k] * m_aAlphaSum[k];
     }
-    calculateAB(m_a,m_b,m_aAlpha_mix);
+    m_mixTemp = temp;
+    m_mixStateNum = stateMFNumber();
 }
 
 void PengRobinson::calculateAB(double& aCalc, double& bCalc, double& aAlphaCalc) const
 {
-    bCalc = 0.0;
-    aCalc = 0.0;
-    aAlphaCalc = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        bCalc += moleFractions_[i] * m_b_coeffs[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            aCalc += m_a_coeffs(i, j) * moleFractions_[i] * moleFractions_[j];
-            aAlphaCalc += m_aAlpha_binary(i, j) * moleFractions_[i] * moleFractions_[j];
-        }
-    }
+    aCalc = m_a;
+    bCalc = m_b;
+    aAlphaCalc = m_aAlpha_mix;
 }
 
 double PengRobinson::daAlpha_dT() const
 {
-    double daAlphadT = 0.0, k, Tc, sqtTr, coeff1, coeff2;
+    // d(a alpha)_ij/dT = 0.5 (a alpha)_ij (alpha'_i/alpha_i + alpha'_j/alpha_j)
+    double daAlphadT = 0.0;
     for (size_t i = 0; i < m_kk; i++) {
-        // Calculate first derivative of alpha for individual species
-        Tc = speciesCritTemperature(m_a_coeffs(i,i), m_b_coeffs[i]);
-        sqtTr = sqrt(temperature() / Tc);
-        coeff1 = 1 / (Tc*sqtTr);
-        coeff2 = sqtTr - 1;
-        k = m_kappa[i];
-        m_dalphadT[i] = coeff1 * (k*k*coeff2 - k);
-    }
-    // Calculate mixture derivative
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j < m_kk; j++) {
-            daAlphadT += moleFractions_[i] * moleFractions_[j] * 0.5
-                         * m_aAlpha_binary(i, j)
-                         * (m_dalphadT[i] / m_alpha[i] + m_dalphadT[j] / m_alpha[j]);
-        }
+        daAlphadT += moleFractions_[i] * m_dalphadT[i] / m_alpha[i] * m_aAlphaSum[i];
     }
     return daAlphadT;
 }
 
 double PengRobinson::d2aAlpha_dT2() const
 {
-    for (size_t i = 0; i < m_kk; i++) {
-        double Tcrit_i = speciesCritTemperature(m_a_coeffs(i, i), m_b_coeffs[i]);
-        double sqt_Tr = sqrt(temperature() / Tcrit_i);
-        double coeff1 = 1 / (Tcrit_i*sqt_Tr);
-        double coeff2 = sqt_Tr - 1;
-        // Calculate first and second derivatives of alpha for individual species
-        double k = m_kappa[i];
-        m_dalphadT[i] = coeff1 * (k*k*coeff2 - k);
-        m_d2alphadT2[i] = (k*k + k) * coeff1 / (2*sqt_Tr*sqt_Tr*Tcrit_i);
-    }
-
-    // Calculate mixture derivative
     double d2aAlphadT2 = 0.0;
     for (size_t i = 0; i < m_kk; i++) {
-        double alphai = m_alpha[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            double alphaj = m_alpha[j];
-            double alphaij = alphai * alphaj;
-            double term1 = m_d2alphadT2[i] / alphai + m_d2alphadT2[j] / alphaj;
-            double term2 = 2 * m_dalphadT[i] * m_dalphadT[j] / alphaij;
-            double term3 = m_dalphadT[i] / alphai + m_dalphadT[j] / alphaj;
-            d2aAlphadT2 += 0.5 * moleFractions_[i] * moleFractions_[j]
-                           * m_aAlpha_binary(i, j)
-                           * (term1 + term2 - 0.5 * term3 * term3);
-        }
+        double g = m_dalphadT[i] / m_alpha[i];
+        double h = m_d2alphadT2[i] / m_alpha[i];
+        d2aAlphadT2 += moleFractions_[i] * ((h - 0.5 * g * g) * m_aAlphaSum[i]
+                                            + 0.5 * g * m_aAlphaDerivSum[i]);
     }
     return d2aAlphadT2;
 }
@@ -30,6 +30,11 @@ Phase::Phase() :
     m_dens(0.001),
     m_mmw(0.0),
     m_stateNum(-1),
+    m_nativeOk(false),
+    m_nativeT(npos),
+    m_nativeDP(npos),
+    m_nativeComp(npos),
+    m_nativeMoleFractions(false),
     m_mm(0),
     m_elem_type(0)
 {
@@ -290,21 +295,45 @@ void Phase::saveState(vector_fp& state) const
     saveState(state.size(), &state[0]);
 }
 
-void Phase::saveState(size_t lenstate, doublereal* state) const
+void Phase::updateNativeStateOffsets() const
 {
     auto native = nativeState();
 
     // function assumes default definition of nativeState
-    state[native.at("T")] = temperature();
+    m_nativeT = native.at("T");
     if (isCompressible()) {
-        state[native.at("D")] = density();
+        m_nativeDP = native.at("D");
     } else {
-        state[native.at("P")] = pressure();
+        m_nativeDP = native.at("P");
     }
+    m_nativeComp = npos;
+    m_nativeMoleFractions = false;
     if (native.count("X")) {
-        getMoleFractions(state + native["X"]);
+        m_nativeComp = native["X"];
+        m_nativeMoleFractions = true;
     } else if (native.count("Y")) {
-        getMassFractions(state + native["Y"]);
+        m_nativeComp = native["Y"];
+    }
+    m_nativeOk = true;
+}
+
+void Phase::saveState(size_t lenstate, doublereal* state) const
+{
+    if (!m_nativeOk) {
+        updateNativeStateOffsets();
+    }
+    state[m_nativeT] = temperature();
+    if (isCompressible()) {
+        state[m_nativeDP] = density();
+    } else {
+        state[m_nativeDP] = pressure();
+    }
+    if (m_nativeComp == npos) {
+        return;
+    } else if (m_nativeMoleFractions) {
+        getMoleFractions(state + m_nativeComp);
+    } else {
+        getMassFractions(state + m_nativeComp);
     }
 }
 
@@ -321,18 +350,43 @@ void Phase::restoreState(size_t lenstate, const double* state)
                              lenstate, ls);
     }
 
-    auto native = nativeState();
-    setTemperature(state[native.at("T")]);
+    if (!m_nativeOk) {
+        updateNativeStateOffsets();
+    }
+    setTemperature(state[m_nativeT]);
     if (isCompressible()) {
-        setDensity(state[native.at("D")]);
+        setDensity(state[m_nativeDP]);
     } else {
-        setPressure(state[native.at("P")]);
+        setPressure(state[m_nativeDP]);
+    }
+    if (m_nativeComp == npos) {
+        // composition is not part of the state (pure substances)
+        return;
     }
 
-    if (native.count("X")) {
-        setMoleFractions_NoNorm(state + native["X"]);
-    } else if (native.count("Y")) {
-        setMassFractions_NoNorm(state + native["Y"]);
+    // Skip updating the composition if it is unchanged, which is the usual
+    // case when restoring a state saved by the same object
+    const double* comp = state + m_nativeComp;
+    if (m_stateNum != -1) {
+        bool unchanged = true;
+        if (m_nativeMoleFractions) {
+            for (size_t k = 0; k < m_kk; k++) {
+                if (comp[k] != m_ym[k] * m_mmw) {
+                    unchanged = false;
+                    break;
+                }
+            }
+        } else {
+            unchanged = std::equal(comp, comp + m_kk, m_y.begin());
+        }
+        if (unchanged) {
+            return;
+        }
+    }
+    if (m_nativeMoleFractions) {
+        setMoleFractions_NoNorm(comp);
+    } else {
+        setMassFractions_NoNorm(comp);
     }
     compositionChanged();
 }
@@ -893,6 +947,7 @@ bool Phase::addSpecies(shared_ptr<Species> spec) {
         m_y.push_back(0.0);
         m_ym.push_back(0.0);
     }
+    m_nativeOk = false;
     invalidateCache();
     return true;
 }
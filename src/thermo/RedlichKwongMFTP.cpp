@@ -27,6 +27,9 @@ RedlichKwongMFTP::RedlichKwongMFTP(const std::string& infile, const std::string&
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_mix(0.0),
+    m_a1_mix(0.0),
+    m_mixStateNum(-2),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -39,6 +42,9 @@ RedlichKwongMFTP::RedlichKwongMFTP(XML_Node& phaseRefRoot, const std::string& id
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_mix(0.0),
+    m_a1_mix(0.0),
+    m_mixStateNum(-2),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -85,8 +91,8 @@ void RedlichKwongMFTP::setSpeciesCoeffs(const std::string& species,
             a_coeff_vec(1, k + m_kk * j) = a1kj;
         }
     }
-    a_coeff_vec.getRow(0, a_vec_Curr_.data());
     b_vec_Curr_[k] = b;
+    m_mixStateNum = -2;
 }
 
 void RedlichKwongMFTP::setBinaryCoeffs(const std::string& species_i,
@@ -113,7 +119,7 @@ void RedlichKwongMFTP::setBinaryCoeffs(const std::string& species_i,
     size_t counter2 = kj + m_kk * ki;
     a_coeff_vec(0, counter1) = a_coeff_vec(0, counter2) = a0;
     a_coeff_vec(1, counter1) = a_coeff_vec(1, counter2) = a1;
-    a_vec_Curr_[counter1] = a_vec_Curr_[counter2] = a0;
+    m_mixStateNum = -2;
 }
 
 // ------------Molar Thermodynamic Properties -------------------------
@@ -172,20 +178,13 @@ void RedlichKwongMFTP::getActivityCoefficients(doublereal* ac) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     doublereal pres = pressure();
 
     for (size_t k = 0; k < m_kk; k++) {
         ac[k] = (- RT() * log(pres * mv / RT())
                  + RT() * log(mv / vmb)
                  + RT() * b_vec_Curr_[k] / vmb
-                 - 2.0 * m_pp[k] / (m_b_current * sqt) * log(vpb/mv)
+                 - 2.0 * m_aSum[k] / (m_b_current * sqt) * log(vpb/mv)
                  + m_a_current * b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv)
                  - m_a_current / (m_b_current * sqt) * (b_vec_Curr_[k]/vpb)
                 );
@@ -218,13 +217,6 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     doublereal pres = pressure();
     doublereal refP = refPressure();
 
@@ -232,7 +224,7 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
         mu[k] += (RT() * log(pres/refP) - RT() * log(pres * mv / RT())
                   + RT() * log(mv / vmb)
                   + RT() * b_vec_Curr_[k] / vmb
-                  - 2.0 * m_pp[k] / (m_b_current * sqt) * log(vpb/mv)
+                  - 2.0 * m_aSum[k] / (m_b_current * sqt) * log(vpb/mv)
                   + m_a_current * b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv)
                   - m_a_current / (m_b_current * sqt) * (b_vec_Curr_[k]/vpb)
                  );
@@ -252,25 +244,14 @@ void RedlichKwongMFTP::getPartialMolarEnthalpies(doublereal* hbar) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
     for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-    for (size_t k = 0; k < m_kk; k++) {
-        dpdni_[k] = RT()/vmb + RT() * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_pp[k] / (sqt * mv * vpb)
+        dpdni_[k] = RT()/vmb + RT() * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_aSum[k] / (sqt * mv * vpb)
                     + m_a_current * b_vec_Curr_[k]/(sqt * mv * vpb * vpb);
     }
     doublereal dadt = da_dt();
     doublereal fac = TKelvin * dadt - 3.0 * m_a_current / 2.0;
 
     for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += 2.0 * moleFractions_[i] * TKelvin * a_coeff_vec(1,counter) - 3.0 * moleFractions_[i] * a_vec_Curr_[counter];
-        }
+        m_tmpV[k] = 2.0 * TKelvin * m_a1Sum[k] - 3.0 * m_aSum[k];
     }
 
     pressureDerivatives();
@@ -297,21 +278,6 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
         doublereal xx = std::max(SmallNumber, moleFraction(k));
         sbar[k] += GasConstant * (- log(xx));
     }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
-
     doublereal dadt = da_dt();
     doublereal fac = dadt - m_a_current / (2.0 * TKelvin);
     doublereal vmb = mv - m_b_current;
@@ -321,8 +287,8 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
                    + GasConstant
                    + GasConstant * log(mv/vmb)
                    + GasConstant * b_vec_Curr_[k]/vmb
-                   + m_pp[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
-                   - 2.0 * m_tmpV[k]/(m_b_current * sqt) * log(vpb/mv)
+                   + m_aSum[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
+                   - 2.0 * m_a1Sum[k]/(m_b_current * sqt) * log(vpb/mv)
                    + b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv) * fac
                    - 1.0 / (m_b_current * sqt) * b_vec_Curr_[k] / vpb * fac
                   );
@@ -349,21 +315,6 @@ void RedlichKwongMFTP::getPartialMolarCp(doublereal* cpbar) const
 
 void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
-
     doublereal sqt = sqrt(temperature());
     doublereal mv = molarVolume();
     doublereal vmb = mv - m_b_current;
@@ -371,7 +322,7 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
     for (size_t k = 0; k < m_kk; k++) {
         doublereal num = (RT() + RT() * m_b_current/ vmb + RT() * b_vec_Curr_[k] / vmb
                           + RT() * m_b_current * b_vec_Curr_[k] /(vmb * vmb)
-                          - 2.0 * m_pp[k] / (sqt * vpb)
+                          - 2.0 * m_aSum[k] / (sqt * vpb)
                           + m_a_current * b_vec_Curr_[k] / (sqt * vpb * vpb)
                          );
         doublereal denom = (pressure() + RT() * m_b_current/(vmb * vmb) - m_a_current / (sqt * vpb * vpb)
@@ -384,14 +335,15 @@ bool RedlichKwongMFTP::addSpecies(shared_ptr<Species> spec)
 {
     bool added = MixtureFugacityTP::addSpecies(spec);
     if (added) {
-        a_vec_Curr_.resize(m_kk * m_kk, 0.0);
-
         // Initialize a_vec and b_vec to NaN, to screen for species with
         //     pureFluidParameters which are undefined in the input file:
         b_vec_Curr_.push_back(NAN);
         a_coeff_vec.resize(2, m_kk * m_kk, NAN);
 
-        m_pp.push_back(0.0);
+        m_a0Sum.push_back(0.0);
+        m_a1Sum.push_back(0.0);
+        m_aSum.push_back(0.0);
+        m_mixStateNum = -2;
         m_coeffSource.push_back(CoeffSource::EoS);
         m_partialMolarVolumes.push_back(0.0);
         dpdni_.push_back(0.0);
@@ -911,24 +863,41 @@ void RedlichKwongMFTP::pressureDerivatives() const
 
 void RedlichKwongMFTP::updateMixingExpressions()
 {
-    double temp = temperature();
-    if (m_formTempParam == 1) {
+    if (stateMFNumber() != m_mixStateNum) {
+        // Accumulate the species sums column by column, so that the
+        // coefficients are accessed in storage order
+        std::fill(m_a0Sum.begin(), m_a0Sum.end(), 0.0);
+        std::fill(m_a1Sum.begin(), m_a1Sum.end(), 0.0);
+        m_b_current = 0.0;
         for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
+            double xi = moleFractions_[i];
+            for (size_t k = 0; k < m_kk; k++) {
+                size_t counter = k + m_kk * i;
+                m_a0Sum[k] += xi * a_coeff_vec(0, counter);
+                m_a1Sum[k] += xi * a_coeff_vec(1, counter);
             }
+            m_b_current += xi * b_vec_Curr_[i];
         }
+        m_a0_mix = 0.0;
+        m_a1_mix = 0.0;
+        for (size_t k = 0; k < m_kk; k++) {
+            m_a0_mix += moleFractions_[k] * m_a0Sum[k];
+            m_a1_mix += moleFractions_[k] * m_a1Sum[k];
+        }
+        m_mixStateNum = stateMFNumber();
     }
 
-    m_b_current = 0.0;
-    m_a_current = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            m_a_current += a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
+    if (m_formTempParam == 1) {
+        double temp = temperature();
+        for (size_t k = 0; k < m_kk; k++) {
+            m_aSum[k] = m_a0Sum[k] + m_a1Sum[k] * temp;
         }
+        m_a_current = m_a0_mix + m_a1_mix * temp;
+    } else {
+        m_aSum = m_a0Sum;
+        m_a_current = m_a0_mix;
     }
+
     if (isnan(m_b_current)) {
         // One or more species do not have specified coefficients.
         fmt::memory_buffer b;
@@ -948,26 +917,10 @@ void RedlichKwongMFTP::updateMixingExpressions()
 
 void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
 {
-    bCalc = 0.0;
-    aCalc = 0.0;
+    bCalc = m_b_current;
+    aCalc = m_a0_mix;
     if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
-                aCalc += a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    } else {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter);
-                aCalc += a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        aCalc += m_a1_mix * temp;
     }
 }
 
@@ -975,27 +928,15 @@ doublereal RedlichKwongMFTP::da_dt() const
 {
     doublereal dadT = 0.0;
     if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+= a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        dadT = m_a1_mix;
     }
     return dadT;
 }
 
 void RedlichKwongMFTP::calcCriticalConditions(doublereal& pc, doublereal& tc, doublereal& vc) const
 {
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
+    double a0 = m_a0_mix;
+    double aT = m_a1_mix;
     double a = m_a_current;
     double b = m_b_current;
     if (m_formTempParam != 0) {
@@ -40,6 +40,12 @@ void SpeciesThermoInterpType::updatePropertiesTemp(const double temp,
     throw NotImplementedError("SpeciesThermoInterpType::updatePropertiesTemp");
 }
 
+void SpeciesThermoInterpType::updatePropertiesTemp_ddT(double temp,
+        double* cp_R, double* h_RT, double* s_R, double* dcp_R_dT) const
+{
+    throw NotImplementedError("SpeciesThermoInterpType::updatePropertiesTemp_ddT");
+}
+
 size_t SpeciesThermoInterpType::nCoeffs() const
 {
     throw NotImplementedError("SpeciesThermoInterpType::nCoeffs");
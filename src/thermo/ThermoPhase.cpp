@@ -20,6 +20,7 @@
 #include <iomanip>
 #include <fstream>
 #include <numeric>
+#include <thread>
 
 using namespace std;
 
@@ -31,7 +32,8 @@ ThermoPhase::ThermoPhase() :
     m_phi(0.0),
     m_chargeNeutralityNecessary(false),
     m_ssConvention(cSS_CONVENTION_TEMPERATURE),
-    m_tlast(0.0)
+    m_tlast(0.0),
+    m_batchThreads(0)
 {
 }
 
@@ -99,6 +101,35 @@ void ThermoPhase::getElectrochemPotentials(doublereal* mu) const
     }
 }
 
+void ThermoPhase::getEnthalpy_RT_ddT(double* dhrt) const
+{
+    vector_fp cpr(m_kk);
+    getCp_R(cpr.data());
+    getEnthalpy_RT(dhrt);
+    double rt = 1.0 / temperature();
+    for (size_t k = 0; k < m_kk; k++) {
+        dhrt[k] = (cpr[k] - dhrt[k]) * rt;
+    }
+}
+
+void ThermoPhase::getEntropy_R_ddT(double* dsr) const
+{
+    getCp_R(dsr);
+    double rt = 1.0 / temperature();
+    for (size_t k = 0; k < m_kk; k++) {
+        dsr[k] *= rt;
+    }
+}
+
+void ThermoPhase::getGibbs_RT_ddT(double* dgrt) const
+{
+    getEnthalpy_RT(dgrt);
+    double rt = 1.0 / temperature();
+    for (size_t k = 0; k < m_kk; k++) {
+        dgrt[k] *= -rt;
+    }
+}
+
 void ThermoPhase::setState_TPX(doublereal t, doublereal p, const doublereal* x)
 {
     setMoleFractions(x);
@@ -316,6 +347,61 @@ void ThermoPhase::setState(const AnyMap& input_state)
     }
 }
 
+void ThermoPhase::getPropertiesBatch(size_t nStates, const double* T,
+                                     const double* P, const double* Y,
+                                     double* h, double* cp, double* rho,
+                                     double* mw)
+{
+    vector_fp state;
+    saveState(state);
+    vector_fp y(m_kk);
+    for (size_t m = 0; m < nStates; m++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            y[k] = Y[k * nStates + m];
+        }
+        setState_TPY(T[m], P[m], y.data());
+        if (h) {
+            h[m] = enthalpy_mass();
+        }
+        if (cp) {
+            cp[m] = cp_mass();
+        }
+        if (rho) {
+            rho[m] = density();
+        }
+        if (mw) {
+            mw[m] = meanMolecularWeight();
+        }
+    }
+    restoreState(state);
+}
+
+void ThermoPhase::solveTemperatureBatch_HP(size_t nStates, const double* h,
+                                           const double* P, const double* Y,
+                                           double* T, double tol)
+{
+    vector_fp state;
+    saveState(state);
+    vector_fp y(m_kk);
+    for (size_t m = 0; m < nStates; m++) {
+        for (size_t k = 0; k < m_kk; k++) {
+            y[k] = Y[k * nStates + m];
+        }
+        setState_TPY(T[m], P[m], y.data());
+        setState_HP(h[m], P[m], tol);
+        T[m] = temperature();
+    }
+    restoreState(state);
+}
+
+size_t ThermoPhase::batchThreads() const
+{
+    if (m_batchThreads) {
+        return m_batchThreads;
+    }
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
 void ThermoPhase::setState_conditional_TP(doublereal t, doublereal p, bool set_p)
 {
     setTemperature(t);
@@ -284,7 +284,28 @@ void GasTransport::init(ThermoPhase* thermo, int mode, int log_level)
 
     // set up Monchick and Mason collision integrals
     setupCollisionParameters();
-    setupCollisionIntegral();
+    if (m_precomputed_fits) {
+        // use the fits provided by setFits() instead of generating them
+        unique_ptr<GasTransportFits> fits = std::move(m_precomputed_fits);
+        if (fits->mode != m_mode || fits->visccoeffs.size() != m_nsp
+            || fits->condcoeffs.size() != m_nsp || fits->poly.size() != m_nsp
+            || fits->diffcoeffs.size() != m_nsp * (m_nsp + 1) / 2)
+        {
+            throw CanteraError("GasTransport::init", "Precomputed polynomial "
+                "fits are inconsistent with the phase or the transport mode.");
+        }
+        m_visccoeffs = std::move(fits->visccoeffs);
+        m_condcoeffs = std::move(fits->condcoeffs);
+        m_diffcoeffs = std::move(fits->diffcoeffs);
+        m_poly = std::move(fits->poly);
+        m_star_poly_uses_actualT = std::move(fits->star_poly_uses_actualT);
+        m_omega22_poly = std::move(fits->omega22_poly);
+        m_astar_poly = std::move(fits->astar_poly);
+        m_bstar_poly = std::move(fits->bstar_poly);
+        m_cstar_poly = std::move(fits->cstar_poly);
+    } else {
+        setupCollisionIntegral();
+    }
 
     m_molefracs.resize(m_nsp);
     m_spwork.resize(m_nsp);
@@ -307,6 +328,27 @@ void GasTransport::init(ThermoPhase* thermo, int mode, int log_level)
     }
 }
 
+GasTransportFits GasTransport::fits() const
+{
+    GasTransportFits fits;
+    fits.mode = m_mode;
+    fits.visccoeffs = m_visccoeffs;
+    fits.condcoeffs = m_condcoeffs;
+    fits.diffcoeffs = m_diffcoeffs;
+    fits.poly = m_poly;
+    fits.star_poly_uses_actualT = m_star_poly_uses_actualT;
+    fits.omega22_poly = m_omega22_poly;
+    fits.astar_poly = m_astar_poly;
+    fits.bstar_poly = m_bstar_poly;
+    fits.cstar_poly = m_cstar_poly;
+    return fits;
+}
+
+void GasTransport::setFits(const GasTransportFits& fits)
+{
+    m_precomputed_fits.reset(new GasTransportFits(fits));
+}
+
 void GasTransport::setupCollisionParameters()
 {
     m_epsilon.resize(m_nsp, m_nsp, 0.0);
@@ -0,0 +1,342 @@
+//! @file ISATCache.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ISATCache.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ConstPressureReactor.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+namespace Cantera
+{
+
+struct ISATCache::Record
+{
+    vector_fp phi0; //!< Scaled composition
+    vector_fp R0; //!< Reaction mapping of #phi0
+    Eigen::MatrixXd A; //!< Mapping gradient
+    //! Factor defining the EOA as the set of compositions where
+    //! \f$ |G (\phi - \phi_0)| \le 1 \f$
+    Eigen::MatrixXd G;
+};
+
+struct ISATCache::Node
+{
+    Node* parent = nullptr;
+    std::unique_ptr<Node> left; //!< Subtree where `v . phi <= a`
+    std::unique_ptr<Node> right; //!< Subtree where `v . phi > a`
+    vector_fp v; //!< Normal vector of the cutting plane
+    double a = 0.0; //!< Offset of the cutting plane
+    std::unique_ptr<Record> record; //!< Record held by a leaf
+    std::list<Node*>::iterator lru; //!< Position of a leaf in the LRU list
+};
+
+ISATCache::ISATCache(shared_ptr<Solution> sol, double dt, double tol)
+    : m_sol(sol)
+    , m_dt(dt)
+    , m_tol(tol)
+    , m_Tscale(1000.0)
+    , m_maxRecords(50000)
+    , m_searchLimit(10)
+{
+    if (!sol || !sol->thermo()) {
+        throw CanteraError("ISATCache::ISATCache",
+                           "Requires a Solution object with associated ThermoPhase");
+    }
+    if (dt <= 0 || tol <= 0) {
+        throw CanteraError("ISATCache::ISATCache", "Time step and tolerance "
+            "must be positive; got dt = {}, tol = {}", dt, tol);
+    }
+    m_thermo = sol->thermo().get();
+    m_pressure = m_thermo->pressure();
+    m_nv = m_thermo->nSpecies() + 1;
+    if (m_thermo->type() == "IdealGas") {
+        m_reactor.reset(new IdealGasConstPressureReactor());
+    } else {
+        m_reactor.reset(new ConstPressureReactor());
+    }
+    m_reactor->insert(sol);
+    m_net.reset(new ReactorNet());
+    m_net->addReactor(*m_reactor);
+    m_phi.resize(m_nv);
+    m_R.resize(m_nv);
+    m_work.resize(m_nv);
+    clear();
+}
+
+ISATCache::~ISATCache()
+{
+}
+
+void ISATCache::setMaxRecords(size_t nmax)
+{
+    if (nmax == 0) {
+        throw CanteraError("ISATCache::setMaxRecords",
+                           "Maximum number of records must be positive.");
+    }
+    m_maxRecords = nmax;
+    while (nRecords() > m_maxRecords) {
+        evict();
+    }
+}
+
+void ISATCache::setTemperatureScale(double Ts)
+{
+    if (Ts <= 0) {
+        throw CanteraError("ISATCache::setTemperatureScale",
+                           "Temperature scale must be positive; got {}", Ts);
+    }
+    m_Tscale = Ts;
+    clear();
+}
+
+void ISATCache::setIntegratorTolerances(double rtol, double atol)
+{
+    m_net->setTolerances(rtol, atol);
+}
+
+void ISATCache::clear()
+{
+    m_lru.clear();
+    m_root.reset();
+    m_nQueries = 0;
+    m_nRetrieves = 0;
+    m_nGrows = 0;
+    m_nAdds = 0;
+    m_nEvictions = 0;
+    m_nIntegrations = 0;
+}
+
+AnyMap ISATCache::stats() const
+{
+    AnyMap stats;
+    stats["queries"] = static_cast<long int>(m_nQueries);
+    stats["retrieves"] = static_cast<long int>(m_nRetrieves);
+    stats["grows"] = static_cast<long int>(m_nGrows);
+    stats["adds"] = static_cast<long int>(m_nAdds);
+    stats["evictions"] = static_cast<long int>(m_nEvictions);
+    stats["integrations"] = static_cast<long int>(m_nIntegrations);
+    stats["records"] = static_cast<long int>(nRecords());
+    return stats;
+}
+
+void ISATCache::advance()
+{
+    if (std::abs(m_thermo->pressure() - m_pressure) > 1e-8 * m_pressure) {
+        throw CanteraError("ISATCache::advance", "Pressure of the phase ({}) "
+            "differs from the pressure of the table ({})",
+            m_thermo->pressure(), m_pressure);
+    }
+    m_nQueries++;
+    getComposition(m_phi);
+    if (m_root) {
+        // primary retrieve
+        Node* leaf = findLeaf(m_phi);
+        Node* hit = inEOA(*leaf->record, m_phi) ? leaf : nullptr;
+
+        // secondary retrieve from the most recently used records
+        size_t n = 0;
+        for (auto iter = m_lru.begin(); !hit && iter != m_lru.end()
+                 && n < m_searchLimit; ++iter, ++n) {
+            if (*iter != leaf && inEOA(*(*iter)->record, m_phi)) {
+                hit = *iter;
+            }
+        }
+        if (hit) {
+            linearMapping(*hit->record, m_phi, m_work);
+            touch(hit);
+            m_nRetrieves++;
+            setComposition(m_work);
+            return;
+        }
+
+        integrate(m_phi, m_R);
+        Record& rec = *leaf->record;
+        linearMapping(rec, m_phi, m_work);
+        double err = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            err += std::pow(m_R[i] - m_work[i], 2);
+        }
+        if (sqrt(err) <= m_tol) {
+            // grow the EOA to the minimum volume ellipsoid containing the
+            // original EOA and the query composition
+            Eigen::VectorXd dphi(m_nv);
+            for (size_t i = 0; i < m_nv; i++) {
+                dphi[i] = m_phi[i] - rec.phi0[i];
+            }
+            Eigen::VectorXd p = rec.G * dphi;
+            double pnorm = p.norm();
+            if (pnorm > 1.0) {
+                Eigen::VectorXd u = p / pnorm;
+                Eigen::RowVectorXd uG = u.transpose() * rec.G;
+                rec.G += (1.0 / pnorm - 1.0) * u * uG;
+            }
+            touch(leaf);
+            m_nGrows++;
+            setComposition(m_R);
+            return;
+        }
+    } else {
+        integrate(m_phi, m_R);
+    }
+
+    if (nRecords() >= m_maxRecords) {
+        evict();
+    }
+    addRecord(m_phi, m_R);
+    m_nAdds++;
+    setComposition(m_R);
+}
+
+void ISATCache::getComposition(vector_fp& phi) const
+{
+    phi[0] = m_thermo->temperature() / m_Tscale;
+    m_thermo->getMassFractions(&phi[1]);
+}
+
+void ISATCache::setComposition(const vector_fp& phi)
+{
+    m_thermo->setMassFractions(&phi[1]);
+    m_thermo->setState_TP(phi[0] * m_Tscale, m_pressure);
+}
+
+void ISATCache::integrate(const vector_fp& phi, vector_fp& out)
+{
+    m_thermo->setMassFractions_NoNorm(&phi[1]);
+    m_thermo->setState_TP(phi[0] * m_Tscale, m_pressure);
+    m_reactor->syncState();
+    m_net->setInitialTime(0.0);
+    m_net->advance(m_dt);
+    getComposition(out);
+    m_nIntegrations++;
+}
+
+ISATCache::Node* ISATCache::findLeaf(const vector_fp& phi) const
+{
+    Node* node = m_root.get();
+    while (!node->record) {
+        double s = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            s += node->v[i] * phi[i];
+        }
+        node = (s > node->a) ? node->right.get() : node->left.get();
+    }
+    return node;
+}
+
+bool ISATCache::inEOA(const Record& rec, const vector_fp& phi) const
+{
+    Eigen::VectorXd dphi(m_nv);
+    for (size_t i = 0; i < m_nv; i++) {
+        dphi[i] = phi[i] - rec.phi0[i];
+    }
+    return (rec.G * dphi).squaredNorm() <= 1.0;
+}
+
+void ISATCache::linearMapping(const Record& rec, const vector_fp& phi,
+                              vector_fp& out) const
+{
+    Eigen::VectorXd dphi(m_nv);
+    for (size_t i = 0; i < m_nv; i++) {
+        dphi[i] = phi[i] - rec.phi0[i];
+    }
+    Eigen::VectorXd dR = rec.A * dphi;
+    for (size_t i = 0; i < m_nv; i++) {
+        out[i] = rec.R0[i] + dR[i];
+    }
+}
+
+void ISATCache::touch(Node* leaf)
+{
+    m_lru.splice(m_lru.begin(), m_lru, leaf->lru);
+}
+
+void ISATCache::addRecord(const vector_fp& phi, const vector_fp& R)
+{
+    std::unique_ptr<Record> rec(new Record());
+    rec->phi0 = phi;
+    rec->R0 = R;
+
+    // mapping gradient by forward differences. The perturbations are scaled
+    // with the integrator tolerances, so that the error of the perturbed
+    // integrations remains small compared to the change of the results.
+    rec->A.resize(m_nv, m_nv);
+    vector_fp phiP = phi;
+    vector_fp RP(m_nv);
+    double rtol = m_net->rtol();
+    double atol = m_net->atol();
+    for (size_t j = 0; j < m_nv; j++) {
+        double delta = std::sqrt(rtol) * std::max(std::abs(phi[j]), atol / rtol);
+        phiP[j] = phi[j] + delta;
+        integrate(phiP, RP);
+        for (size_t i = 0; i < m_nv; i++) {
+            rec->A(i, j) = (RP[i] - R[i]) / delta;
+        }
+        phiP[j] = phi[j];
+    }
+
+    // The initial EOA is the region where the error of the linear
+    // approximation is estimated to be within the tolerance. Singular values
+    // of the mapping gradient are limited to be at least 1/2, which bounds
+    // the size of the EOA in directions where the mapping is contracting.
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(rec->A, Eigen::ComputeFullV);
+    Eigen::VectorXd sigma = svd.singularValues().cwiseMax(0.5) / m_tol;
+    rec->G = sigma.asDiagonal() * svd.matrixV().transpose();
+
+    std::unique_ptr<Node> leaf(new Node());
+    leaf->record = std::move(rec);
+    m_lru.push_front(leaf.get());
+    leaf->lru = m_lru.begin();
+    if (!m_root) {
+        m_root = std::move(leaf);
+        return;
+    }
+
+    // replace the leaf found for the new composition by an internal node
+    // with a cutting plane halfway between the two records
+    Node* old = findLeaf(phi);
+    Node* parent = old->parent;
+    std::unique_ptr<Node>& slot = !parent ? m_root :
+        (parent->left.get() == old) ? parent->left : parent->right;
+    std::unique_ptr<Node> node(new Node());
+    node->parent = parent;
+    const vector_fp& phi0 = old->record->phi0;
+    node->v.resize(m_nv);
+    for (size_t i = 0; i < m_nv; i++) {
+        node->v[i] = phi[i] - phi0[i];
+        node->a += 0.5 * node->v[i] * (phi[i] + phi0[i]);
+    }
+    leaf->parent = node.get();
+    node->left = std::move(slot);
+    node->left->parent = node.get();
+    node->right = std::move(leaf);
+    slot = std::move(node);
+}
+
+void ISATCache::evict()
+{
+    if (m_lru.empty()) {
+        return;
+    }
+    Node* leaf = m_lru.back();
+    m_lru.pop_back();
+    m_nEvictions++;
+    Node* parent = leaf->parent;
+    if (!parent) {
+        m_root.reset();
+        return;
+    }
+    // replace the parent by the sibling of the evicted leaf
+    std::unique_ptr<Node> sibling = std::move(
+        (parent->left.get() == leaf) ? parent->right : parent->left);
+    Node* grandparent = parent->parent;
+    sibling->parent = grandparent;
+    std::unique_ptr<Node>& slot = !grandparent ? m_root :
+        (grandparent->left.get() == parent) ? grandparent->left : grandparent->right;
+    slot = std::move(sibling);
+}
+
+}
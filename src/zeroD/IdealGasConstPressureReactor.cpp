@@ -40,17 +40,53 @@ void IdealGasConstPressureReactor::getState(double* y)
     y[1] = m_thermo->temperature();
 
     // set components y+2 ... y+K+1 to the mass fractions Y_k of each species
-    m_thermo->getMassFractions(y+2);
+    if (m_stateSpecies.empty()) {
+        m_thermo->getMassFractions(y+2);
+    } else {
+        m_thermo->getMassFractions(m_Yfull.data());
+        for (size_t j = 0; j < m_stateSpecies.size(); j++) {
+            y[j+2] = m_Yfull[m_stateSpecies[j]];
+        }
+    }
 
     // set the remaining components to the surface species
     // coverages on the walls
-    getSurfaceInitialConditions(y + m_nsp + 2);
+    getSurfaceInitialConditions(y + nStateSpecies() + 2);
 }
 
 void IdealGasConstPressureReactor::initialize(doublereal t0)
 {
     ConstPressureReactor::initialize(t0);
     m_hk.resize(m_nsp, 0.0);
+
+    // remove quasi-steady species from the state vector
+    m_stateSpecies.clear();
+    m_speciesOffset.clear();
+    if (m_chem && !m_kin->quasiSteadySpecies().empty()) {
+        m_speciesOffset.assign(m_nsp, 0);
+        for (size_t k : m_kin->quasiSteadySpecies()) {
+            m_speciesOffset[k] = npos;
+        }
+        for (size_t k = 0; k < m_nsp; k++) {
+            if (m_speciesOffset[k] != npos) {
+                m_speciesOffset[k] = m_stateSpecies.size();
+                m_stateSpecies.push_back(k);
+            }
+        }
+        m_nv -= m_nsp - m_stateSpecies.size();
+        m_Yfull.resize(m_nsp);
+        m_mdYdt.resize(m_nsp);
+        // initial state of the phase excludes quasi-steady species
+        m_thermo->restoreState(m_state);
+        m_thermo->getMassFractions(m_Yfull.data());
+        for (size_t k = 0; k < m_nsp; k++) {
+            if (m_speciesOffset[k] == npos) {
+                m_Yfull[k] = 0.0;
+            }
+        }
+        m_thermo->setMassFractions_NoNorm(m_Yfull.data());
+        m_thermo->saveState(m_state);
+    }
 }
 
 void IdealGasConstPressureReactor::updateState(doublereal* y)
@@ -59,18 +95,28 @@ void IdealGasConstPressureReactor::updateState(doublereal* y)
     // [2...K+2) are the mass fractions of each species, and [K+2...] are the
     // coverages of surface species on each wall.
     m_mass = y[0];
-    m_thermo->setMassFractions_NoNorm(y+2);
+    if (m_stateSpecies.empty()) {
+        m_thermo->setMassFractions_NoNorm(y+2);
+    } else {
+        // mass fractions of quasi-steady species remain zero
+        for (size_t j = 0; j < m_stateSpecies.size(); j++) {
+            m_Yfull[m_stateSpecies[j]] = y[j+2];
+        }
+        m_thermo->setMassFractions_NoNorm(m_Yfull.data());
+    }
     m_thermo->setState_TP(y[1], m_pressure);
     m_vol = m_mass / m_thermo->density();
     updateConnected(false);
-    updateSurfaceState(y + m_nsp + 2);
+    updateSurfaceState(y + nStateSpecies() + 2);
 }
 
 void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
 {
     double& dmdt = RHS[0]; // dm/dt (gas phase)
     double& mcpdTdt = RHS[1]; // m * c_p * dT/dt
-    double* mdYdt = RHS + 2; // mass * dY/dt
+    // mass * dY/dt; for all species if there are quasi-steady species
+    double* mdYdt = m_stateSpecies.empty() ? RHS + 2 : m_mdYdt.data();
+    size_t nspState = nStateSpecies();
 
     dmdt = 0.0;
     mcpdTdt = 0.0;
@@ -81,7 +127,7 @@ void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
     const vector_fp& mw = m_thermo->molecularWeights();
     const double* Y = m_thermo->massFractions();
 
-    evalSurfaces(LHS + m_nsp + 2, RHS + m_nsp + 2, m_sdot.data());
+    evalSurfaces(LHS + nspState + 2, RHS + nspState + 2, m_sdot.data());
     double mdot_surf = dot(m_sdot.begin(), m_sdot.end(), mw.begin());
     dmdt += mdot_surf;
 
@@ -102,8 +148,10 @@ void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
         mdYdt[n] = (m_wdot[n] * m_vol + m_sdot[n]) * mw[n];
         // dilution by net surface mass flux
         mdYdt[n] -= Y[n] * mdot_surf;
+    }
+    for (size_t j = 0; j < nspState; j++) {
         //Assign left-hand side of dYdt ODE as total mass
-        LHS[n+2] = m_mass;
+        LHS[j+2] = m_mass;
     }
 
     // add terms for outlets
@@ -124,6 +172,10 @@ void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
         }
     }
 
+    for (size_t j = 0; j < m_stateSpecies.size(); j++) {
+        RHS[j+2] = mdYdt[m_stateSpecies[j]];
+    }
+
     if (m_energy) {
         LHS[1] = m_mass * m_thermo->cp_mass();
     } else {
@@ -131,11 +183,129 @@ void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+Eigen::SparseMatrix<double> IdealGasConstPressureReactor::jacobian()
+{
+    if (m_nv_surf != 0) {
+        throw NotImplementedError("IdealGasConstPressureReactor::jacobian",
+                                  "Reactors with surfaces are not supported.");
+    }
+    m_thermo->restoreState(m_state);
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double T = m_thermo->temperature();
+    double rho = m_thermo->density();
+    double ctot = m_thermo->molarDensity();
+    double cp = m_thermo->cp_mass();
+    m_thermo->getPartialMolarEnthalpies(m_hk.data());
+
+    // Indices of temperature and the first species in the state vector
+    const size_t iT = 1;
+    const size_t iY = 2;
+
+    // Offset of species k from the first species in the state vector, or
+    // `npos` if the species is quasi-steady
+    auto offset = [this](size_t k) {
+        return m_speciesOffset.empty() ? k : m_speciesOffset[k];
+    };
+
+    SparseTriplets trips;
+    vector_fp dwdot_dT(m_nsp, 0.0);
+    vector_fp dwdot_dC(m_nsp, 0.0);
+    vector_fp dhdot_dY(m_nsp, 0.0); // sum_k h_k/W_k * d(dY_k/dt)/dY_j
+    if (m_chem) {
+        m_kin->getNetProductionRates(m_wdot.data());
+        m_kin->getNetProductionRates_ddT(dwdot_dT.data());
+        m_kin->getNetProductionRates_ddC(dwdot_dC.data());
+        Eigen::SparseMatrix<double> dwdot_dX = m_kin->netProductionRates_ddX();
+        // Mass fraction derivatives at constant molar density:
+        // d(dY_k/dt)/dY_j = W_k/W_j * (d wdot_k / d X_j) / ctot
+        for (int j = 0; j < dwdot_dX.outerSize(); j++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot_dX, j); it; ++it) {
+                size_t k = it.row();
+                double value = mw[k] / mw[j] * it.value() / ctot;
+                if (offset(k) != npos && offset(j) != npos) {
+                    trips.emplace_back(static_cast<int>(iY + offset(k)),
+                                       static_cast<int>(iY + offset(j)), value);
+                }
+                dhdot_dY[j] += m_hk[k] / mw[k] * value;
+            }
+        }
+        for (size_t k = 0; k < m_nsp; k++) {
+            // temperature derivative at constant pressure, where the molar
+            // density changes as ctot = P / (R T)
+            dwdot_dT[k] -= ctot / T * dwdot_dC[k];
+            if (offset(k) != npos) {
+                trips.emplace_back(static_cast<int>(iY + offset(k)),
+                                   static_cast<int>(iT),
+                                   mw[k] / rho * (dwdot_dT[k] + m_wdot[k] / T));
+            }
+        }
+    }
+
+    // dilution by inlet flows
+    double mdot_in = 0.0;
+    for (auto inlet : m_inlet) {
+        mdot_in += inlet->massFlowRate();
+    }
+    if (mdot_in != 0.0) {
+        for (size_t j = 0; j < nStateSpecies(); j++) {
+            trips.emplace_back(static_cast<int>(iY + j),
+                               static_cast<int>(iY + j), -mdot_in / m_mass);
+        }
+    }
+
+    if (m_energy && m_chem) {
+        vector_fp cpk(m_nsp);
+        vector_fp dcpk_dT(m_nsp);
+        m_thermo->getPartialMolarCp(cpk.data());
+        m_thermo->getCp_R_ddT(dcpk_dT.data());
+        const double* Y = m_thermo->massFractions();
+        double hdot = 0.0; // volumetric heat release rate
+        double dhdot_dT = 0.0;
+        double dcp_dT = 0.0; // temperature derivative of cp_mass
+        double dhdot_dC = 0.0; // derivative at constant mole fractions
+        for (size_t k = 0; k < m_nsp; k++) {
+            hdot += m_hk[k] * m_wdot[k];
+            dhdot_dT += cpk[k] * m_wdot[k] + m_hk[k] * dwdot_dT[k];
+            dcp_dT += GasConstant * Y[k] / mw[k] * dcpk_dT[k];
+            dhdot_dC += m_hk[k] * dwdot_dC[k];
+        }
+        double dTdt = - hdot / (rho * cp);
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (offset(j) == npos) {
+                continue;
+            }
+            // includes derivatives of cp_mass and 1/rho with respect to Y_j,
+            // and the change of all concentrations by -C_k * W_mix / W_j due
+            // to the change of the density
+            double value = - dhdot_dY[j] / cp
+                + dTdt * (rho / (ctot * mw[j]) - cpk[j] / (mw[j] * cp))
+                + dhdot_dC / (cp * mw[j]);
+            trips.emplace_back(static_cast<int>(iT),
+                               static_cast<int>(iY + offset(j)), value);
+        }
+        trips.emplace_back(static_cast<int>(iT), static_cast<int>(iT),
+                           - dhdot_dT / (rho * cp) + dTdt / T
+                           - dTdt * dcp_dT / cp);
+    }
+
+    Eigen::SparseMatrix<double> jac(m_nv, m_nv);
+    jac.setFromTriplets(trips.begin(), trips.end());
+    return jac;
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
     if (k != npos) {
-        return k + 2;
+        if (m_speciesOffset.empty()) {
+            return k + 2;
+        } else if (k < m_nsp) {
+            // quasi-steady species are not part of the state vector
+            return (m_speciesOffset[k] == npos) ? npos : m_speciesOffset[k] + 2;
+        } else {
+            // surface species follow the gas phase species in the state vector
+            return k + 2 - (m_nsp - nStateSpecies());
+        }
     } else if (nm == "mass") {
         return 0;
     } else if (nm == "temperature") {
@@ -148,8 +318,13 @@ size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 std::string IdealGasConstPressureReactor::componentName(size_t k) {
     if (k == 1) {
         return "temperature";
-    } else {
+    } else if (m_stateSpecies.empty() || k < 2) {
         return ConstPressureReactor::componentName(k);
+    } else if (k < nStateSpecies() + 2) {
+        return m_thermo->speciesName(m_stateSpecies[k - 2]);
+    } else {
+        // surface species
+        return ConstPressureReactor::componentName(k + m_nsp - nStateSpecies());
     }
 }
 
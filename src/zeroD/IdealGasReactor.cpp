@@ -136,6 +136,90 @@ void IdealGasReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+Eigen::SparseMatrix<double> IdealGasReactor::jacobian()
+{
+    if (m_nv_surf != 0) {
+        throw NotImplementedError("IdealGasReactor::jacobian",
+                                  "Reactors with surfaces are not supported.");
+    }
+    m_thermo->restoreState(m_state);
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double rho = m_thermo->density();
+    double ctot = m_thermo->molarDensity();
+    double cv = m_thermo->cv_mass();
+    m_thermo->getPartialMolarIntEnergies(m_uk.data());
+
+    // Indices of temperature and the first species in the state vector
+    const size_t iT = 2;
+    const size_t iY = 3;
+
+    SparseTriplets trips;
+    vector_fp dwdot_dT(m_nsp, 0.0);
+    vector_fp dudot_dY(m_nsp, 0.0); // sum_k u_k/W_k * d(dY_k/dt)/dY_j
+    if (m_chem) {
+        m_kin->getNetProductionRates(m_wdot.data());
+        m_kin->getNetProductionRates_ddT(dwdot_dT.data());
+        Eigen::SparseMatrix<double> dwdot_dX = m_kin->netProductionRates_ddX();
+        // Mass fraction derivatives at constant density:
+        // d(dY_k/dt)/dY_j = W_k/W_j * (d wdot_k / d X_j) / ctot
+        for (int j = 0; j < dwdot_dX.outerSize(); j++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot_dX, j); it; ++it) {
+                size_t k = it.row();
+                double value = mw[k] / mw[j] * it.value() / ctot;
+                trips.emplace_back(static_cast<int>(iY + k),
+                                   static_cast<int>(iY + j), value);
+                dudot_dY[j] += m_uk[k] / mw[k] * value;
+            }
+        }
+        for (size_t k = 0; k < m_nsp; k++) {
+            trips.emplace_back(static_cast<int>(iY + k), static_cast<int>(iT),
+                               mw[k] / rho * dwdot_dT[k]);
+        }
+    }
+
+    // dilution by inlet flows
+    double mdot_in = 0.0;
+    for (auto inlet : m_inlet) {
+        mdot_in += inlet->massFlowRate();
+    }
+    if (mdot_in != 0.0) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            trips.emplace_back(static_cast<int>(iY + k),
+                               static_cast<int>(iY + k), -mdot_in / m_mass);
+        }
+    }
+
+    if (m_energy && m_chem) {
+        vector_fp cvk(m_nsp);
+        vector_fp dcvk_dT(m_nsp);
+        m_thermo->getPartialMolarCp(cvk.data());
+        m_thermo->getCp_R_ddT(dcvk_dT.data());
+        const double* Y = m_thermo->massFractions();
+        double udot = 0.0; // volumetric heat release rate
+        double dudot_dT = 0.0;
+        double dcv_dT = 0.0; // temperature derivative of cv_mass
+        for (size_t k = 0; k < m_nsp; k++) {
+            cvk[k] -= GasConstant;
+            udot += m_uk[k] * m_wdot[k];
+            dudot_dT += cvk[k] * m_wdot[k] + m_uk[k] * dwdot_dT[k];
+            dcv_dT += GasConstant * Y[k] / mw[k] * dcvk_dT[k];
+        }
+        double dTdt = - udot / (rho * cv);
+        for (size_t j = 0; j < m_nsp; j++) {
+            // includes the derivative of cv_mass with respect to Y_j
+            double value = - dudot_dY[j] / cv - dTdt * cvk[j] / (mw[j] * cv);
+            trips.emplace_back(static_cast<int>(iT), static_cast<int>(iY + j),
+                               value);
+        }
+        trips.emplace_back(static_cast<int>(iT), static_cast<int>(iT),
+                           - dudot_dT / (rho * cv) - dTdt * dcv_dT / cv);
+    }
+
+    Eigen::SparseMatrix<double> jac(m_nv, m_nv);
+    jac.setFromTriplets(trips.begin(), trips.end());
+    return jac;
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
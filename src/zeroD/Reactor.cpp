@@ -10,6 +10,7 @@
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/ReactorSurface.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/ReactionPath.h"
 #include "cantera/base/Solution.h"
 
 #include <boost/math/tools/roots.hpp>
@@ -27,7 +28,14 @@ Reactor::Reactor() :
     m_mass(0.0),
     m_chem(false),
     m_energy(true),
-    m_nv(0)
+    m_nv(0),
+    m_drgThreshold(1e-3),
+    m_drgTolerance(0.01),
+    m_drgMaxRefinements(3),
+    m_nActiveSpecies(0),
+    m_nActiveReactions(0),
+    m_adaptiveError(0.0),
+    m_nRefinements(0)
 {}
 
 void Reactor::insert(shared_ptr<Solution> sol) {
@@ -45,6 +53,15 @@ void Reactor::setKineticsMgr(Kinetics& kin)
     }
 }
 
+void Reactor::setDerivativeSettings(const AnyMap& settings)
+{
+    if (!m_kin) {
+        throw CanteraError("Reactor::setDerivativeSettings",
+                           "Reactor has no kinetics manager.");
+    }
+    m_kin->setDerivativeSettings(settings);
+}
+
 void Reactor::getState(double* y)
 {
     if (m_thermo == 0) {
@@ -443,6 +460,108 @@ void Reactor::resetSensitivity(double* params)
     }
 }
 
+void Reactor::setAdaptiveChemistry(const AnyMap& settings)
+{
+    if (settings.empty()) {
+        m_drg.reset();
+        m_activeReactions.clear();
+        if (m_kin && !m_kin->activeReactions().empty()) {
+            m_kin->setActiveReactions({});
+        }
+        return;
+    }
+    if (!m_kin || !m_chem) {
+        throw CanteraError("Reactor::setAdaptiveChemistry",
+                           "Reactor '{}' has no reactions.", name());
+    }
+    if (!settings.hasKey("targets")) {
+        throw CanteraError("Reactor::setAdaptiveChemistry",
+                           "No target species specified.");
+    }
+    m_drg.reset(new DirectedRelationGraph(*m_kin,
+                                          settings.getString("method", "DRGEP")));
+    m_drg->setTargets(settings["targets"].asVector<std::string>());
+    m_drgThreshold = settings.getDouble("threshold", 1e-3);
+    m_drgTolerance = settings.getDouble("tolerance", 0.01);
+    m_drgMaxRefinements = settings.getInt("max-refinements", 3);
+    m_activeReactions.clear();
+    m_nActiveSpecies = m_kin->nTotalSpecies();
+    m_nActiveReactions = m_kin->nReactions();
+    m_adaptiveError = 0.0;
+    m_nRefinements = 0;
+}
+
+bool Reactor::updateActiveReactions()
+{
+    if (!m_drg) {
+        return false;
+    }
+    m_thermo->restoreState(m_state);
+
+    // analyze the full mechanism
+    if (!m_kin->activeReactions().empty()) {
+        m_kin->setActiveReactions({});
+    }
+    size_t nsp = m_kin->nTotalSpecies();
+    m_wdotFull.resize(nsp);
+    m_wdotReduced.resize(nsp);
+    m_kin->getNetProductionRates(m_wdotFull.data());
+    m_drg->update();
+    double wdotMax = 0.0;
+    for (size_t k = 0; k < nsp; k++) {
+        wdotMax = std::max(wdotMax, std::abs(m_wdotFull[k]));
+    }
+
+    // find the largest threshold where the reduced mechanism meets the
+    // tolerance; otherwise, use the full mechanism
+    double threshold = m_drgThreshold;
+    bool accepted = false;
+    m_nRefinements = 0;
+    while (true) {
+        m_drg->getActiveReactions(threshold, m_trialReactions);
+        m_kin->setActiveReactions(m_trialReactions);
+        m_kin->getNetProductionRates(m_wdotReduced.data());
+        double err = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            err = std::max(err, std::abs(m_wdotReduced[k] - m_wdotFull[k]));
+        }
+        m_adaptiveError = (wdotMax > 0) ? err / wdotMax : 0.0;
+        if (m_adaptiveError <= m_drgTolerance) {
+            accepted = true;
+            break;
+        } else if (m_nRefinements == m_drgMaxRefinements) {
+            break;
+        }
+        threshold *= 0.1;
+        m_nRefinements++;
+    }
+
+    if (accepted) {
+        m_nActiveSpecies = m_drg->nActiveSpecies(threshold);
+        m_nActiveReactions = std::count(m_trialReactions.begin(),
+                                        m_trialReactions.end(), true);
+        if (m_nActiveReactions == m_kin->nReactions()) {
+            m_trialReactions.clear();
+        }
+    } else {
+        m_trialReactions.clear();
+        m_nActiveSpecies = nsp;
+        m_nActiveReactions = m_kin->nReactions();
+        m_adaptiveError = 0.0;
+    }
+    m_kin->setActiveReactions(m_trialReactions);
+    bool changed = (m_trialReactions != m_activeReactions);
+    std::swap(m_activeReactions, m_trialReactions);
+    return changed;
+}
+
+void Reactor::applyActiveReactions()
+{
+    if (m_drg && m_kin->activeReactions() != m_activeReactions) {
+        m_kin->setActiveReactions(m_activeReactions);
+    }
+}
+
 void Reactor::setAdvanceLimits(const double *limits)
 {
     if (m_thermo == 0) {
@@ -0,0 +1,301 @@
+//! @file ReactorEnsemble.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorFactory.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#include <thread>
+
+namespace Cantera
+{
+
+EnsembleResult::EnsembleResult()
+    : success(false)
+    , ignitionTime(NAN)
+    , peakTime(NAN)
+    , peakValue(NAN)
+    , finalTime(NAN)
+    , finalTemperature(NAN)
+    , nSteps(0)
+{
+}
+
+struct ReactorEnsemble::Worker
+{
+    shared_ptr<Solution> sol;
+    std::unique_ptr<Reactor> reactor;
+    std::unique_ptr<ReactorNet> net;
+    std::deque<size_t> queue;
+    std::mutex mutex;
+};
+
+ReactorEnsemble::ReactorEnsemble(shared_ptr<Solution> sol,
+                                 const std::string& reactorType)
+    : m_sol(sol)
+    , m_reactorType(reactorType)
+    , m_nThreads(0)
+    , m_rtol(1e-9)
+    , m_atol(1e-15)
+    , m_maxSteps(100000)
+    , m_tEnd(1.0)
+    , m_deltaT(400.0)
+    , m_peakSpecies(npos)
+    , m_peakDrop(0.05)
+{
+    if (!sol || !sol->thermo()) {
+        throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+                           "Requires a Solution object with associated ThermoPhase");
+    }
+    std::unique_ptr<ReactorBase> r(newReactor(reactorType));
+    if (!dynamic_cast<Reactor*>(r.get())) {
+        throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+            "Reactors of type '{}' cannot be integrated.", reactorType);
+    }
+}
+
+ReactorEnsemble::~ReactorEnsemble()
+{
+}
+
+void ReactorEnsemble::setThreads(size_t nThreads)
+{
+    m_nThreads = nThreads;
+}
+
+size_t ReactorEnsemble::nThreads() const
+{
+    if (m_nThreads) {
+        return m_nThreads;
+    }
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void ReactorEnsemble::setTolerances(double rtol, double atol)
+{
+    if (rtol >= 0.0) {
+        m_rtol = rtol;
+    }
+    if (atol >= 0.0) {
+        m_atol = atol;
+    }
+    for (auto& w : m_workers) {
+        w->net->setTolerances(m_rtol, m_atol);
+    }
+}
+
+void ReactorEnsemble::setTimeHorizon(double tEnd)
+{
+    if (tEnd <= 0.0) {
+        throw CanteraError("ReactorEnsemble::setTimeHorizon",
+                           "Time horizon must be positive; got {}", tEnd);
+    }
+    m_tEnd = tEnd;
+}
+
+void ReactorEnsemble::setPeakSpecies(const std::string& name, double drop)
+{
+    if (name.empty()) {
+        m_peakSpecies = npos;
+        return;
+    }
+    if (drop <= 0.0 || drop >= 1.0) {
+        throw CanteraError("ReactorEnsemble::setPeakSpecies",
+                           "Relative drop must be in (0, 1); got {}", drop);
+    }
+    m_peakSpecies = m_sol->thermo()->speciesIndex(name);
+    if (m_peakSpecies == npos) {
+        throw CanteraError("ReactorEnsemble::setPeakSpecies",
+                           "Unknown species '{}'", name);
+    }
+    m_peakDrop = drop;
+}
+
+size_t ReactorEnsemble::addCase(double T, double P, const std::string& X)
+{
+    return addCase(T, P, parseCompString(X, m_sol->thermo()->speciesNames()));
+}
+
+size_t ReactorEnsemble::addCase(double T, double P, const compositionMap& X)
+{
+    return addCase(T, P, m_sol->thermo()->getCompositionFromMap(X));
+}
+
+size_t ReactorEnsemble::addCase(double T, double P, const vector_fp& X)
+{
+    if (X.size() != m_sol->thermo()->nSpecies()) {
+        throw CanteraError("ReactorEnsemble::addCase", "Expected {} mole "
+            "fractions; got {}", m_sol->thermo()->nSpecies(), X.size());
+    }
+    m_T0.push_back(T);
+    m_P0.push_back(P);
+    m_X0.push_back(X);
+    return m_T0.size() - 1;
+}
+
+void ReactorEnsemble::clearCases()
+{
+    m_T0.clear();
+    m_P0.clear();
+    m_X0.clear();
+    m_results.clear();
+}
+
+const EnsembleResult& ReactorEnsemble::result(size_t i) const
+{
+    if (i >= m_results.size()) {
+        throw IndexError("ReactorEnsemble::result", "results", i,
+                         m_results.size() - 1);
+    }
+    return m_results[i];
+}
+
+void ReactorEnsemble::setupWorkers()
+{
+    size_t nWorkers = std::min(nThreads(), std::max<size_t>(nCases(), 1));
+    while (m_workers.size() < nWorkers) {
+        std::unique_ptr<Worker> w(new Worker());
+        w->sol = m_sol->clone();
+        w->reactor.reset(dynamic_cast<Reactor*>(newReactor(m_reactorType)));
+        w->reactor->insert(w->sol);
+        w->net.reset(new ReactorNet());
+        w->net->addReactor(*w->reactor);
+        w->net->setTolerances(m_rtol, m_atol);
+        m_workers.push_back(std::move(w));
+    }
+    m_workers.resize(nWorkers);
+    for (size_t i = 0; i < nCases(); i++) {
+        m_workers[i % nWorkers]->queue.push_back(i);
+    }
+}
+
+void ReactorEnsemble::run()
+{
+    m_results.assign(nCases(), EnsembleResult());
+    if (nCases() == 0) {
+        return;
+    }
+    setupWorkers();
+    if (m_workers.size() == 1) {
+        work(0);
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (size_t n = 0; n < m_workers.size(); n++) {
+        threads.emplace_back(&ReactorEnsemble::work, this, n);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void ReactorEnsemble::work(size_t n)
+{
+    Worker& w = *m_workers[n];
+    size_t i;
+    while ((i = nextCase(n)) != npos) {
+        try {
+            runCase(w, i);
+        } catch (std::exception& err) {
+            m_results[i].success = false;
+            m_results[i].message = err.what();
+        }
+    }
+}
+
+size_t ReactorEnsemble::nextCase(size_t n)
+{
+    {
+        Worker& w = *m_workers[n];
+        std::unique_lock<std::mutex> lock(w.mutex);
+        if (!w.queue.empty()) {
+            size_t i = w.queue.front();
+            w.queue.pop_front();
+            return i;
+        }
+    }
+    // Steal work from the end of the queue of another worker. Cases are
+    // never added while running, so no work is left once all queues are empty.
+    for (size_t j = 1; j < m_workers.size(); j++) {
+        Worker& victim = *m_workers[(n + j) % m_workers.size()];
+        std::unique_lock<std::mutex> lock(victim.mutex);
+        if (!victim.queue.empty()) {
+            size_t i = victim.queue.back();
+            victim.queue.pop_back();
+            return i;
+        }
+    }
+    return npos;
+}
+
+void ReactorEnsemble::runCase(Worker& w, size_t i)
+{
+    EnsembleResult& res = m_results[i];
+    ThermoPhase& thermo = *w.sol->thermo();
+    Reactor& reactor = *w.reactor;
+    ReactorNet& net = *w.net;
+
+    thermo.setState_TPX(m_T0[i], m_P0[i], m_X0[i].data());
+    reactor.syncState();
+    net.setInitialTime(0.0);
+
+    bool trackIgnition = (m_deltaT > 0);
+    bool trackPeak = (m_peakSpecies != npos);
+    double TIgn = m_T0[i] + m_deltaT;
+    bool ignited = false;
+    bool peaked = false;
+    double tPrev = 0.0;
+    double TPrev = m_T0[i];
+    if (trackPeak) {
+        res.peakTime = 0.0;
+        res.peakValue = reactor.massFraction(m_peakSpecies);
+    }
+
+    double t = 0.0;
+    while (t < m_tEnd) {
+        if (res.nSteps >= m_maxSteps) {
+            res.finalTime = t;
+            res.finalTemperature = reactor.temperature();
+            res.message = fmt::format("Maximum number of steps ({}) exceeded",
+                                      m_maxSteps);
+            return;
+        }
+        t = net.step();
+        res.nSteps++;
+        if (t > m_tEnd) {
+            // interpolate back to the end of the time horizon
+            net.advance(m_tEnd);
+            t = m_tEnd;
+        }
+        double T = reactor.temperature();
+        if (trackIgnition && !ignited && T >= TIgn) {
+            res.ignitionTime = tPrev + (t - tPrev) * (TIgn - TPrev) / (T - TPrev);
+            ignited = true;
+        }
+        if (trackPeak && !peaked) {
+            double Y = reactor.massFraction(m_peakSpecies);
+            if (Y > res.peakValue) {
+                res.peakValue = Y;
+                res.peakTime = t;
+            } else if (Y < (1 - m_peakDrop) * res.peakValue) {
+                peaked = true;
+            }
+        }
+        tPrev = t;
+        TPrev = T;
+        if ((trackIgnition || trackPeak) && (ignited || !trackIgnition)
+            && (peaked || !trackPeak)) {
+            break;
+        }
+    }
+    res.finalTime = t;
+    res.finalTemperature = reactor.temperature();
+    res.success = true;
+}
+
+}
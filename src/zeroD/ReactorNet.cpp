@@ -5,11 +5,15 @@
 
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/FlowDevice.h"
+#include "cantera/zeroD/flowControllers.h"
+#include "cantera/zeroD/ReactorDelegator.h"
 #include "cantera/zeroD/Wall.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/Array.h"
 #include "cantera/numerics/Integrator.h"
 
+#include <set>
+
 using namespace std;
 
 namespace Cantera
@@ -21,14 +25,21 @@ ReactorNet::ReactorNet() :
     m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4),
     m_atols(1.0e-15), m_atolsens(1.0e-6),
     m_maxstep(0.0), m_maxErrTestFails(0),
-    m_verbose(false), m_checked_eval_deprecation(false)
+    m_verbose(false), m_integratorType("CVODE"), m_linearSolverType("DENSE"),
+    m_nColors(0), m_precon_type("LU"), m_ilut_droptol(1e-10),
+    m_ilut_fillfactor(10),
+    m_tn(0.0), m_lastEvent(npos), m_nOutputs(0), m_adaptiveInterval(0), m_adaptiveSteps(0), m_adaptiveUpdates(0),
+    m_adaptiveSwitches(0), m_adaptiveRefinements(0), m_adaptiveFull(0),
+    m_adaptiveMaxError(0.0), m_adaptiveSpecies(0.0), m_adaptiveReactions(0.0),
+    m_adaptiveSamples(0),
+    m_checked_eval_deprecation(false)
 {
     suppressErrors(true);
 
     // use backward differencing, with a full Jacobian computed
-    // numerically, and use a Newton linear iterator
+    // numerically by evalDenseJacobian(), and use a Newton linear iterator
     m_integ->setMethod(BDF_Method);
-    m_integ->setProblemType(DENSE + NOJAC);
+    m_integ->setProblemType(DENSE + JAC);
 }
 
 ReactorNet::~ReactorNet()
@@ -39,6 +50,11 @@ void ReactorNet::setInitialTime(double time)
 {
     m_time = time;
     m_integrator_init = false;
+    for (auto& event : m_events) {
+        event.times.clear();
+    }
+    m_lastEvent = npos;
+    m_nOutputs = 0;
 }
 
 void ReactorNet::setMaxTimeStep(double maxstep)
@@ -75,6 +91,196 @@ void ReactorNet::setSensitivityTolerances(double rtol, double atol)
     m_init = false;
 }
 
+namespace {
+
+//! Integrator problem type corresponding to a linear solver type
+int problemType(const std::string& linSolverType)
+{
+    if (linSolverType == "DENSE") {
+        return DENSE + JAC;
+    } else if (linSolverType == "SPARSE") {
+        return SPARSE + JAC;
+    } else if (linSolverType == "GMRES") {
+        return GMRES + JAC;
+    } else {
+        throw CanteraError("ReactorNet::setLinearSolverType",
+                           "Unknown linear solver type '{}'", linSolverType);
+    }
+}
+
+}
+
+void ReactorNet::setIntegratorType(const std::string& type)
+{
+    std::unique_ptr<Integrator> integ(newIntegrator(type));
+    integ->setMethod(BDF_Method);
+    integ->setProblemType(problemType(m_linearSolverType));
+    int nmax = m_integ->maxSteps();
+    if (nmax > 0) {
+        integ->setMaxSteps(nmax);
+    }
+    m_integ = std::move(integ);
+    m_integratorType = type;
+    m_init = false;
+}
+
+void ReactorNet::setLinearSolverType(const std::string& linSolverType)
+{
+    m_integ->setProblemType(problemType(linSolverType));
+    m_linearSolverType = linSolverType;
+    m_init = false;
+}
+
+void ReactorNet::setDerivativeSettings(const AnyMap& settings)
+{
+    for (auto reactor : m_reactors) {
+        reactor->setDerivativeSettings(settings);
+    }
+}
+
+void ReactorNet::setPreconditionerType(const std::string& type)
+{
+    if (type != "LU" && type != "ILUT") {
+        throw CanteraError("ReactorNet::setPreconditionerType",
+                           "Unknown preconditioner type '{}'", type);
+    }
+    m_precon_type = type;
+}
+
+void ReactorNet::setPreconditionerOptions(double droptol, int fillfactor)
+{
+    if (droptol < 0 || fillfactor < 1) {
+        throw CanteraError("ReactorNet::setPreconditionerOptions",
+            "Invalid options: droptol = {}, fillfactor = {}", droptol, fillfactor);
+    }
+    m_ilut_droptol = droptol;
+    m_ilut_fillfactor = fillfactor;
+}
+
+void ReactorNet::setAdaptiveChemistry(const AnyMap& settings)
+{
+    AnyMap reactorSettings = settings;
+    if (settings.empty()) {
+        m_adaptiveInterval = 0;
+    } else {
+        if (!settings.hasKey("targets")) {
+            throw CanteraError("ReactorNet::setAdaptiveChemistry",
+                               "No target species specified.");
+        }
+        long int interval = settings.getInt("interval", 10);
+        if (interval < 1) {
+            throw CanteraError("ReactorNet::setAdaptiveChemistry",
+                "Update interval must be positive; got {}", interval);
+        }
+        m_adaptiveInterval = interval;
+        reactorSettings.erase("interval");
+    }
+    for (auto reactor : m_reactors) {
+        if (reactor->chemistryEnabled()) {
+            reactor->setAdaptiveChemistry(reactorSettings);
+        }
+    }
+    m_adaptiveSteps = 0;
+    m_adaptiveUpdates = 0;
+    m_adaptiveSwitches = 0;
+    m_adaptiveRefinements = 0;
+    m_adaptiveFull = 0;
+    m_adaptiveMaxError = 0.0;
+    m_adaptiveSpecies = 0.0;
+    m_adaptiveReactions = 0.0;
+    m_adaptiveSamples = 0;
+    m_integrator_init = false;
+}
+
+void ReactorNet::updateAdaptiveChemistry()
+{
+    bool changed = false;
+    for (auto reactor : m_reactors) {
+        if (!reactor->adaptiveChemistry()) {
+            continue;
+        }
+        changed |= reactor->updateActiveReactions();
+        m_adaptiveRefinements += reactor->nThresholdRefinements();
+        if (!reactor->reducedMechanism()) {
+            m_adaptiveFull++;
+        }
+        m_adaptiveMaxError = std::max(m_adaptiveMaxError,
+                                      reactor->adaptiveChemistryError());
+        m_adaptiveSpecies += reactor->nActiveSpecies();
+        m_adaptiveReactions += reactor->nActiveReactions();
+        m_adaptiveSamples++;
+    }
+    m_adaptiveUpdates++;
+    m_adaptiveSteps = 0;
+    if (changed && m_init) {
+        // The governing equations changed discontinuously, so the integrator
+        // history can no longer be used
+        m_adaptiveSwitches++;
+        reinitialize();
+    }
+}
+
+AnyMap ReactorNet::adaptiveChemistryStats() const
+{
+    AnyMap stats;
+    stats["updates"] = static_cast<long int>(m_adaptiveUpdates);
+    stats["switches"] = static_cast<long int>(m_adaptiveSwitches);
+    stats["refinements"] = static_cast<long int>(m_adaptiveRefinements);
+    stats["full-mechanism"] = static_cast<long int>(m_adaptiveFull);
+    stats["max-error"] = m_adaptiveMaxError;
+    double n = std::max<double>(m_adaptiveSamples, 1);
+    stats["mean-active-species"] = m_adaptiveSpecies / n;
+    stats["mean-active-reactions"] = m_adaptiveReactions / n;
+    return stats;
+}
+
+size_t ReactorNet::addEvent(Reactor& r, const string& component,
+                            const string& type, double value, bool terminal)
+{
+    if (type != "threshold" && type != "peak" && type != "max-rate") {
+        throw CanteraError("ReactorNet::addEvent",
+                           "Unknown event type '{}'", type);
+    }
+    if (std::find(m_reactors.begin(), m_reactors.end(), &r) == m_reactors.end()) {
+        throw CanteraError("ReactorNet::addEvent",
+            "Reactor '{}' is not part of this network.", r.name());
+    }
+    m_events.push_back({&r, component, type, value, terminal, npos, {}});
+    // The number of root functions changed
+    m_init = false;
+    return m_events.size() - 1;
+}
+
+void ReactorNet::clearEvents()
+{
+    m_events.clear();
+    m_lastEvent = npos;
+    m_init = false;
+}
+
+const vector_fp& ReactorNet::eventTimes(size_t i) const
+{
+    if (i >= m_events.size()) {
+        throw IndexError("ReactorNet::eventTimes", "m_events", i,
+                         m_events.size() - 1);
+    }
+    return m_events[i].times;
+}
+
+void ReactorNet::setOutputTimes(const vector_fp& times)
+{
+    for (size_t j = 0; j < times.size(); j++) {
+        if ((j == 0 && times[j] < m_time) || (j > 0 && times[j] <= times[j-1])) {
+            throw CanteraError("ReactorNet::setOutputTimes",
+                "Output times must be increasing and not earlier than the "
+                "current time ({}); got {} at index {}.", m_time, times[j], j);
+        }
+    }
+    m_outputTimes = times;
+    m_nOutputs = 0;
+    m_outputStates.resize(m_nv, m_outputTimes.size());
+}
+
 void ReactorNet::initialize()
 {
     m_nv = 0;
@@ -99,11 +305,35 @@ void ReactorNet::initialize()
             throw CanteraError("ReactorNet::initialize",
                                "FlowReactors must be used alone.");
         }
+        if (m_linearSolverType != "DENSE" && m_integratorType != "RKC"
+            && !r.hasJacobian()) {
+            throw CanteraError("ReactorNet::initialize",
+                "Linear solver type '{}' requires a Jacobian, which is not "
+                "available for reactor '{}' of type '{}'.",
+                m_linearSolverType, r.name(), r.type());
+        }
     }
 
     m_ydot.resize(m_nv,0.0);
     m_yest.resize(m_nv,0.0);
+    for (auto& event : m_events) {
+        auto iter = std::find(m_reactors.begin(), m_reactors.end(), event.reactor);
+        size_t n = iter - m_reactors.begin();
+        size_t k = event.reactor->componentIndex(event.component);
+        if (k == npos) {
+            throw CanteraError("ReactorNet::initialize", "Component '{}' of "
+                "event not found in reactor '{}'.", event.component,
+                event.reactor->name());
+        }
+        event.index = m_start[n] + k;
+    }
+    m_rootInfo.resize(m_events.size());
+    m_root_ydot.resize(m_nv);
+    m_root_y.resize(m_nv);
+    m_root_ydot2.resize(m_nv);
+    m_outputStates.resize(m_nv, m_outputTimes.size());
     m_advancelimits.resize(m_nv,-1.0);
+    m_precon_jac.resize(0, 0);
     m_atol.resize(neq());
     fill(m_atol.begin(), m_atol.end(), m_atols);
     m_integ->setTolerances(m_rtol, neq(), m_atol.data());
@@ -114,16 +344,118 @@ void ReactorNet::initialize()
         writelog("Number of equations: {:d}\n", neq());
         writelog("Maximum time step:   {:14.6g}\n", m_maxstep);
     }
+    updateJacobianColoring();
     m_integ->initialize(m_time, *this);
+    m_tn = m_time;
     m_integrator_init = true;
     m_init = true;
 }
 
+void ReactorNet::updateJacobianColoring()
+{
+    size_t nr = m_reactors.size();
+    std::map<const ReactorBase*, size_t> index;
+    for (size_t n = 0; n < nr; n++) {
+        index[m_reactors[n]] = n;
+    }
+
+    // Determine which reactors are directly coupled. Couplings are treated as
+    // symmetric, since flow rates through valves and pressure controllers
+    // depend on the pressures of both the upstream and downstream reactors.
+    vector<std::set<size_t>> coupled(nr);
+    auto connect = [&](const ReactorBase& a, const ReactorBase& b) {
+        auto ia = index.find(&a);
+        auto ib = index.find(&b);
+        if (ia != index.end() && ib != index.end()) {
+            coupled[ia->second].insert(ib->second);
+            coupled[ib->second].insert(ia->second);
+        }
+    };
+    for (size_t n = 0; n < nr; n++) {
+        Reactor& r = *m_reactors[n];
+        coupled[n].insert(n);
+        if (dynamic_cast<ReactorAccessor*>(&r)) {
+            // user-defined governing equations may depend on any reactor
+            for (size_t m = 0; m < nr; m++) {
+                connect(r, *m_reactors[m]);
+            }
+        }
+        for (size_t i = 0; i < r.nWalls(); i++) {
+            WallBase& w = r.wall(i);
+            connect(w.left(), w.right());
+        }
+        for (size_t i = 0; i < r.nInlets() + r.nOutlets(); i++) {
+            FlowDevice& dev = (i < r.nInlets()) ? r.inlet(i)
+                                                : r.outlet(i - r.nInlets());
+            connect(dev.in(), dev.out());
+            auto pc = dynamic_cast<PressureController*>(&dev);
+            if (pc && pc->master()) {
+                connect(dev.in(), pc->master()->in());
+                connect(dev.in(), pc->master()->out());
+                connect(dev.out(), pc->master()->in());
+                connect(dev.out(), pc->master()->out());
+            }
+        }
+    }
+    m_coupled.resize(nr);
+    for (size_t n = 0; n < nr; n++) {
+        m_coupled[n].assign(coupled[n].begin(), coupled[n].end());
+    }
+
+    // Greedy distance-2 coloring: reactors can be perturbed together if there
+    // is no reactor whose governing equations depend on both of them
+    m_colorGroups.clear();
+    vector<vector<bool>> rowsUsed;
+    for (size_t n = 0; n < nr; n++) {
+        size_t g = 0;
+        for (; g < m_colorGroups.size(); g++) {
+            bool conflict = false;
+            for (size_t m : m_coupled[n]) {
+                if (rowsUsed[g][m]) {
+                    conflict = true;
+                    break;
+                }
+            }
+            if (!conflict) {
+                break;
+            }
+        }
+        if (g == m_colorGroups.size()) {
+            m_colorGroups.emplace_back();
+            rowsUsed.emplace_back(nr, false);
+        }
+        m_colorGroups[g].push_back(n);
+        for (size_t m : m_coupled[n]) {
+            rowsUsed[g][m] = true;
+        }
+    }
+
+    m_nColors = 0;
+    for (const auto& group : m_colorGroups) {
+        size_t nmax = 0;
+        for (size_t n : group) {
+            nmax = std::max(nmax, m_start[n+1] - m_start[n]);
+        }
+        m_nColors += nmax;
+    }
+    m_jac_dy.resize(nr);
+    m_jac_ysave.resize(nr);
+}
+
+size_t ReactorNet::nJacobianColors()
+{
+    if (!m_init) {
+        initialize();
+    }
+    return m_nColors;
+}
+
 void ReactorNet::reinitialize()
 {
     if (m_init) {
         debuglog("Re-initializing reactor network.\n", m_verbose);
         m_integ->reinitialize(m_time, *this);
+        m_tn = m_time;
         m_integrator_init = true;
     } else {
         initialize();
@@ -147,11 +479,153 @@ void ReactorNet::advance(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
-    m_integ->integrate(time);
+    m_lastEvent = npos;
+    if (m_adaptiveInterval) {
+        // Take individual steps so the reduced mechanisms can be updated
+        // between steps
+        while (m_tn < time) {
+            if (m_adaptiveSteps % m_adaptiveInterval == 0) {
+                updateAdaptiveChemistry();
+            }
+            m_tn = m_integ->step(time);
+            if (!m_integ->rootFound()) {
+                m_adaptiveSteps++;
+            }
+            recordOutputs(std::min(m_tn, time));
+            m_time = m_tn;
+            updateState(m_integ->solution());
+            // Events located past *time* are recorded, but do not stop the
+            // integration
+            if (m_integ->rootFound() && recordEvents() && m_tn <= time) {
+                return;
+            }
+        }
+    }
+    // Integrate to each output time before *time*, then to *time*
+    while (true) {
+        double tout = time;
+        if (m_nOutputs < m_outputTimes.size()) {
+            tout = std::min(tout, m_outputTimes[m_nOutputs]);
+        }
+        m_integ->integrate(tout);
+        if (m_integ->rootFound()) {
+            double troot = m_integ->rootTime();
+            m_tn = std::max(m_tn, troot);
+            recordOutputs(troot);
+            if (recordEvents()) {
+                m_time = troot;
+                updateState(m_integ->solution());
+                return;
+            }
+            continue;
+        }
+        m_tn = std::max(m_tn, tout);
+        recordOutputs(tout);
+        if (tout == time) {
+            break;
+        }
+    }
     m_time = time;
     updateState(m_integ->solution());
 }
 
+bool ReactorNet::recordEvents()
+{
+    double t = m_integ->rootTime();
+    double* y = m_integ->solution();
+    m_integ->getRootInfo(m_rootInfo.data());
+    bool terminal = false;
+    bool have_ydot = false;
+    for (size_t i = 0; i < m_events.size(); i++) {
+        Event& event = m_events[i];
+        if (m_rootInfo[i] == 0) {
+            continue;
+        }
+        if (event.type != "threshold") {
+            // only maxima, where the root function is decreasing, with a value
+            // of at least the specified minimum are events
+            if (m_rootInfo[i] > 0) {
+                continue;
+            }
+            double v = y[event.index];
+            if (event.type == "max-rate") {
+                if (!have_ydot) {
+                    eval(t, y, m_root_ydot.data(), m_sens_params.data());
+                    have_ydot = true;
+                }
+                v = m_root_ydot[event.index];
+            }
+            if (v < event.value) {
+                continue;
+            }
+        }
+        event.times.push_back(t);
+        m_lastEvent = i;
+        terminal |= event.terminal;
+    }
+    return terminal;
+}
+
+void ReactorNet::recordOutputs(double tmax)
+{
+    while (m_nOutputs < m_outputTimes.size()
+           && m_outputTimes[m_nOutputs] <= tmax) {
+        double t = m_outputTimes[m_nOutputs];
+        double* y = m_integ->derivative(t, 0);
+        std::copy(y, y + m_nv, m_outputStates.ptrColumn(m_nOutputs));
+        if (m_outputCallback) {
+            m_outputCallback(t, y);
+        }
+        m_nOutputs++;
+    }
+}
+
+void ReactorNet::evalRootFunctions(double t, double* y, double* gout)
+{
+    bool have_ydot = false;
+    bool have_ydot2 = false;
+    double dt = 0.0;
+    for (size_t i = 0; i < m_events.size(); i++) {
+        const Event& event = m_events[i];
+        size_t k = event.index;
+        if (event.type == "threshold") {
+            gout[i] = y[k] - event.value;
+            continue;
+        }
+        if (!have_ydot) {
+            eval(t, y, m_root_ydot.data(), m_sens_params.data());
+            have_ydot = true;
+        }
+        if (event.type == "peak") {
+            gout[i] = m_root_ydot[k];
+            continue;
+        }
+        if (!have_ydot2) {
+            // The second time derivative is the directional derivative of the
+            // right hand side along the solution trajectory
+            double ynorm = 0.0, ydotnorm = 0.0;
+            for (size_t j = 0; j < m_nv; j++) {
+                ynorm += y[j] * y[j];
+                ydotnorm += m_root_ydot[j] * m_root_ydot[j];
+            }
+            if (ydotnorm == 0.0) {
+                m_root_ydot2 = m_root_ydot;
+                dt = 1.0;
+            } else {
+                dt = sqrt(std::numeric_limits<double>::epsilon())
+                     * (1.0 + sqrt(ynorm)) / sqrt(ydotnorm);
+                for (size_t j = 0; j < m_nv; j++) {
+                    m_root_y[j] = y[j] + dt * m_root_ydot[j];
+                }
+                eval(t + dt, m_root_y.data(), m_root_ydot2.data(),
+                     m_sens_params.data());
+            }
+            have_ydot2 = true;
+        }
+        gout[i] = (m_root_ydot2[k] - m_root_ydot[k]) / dt;
+    }
+}
+
 double ReactorNet::advance(double time, bool applylimit)
 {
     if (!m_init) {
@@ -214,8 +688,20 @@ double ReactorNet::step()
     } else if (!m_integrator_init) {
         reinitialize();
     }
+    if (m_adaptiveInterval) {
+        if (m_adaptiveSteps % m_adaptiveInterval == 0) {
+            updateAdaptiveChemistry();
+        }
+        m_adaptiveSteps++;
+    }
+    m_lastEvent = npos;
     m_time = m_integ->step(m_time + 1.0);
+    m_tn = m_time;
+    recordOutputs(m_time);
     updateState(m_integ->solution());
+    if (m_integ->rootFound()) {
+        recordEvents();
+    }
     return m_time;
 }
 
@@ -260,6 +746,7 @@ void ReactorNet::eval(doublereal t, doublereal* y,
     if (!m_checked_eval_deprecation) {
         m_have_deprecated_eval.assign(m_reactors.size(), false);
         for (size_t n = 0; n < m_reactors.size(); n++) {
+            m_reactors[n]->applyActiveReactions();
             m_reactors[n]->applySensitivity(p);
             try {
                 m_reactors[n]->evalEqs(t, y + m_start[n], ydot + m_start[n], p);
@@ -285,6 +772,7 @@ void ReactorNet::eval(doublereal t, doublereal* y,
         m_checked_eval_deprecation = true;
     } else {
         for (size_t n = 0; n < m_reactors.size(); n++) {
+            m_reactors[n]->applyActiveReactions();
             m_reactors[n]->applySensitivity(p);
             if (m_have_deprecated_eval[n]) {
                 m_reactors[n]->evalEqs(t, y + m_start[n], ydot + m_start[n], p);
@@ -325,23 +813,133 @@ double ReactorNet::sensitivity(size_t k, size_t p)
 void ReactorNet::evalJacobian(doublereal t, doublereal* y,
                               doublereal* ydot, doublereal* p, Array2D* j)
 {
+    if (!m_init) {
+        initialize();
+    }
     //evaluate the unperturbed ydot
     eval(t, y, ydot, p);
-    for (size_t n = 0; n < m_nv; n++) {
-        // perturb x(n)
-        double ysave = y[n];
-        double dy = m_atol[n] + fabs(ysave)*m_rtol;
-        y[n] = ysave + dy;
-        dy = y[n] - ysave;
+    j->zero();
+    evalColoredJacobian(t, y, ydot, p, j->ptrColumn(0));
+}
+
+void ReactorNet::evalDenseJacobian(double t, double* y, const double* ydot,
+                                   double* jac)
+{
+    std::fill(jac, jac + m_nv * m_nv, 0.0);
+    evalColoredJacobian(t, y, ydot, m_sens_params.data(), jac);
+}
+
+void ReactorNet::evalColoredJacobian(double t, double* y, const double* ydot,
+                                     double* p, double* jac)
+{
+    for (const auto& group : m_colorGroups) {
+        for (size_t k = 0; ; k++) {
+            // perturb the k-th state variable of all reactors in the group
+            bool perturbed = false;
+            for (size_t r : group) {
+                size_t n = m_start[r] + k;
+                if (n >= m_start[r+1]) {
+                    continue;
+                }
+                double ysave = y[n];
+                double dy = m_atol[n] + fabs(ysave)*m_rtol;
+                y[n] = ysave + dy;
+                m_jac_ysave[r] = ysave;
+                m_jac_dy[r] = y[n] - ysave;
+                perturbed = true;
+            }
+            if (!perturbed) {
+                break;
+            }
+
+            // calculate perturbed residual
+            eval(t, y, m_ydot.data(), p);
+
+            // compute the columns of the Jacobian within the rows of the
+            // reactors coupled to each perturbed reactor
+            for (size_t r : group) {
+                size_t n = m_start[r] + k;
+                if (n >= m_start[r+1]) {
+                    continue;
+                }
+                double dy = m_jac_dy[r];
+                for (size_t c : m_coupled[r]) {
+                    for (size_t m = m_start[c]; m < m_start[c+1]; m++) {
+                        jac[n * m_nv + m] = (m_ydot[m] - ydot[m])/dy;
+                    }
+                }
+                y[n] = m_jac_ysave[r];
+            }
+        }
+    }
+}
 
-        // calculate perturbed residual
-        eval(t, y, m_ydot.data(), p);
+void ReactorNet::evalSparseJacobian(double t, double* y,
+                                    Eigen::SparseMatrix<double>& jac)
+{
+    updateState(y);
+    m_jac_trips.clear();
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_reactors[n]->applyActiveReactions();
+        Eigen::SparseMatrix<double> rjac = m_reactors[n]->jacobian();
+        int offset = static_cast<int>(m_start[n]);
+        for (int k = 0; k < rjac.outerSize(); k++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(rjac, k); it; ++it) {
+                m_jac_trips.emplace_back(offset + static_cast<int>(it.row()),
+                                         offset + static_cast<int>(it.col()),
+                                         it.value());
+            }
+        }
+    }
+    // Make sure that the diagonal is part of the sparsity pattern, as required
+    // to form the Newton iteration matrix I - gamma*J
+    for (size_t i = 0; i < m_nv; i++) {
+        m_jac_trips.emplace_back(static_cast<int>(i), static_cast<int>(i), 0.0);
+    }
+    jac.resize(m_nv, m_nv);
+    jac.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
+}
 
-        // compute nth column of Jacobian
-        for (size_t m = 0; m < m_nv; m++) {
-            j->value(m,n) = (m_ydot[m] - ydot[m])/dy;
+bool ReactorNet::preconditionerSetup(double t, double* y, double gamma,
+                                     bool jacOk)
+{
+    bool jacCurrent = !jacOk
+                      || static_cast<size_t>(m_precon_jac.rows()) != m_nv;
+    if (jacCurrent) {
+        evalSparseJacobian(t, y, m_precon_jac);
+    }
+    // The diagonal is always part of the sparsity pattern of the Jacobian
+    m_precon_matrix = -gamma * m_precon_jac;
+    for (size_t i = 0; i < m_nv; i++) {
+        m_precon_matrix.coeffRef(i, i) += 1.0;
+    }
+    if (m_precon_type == "ILUT") {
+        m_ilut.setDroptol(m_ilut_droptol);
+        m_ilut.setFillfactor(m_ilut_fillfactor);
+        m_ilut.compute(m_precon_matrix);
+        if (m_ilut.info() != Eigen::Success) {
+            throw CanteraError("ReactorNet::preconditionerSetup",
+                "Incomplete LU factorization of the preconditioner failed.");
+        }
+    } else {
+        m_splu.compute(m_precon_matrix);
+        if (m_splu.info() != Eigen::Success) {
+            throw CanteraError("ReactorNet::preconditionerSetup",
+                "LU factorization of the preconditioner failed:\n{}",
+                m_splu.lastErrorMessage());
         }
-        y[n] = ysave;
+    }
+    return jacCurrent;
+}
+
+void ReactorNet::preconditionerSolve(double* rhs, double* output)
+{
+    Eigen::Map<const Eigen::VectorXd> r(rhs, m_nv);
+    Eigen::Map<Eigen::VectorXd> z(output, m_nv);
+    if (m_precon_type == "ILUT") {
+        z = m_ilut.solve(r);
+    } else {
+        z = m_splu.solve(r);
     }
 }
 
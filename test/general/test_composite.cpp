@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 #include "cantera/base/Interface.h"
+#include "cantera/base/BinaryMechanism.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/transport/GasTransport.h"
 
 using namespace Cantera;
 
@@ -27,3 +31,193 @@ TEST(Interface, from_AnyMap_and_Solution)
     ASSERT_EQ(gas.get(), surf->adjacent(0).get());
     ASSERT_EQ(surf->kinetics()->nReactions(), 24);
 }
+
+TEST(Solution, clone)
+{
+    auto gas = newSolution("gri30.yaml", "gri30", "Mix");
+    gas->thermo()->setState_TPX(1200, 2 * OneAtm, "CH4:0.5, O2:1.0, N2:3.76");
+    gas->kinetics()->setMultiplier(5, 0.5);
+    auto copy = gas->clone();
+    auto& thermo = *gas->thermo();
+    auto& thermo2 = *copy->thermo();
+    ASSERT_NE(&thermo, &thermo2);
+    ASSERT_EQ(thermo2.type(), thermo.type());
+    ASSERT_EQ(thermo2.name(), thermo.name());
+    ASSERT_EQ(thermo2.nSpecies(), thermo.nSpecies());
+    for (size_t k = 0; k < thermo.nSpecies(); k++) {
+        EXPECT_EQ(thermo2.species(k).get(), thermo.species(k).get());
+    }
+    auto& kin = *gas->kinetics();
+    auto& kin2 = *copy->kinetics();
+    ASSERT_EQ(kin2.nReactions(), kin.nReactions());
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        EXPECT_EQ(kin2.reaction(i).get(), kin.reaction(i).get());
+    }
+    EXPECT_DOUBLE_EQ(kin2.multiplier(5), 0.5);
+    EXPECT_EQ(copy->transport()->transportType(), "Mix");
+
+    // state of the clone matches the original
+    EXPECT_DOUBLE_EQ(thermo2.temperature(), thermo.temperature());
+    EXPECT_DOUBLE_EQ(thermo2.pressure(), thermo.pressure());
+    size_t nsp = thermo.nSpecies();
+    vector_fp wdot(nsp), wdot2(nsp);
+    kin.getNetProductionRates(wdot.data());
+    kin2.getNetProductionRates(wdot2.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-14 * (1 + std::abs(wdot[k])));
+    }
+    EXPECT_DOUBLE_EQ(copy->transport()->viscosity(),
+                     gas->transport()->viscosity());
+
+    // states are independent
+    thermo2.setState_TP(1500, OneAtm);
+    EXPECT_DOUBLE_EQ(thermo.temperature(), 1200);
+    kin2.getNetProductionRates(wdot2.data());
+    kin.getNetProductionRates(wdot.data());
+    thermo.setState_TP(1500, OneAtm);
+    kin.getNetProductionRates(wdot.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-14 * (1 + std::abs(wdot[k])));
+    }
+}
+
+TEST(Solution, clone_transport_fits)
+{
+    auto gas = newSolution("h2o2.yaml", "", "Mix");
+    gas->thermo()->setState_TPX(1000, OneAtm, "H2:1.0, O2:0.5, AR:2.0");
+    auto& tran = dynamic_cast<GasTransport&>(*gas->transport());
+    size_t k = gas->thermo()->speciesIndex("AR");
+    vector_fp coeffs(5);
+    tran.getViscosityPolynomial(k, coeffs.data());
+    coeffs[0] += 0.1;
+    tran.setViscosityPolynomial(k, coeffs.data());
+
+    // modified fits are used by the clone instead of regenerated ones
+    auto copy = gas->clone();
+    EXPECT_DOUBLE_EQ(copy->transport()->viscosity(),
+                     gas->transport()->viscosity());
+}
+
+TEST(Solution, clone_rate_table)
+{
+    auto gas = newSolution("h2o2.yaml", "", "None");
+    auto& kin = dynamic_cast<GasKinetics&>(*gas->kinetics());
+    kin.setRateTable(300, 3000, 5, 1e-3);
+    auto copy = gas->clone();
+    auto& kin2 = dynamic_cast<GasKinetics&>(*copy->kinetics());
+    ASSERT_TRUE(kin2.rateTableEnabled());
+    double Tmin, Tmax, dT, rtol;
+    kin2.getRateTable(Tmin, Tmax, dT, rtol);
+    EXPECT_DOUBLE_EQ(Tmin, 300);
+    EXPECT_DOUBLE_EQ(Tmax, 3000);
+    EXPECT_DOUBLE_EQ(dT, 5);
+    EXPECT_DOUBLE_EQ(rtol, 1e-3);
+
+    gas->thermo()->setState_TPX(1234.5, OneAtm, "H2:1.0, O2:0.5, H:0.01");
+    copy->thermo()->setState_TPX(1234.5, OneAtm, "H2:1.0, O2:0.5, H:0.01");
+    size_t nr = kin.nReactions();
+    vector_fp ropf(nr), ropf2(nr);
+    kin.getFwdRatesOfProgress(ropf.data());
+    kin2.getFwdRatesOfProgress(ropf2.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(ropf2[i], ropf[i]);
+    }
+
+    kin.clearRateTable();
+    auto copy2 = gas->clone();
+    EXPECT_FALSE(dynamic_cast<GasKinetics&>(*copy2->kinetics()).rateTableEnabled());
+}
+
+TEST(Solution, clone_quasi_steady)
+{
+    auto gas = newSolution("gri30.yaml", "gri30", "None");
+    auto& kin = dynamic_cast<GasKinetics&>(*gas->kinetics());
+    kin.setQuasiSteadySpecies({"C", "CH", "CH2(S)"});
+    kin.setQuasiSteadyTolerances(1e-10, 1e-22, 20);
+    auto copy = gas->clone();
+    auto& kin2 = dynamic_cast<GasKinetics&>(*copy->kinetics());
+    EXPECT_EQ(kin2.quasiSteadySpecies(), kin.quasiSteadySpecies());
+    double rtol, atol;
+    size_t maxIter;
+    kin2.getQuasiSteadyTolerances(rtol, atol, maxIter);
+    EXPECT_DOUBLE_EQ(rtol, 1e-10);
+    EXPECT_DOUBLE_EQ(atol, 1e-22);
+    EXPECT_EQ(maxIter, 20u);
+
+    const char* X = "CH4:1, O2:2, N2:7.52, H:0.01, OH:0.01, CH3:0.01";
+    gas->thermo()->setState_TPX(1500, OneAtm, X);
+    copy->thermo()->setState_TPX(1500, OneAtm, X);
+    size_t nsp = gas->thermo()->nSpecies();
+    vector_fp wdot(nsp), wdot2(nsp);
+    kin.getNetProductionRates(wdot.data());
+    kin2.getNetProductionRates(wdot2.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-14 * (1 + std::abs(wdot[k])));
+    }
+}
+
+TEST(Solution, clone_unsupported)
+{
+    auto gas = newSolution("ptcombust.yaml", "gas");
+    auto surf = newInterface("ptcombust.yaml", "Pt_surf", {gas});
+    EXPECT_THROW(surf->clone(), NotImplementedError);
+}
+
+TEST(Solution, binary_mechanism)
+{
+    for (std::string name : {"pdep-test.yaml", "gri30.yaml"}) {
+        auto gas = newSolution(name, "", name == "gri30.yaml" ? "Mix" : "");
+        gas->thermo()->setState_TPX(1200, 2 * OneAtm, gas->thermo()->speciesName(0)
+                                    + ":0.5, " + gas->thermo()->speciesName(1)
+                                    + ":1.0");
+        gas->kinetics()->setMultiplier(2, 0.5);
+        writeBinaryMechanism(gas, "generated-mechanism.ctb");
+        auto copy = newSolution("generated-mechanism.ctb");
+        auto& thermo = *gas->thermo();
+        auto& thermo2 = *copy->thermo();
+        ASSERT_EQ(thermo2.type(), thermo.type());
+        ASSERT_EQ(thermo2.name(), thermo.name());
+        ASSERT_EQ(thermo2.nSpecies(), thermo.nSpecies());
+        EXPECT_EQ(copy->source(), gas->source());
+        EXPECT_DOUBLE_EQ(thermo2.temperature(), thermo.temperature());
+        EXPECT_DOUBLE_EQ(thermo2.pressure(), thermo.pressure());
+        EXPECT_DOUBLE_EQ(thermo2.enthalpy_mass(), thermo.enthalpy_mass());
+        EXPECT_DOUBLE_EQ(thermo2.cp_mass(), thermo.cp_mass());
+
+        auto& kin = *gas->kinetics();
+        auto& kin2 = *copy->kinetics();
+        ASSERT_EQ(kin2.nReactions(), kin.nReactions());
+        EXPECT_DOUBLE_EQ(kin2.multiplier(2), 0.5);
+        size_t nsp = thermo.nSpecies();
+        vector_fp wdot(nsp), wdot2(nsp);
+        for (double T : {900.0, 1500.0}) {
+            thermo.setState_TP(T, 3 * OneAtm);
+            thermo2.setState_TP(T, 3 * OneAtm);
+            kin.getNetProductionRates(wdot.data());
+            kin2.getNetProductionRates(wdot2.data());
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(wdot2[k], wdot[k], 1e-14 * (1 + std::abs(wdot[k])));
+            }
+        }
+        EXPECT_EQ(copy->transport()->transportType(),
+                  gas->transport()->transportType());
+    }
+
+    // transport properties use the stored polynomial fits
+    auto gas = newSolution("gri30.yaml", "", "Mix");
+    auto copy = newSolution("generated-mechanism.ctb");
+    gas->thermo()->setState_TPX(1200, OneAtm, "CH4:0.5, O2:1.0, N2:3.76");
+    copy->thermo()->setState_TPX(1200, OneAtm, "CH4:0.5, O2:1.0, N2:3.76");
+    EXPECT_DOUBLE_EQ(copy->transport()->viscosity(), gas->transport()->viscosity());
+    EXPECT_DOUBLE_EQ(copy->transport()->thermalConductivity(),
+                     gas->transport()->thermalConductivity());
+}
+
+TEST(Solution, binary_mechanism_unsupported)
+{
+    auto gas = newSolution("ptcombust.yaml", "gas");
+    auto surf = newInterface("ptcombust.yaml", "Pt_surf", {gas});
+    EXPECT_THROW(writeBinaryMechanism(surf, "generated-unsupported.ctb"),
+                 NotImplementedError);
+    EXPECT_THROW(newSolution("h2o2.yaml.ctb"), CanteraError);
+}
@@ -3,9 +3,11 @@
 #include "cantera/base/Solution.h"
 #include "cantera/base/Interface.h"
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/KineticsFactory.h"
 #include "cantera/kinetics/ReactionFactory.h"
+#include "cantera/kinetics/ReactionPath.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/base/Array.h"
 
@@ -480,6 +482,636 @@ TEST(KineticsFromYaml, ReactionsFieldWithoutKineticsModel2)
                  InputFileError);
 }
 
+TEST(KineticsFromYaml, VectorizedArrheniusRates)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    vector_fp kf(kin->nReactions());
+    for (double T : {300., 1234.5, 3000.}) {
+        gas->setState_TP(T, OneAtm);
+        kin->getFwdRateConstants(kf.data());
+        for (size_t i = 0; i < kin->nReactions(); i++) {
+            auto R = kin->reaction(i);
+            if (R->type() == "reaction" && R->rate()->type() == "Arrhenius") {
+                // reference value uses scalar evaluation; three-body reactions
+                // are skipped since legacy rate constants include the
+                // third-body concentration
+                double k = R->rate()->eval(T);
+                EXPECT_NEAR(kf[i], k, 1e-13 * k) << i;
+            }
+        }
+    }
+
+    // parameter arrays are refreshed after a rate is replaced
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: O + H2 <=> H + OH,"
+        " rate-constant: {A: 1.0e+10, b: 1.5, Ea: 1000.0}}");
+    kin->modifyReaction(2, newReaction(rxn, *kin));
+    gas->setState_TP(1000, OneAtm);
+    kin->getFwdRateConstants(kf.data());
+    EXPECT_NEAR(kf[2], 1e10 * pow(1000, 1.5) * exp(-1000. / GasConstant / 1000),
+                1e-13 * kf[2]);
+}
+
+TEST(KineticsFromYaml, BatchPlogChebyshevRates)
+{
+    auto sol = newSolution("pdep-test.yaml");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    vector_fp kf(kin->nReactions());
+    for (double P : {1e-3 * OneAtm, OneAtm, 3.7 * OneAtm, 300 * OneAtm}) {
+        for (double T : {300., 1234.5, 2500.}) {
+            gas->setState_TP(T, P);
+            kin->getFwdRateConstants(kf.data());
+            for (size_t i = 0; i < kin->nReactions(); i++) {
+                // reference value uses scalar evaluation
+                double k = kin->reaction(i)->rate()->eval(T, P);
+                EXPECT_NEAR(kf[i], k, 1e-12 * k) << i;
+            }
+        }
+    }
+
+    // parameter arrays are refreshed after a rate is replaced
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: H + R2 <=> P2A + P2B,"
+        " type: pressure-dependent-Arrhenius,"
+        " rate-constants: [{P: 0.01 atm, A: 1.0e+13, b: 0.0, Ea: 0.0},"
+        "                  {P: 1.0 atm, A: 1.0e+14, b: 0.0, Ea: 0.0}]}");
+    kin->modifyReaction(1, newReaction(rxn, *kin));
+    gas->setState_TP(1000, 0.1 * OneAtm);
+    kin->getFwdRateConstants(kf.data());
+    EXPECT_NEAR(kf[1], 1e13 * pow(10, 0.5), 1e-12 * kf[1]);
+}
+
+TEST(KineticsFromYaml, ActiveReactions)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    size_t nr = kin->nReactions();
+    gas->setState_TPX(1500, OneAtm, "CH4:1, O2:2, N2:7.52, H:0.01, OH:0.01");
+    vector_fp rop0(nr), rop(nr);
+    kin->getNetRatesOfProgress(rop0.data());
+
+    EXPECT_THROW(kin->setActiveReactions(std::vector<bool>(nr - 1, true)),
+                 CanteraError);
+    std::vector<bool> active(nr, true);
+    for (size_t i = 0; i < nr; i += 3) {
+        active[i] = false;
+    }
+    kin->setActiveReactions(active);
+    EXPECT_EQ(kin->activeReactions().size(), nr);
+    kin->getNetRatesOfProgress(rop.data());
+    for (size_t i = 0; i < nr; i++) {
+        if (active[i]) {
+            EXPECT_NEAR(rop[i], rop0[i], 1e-12 * std::abs(rop0[i])) << i;
+        } else {
+            EXPECT_EQ(rop[i], 0.0) << i;
+        }
+    }
+
+    // reactions added later are active
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: H + CH4 <=> CH3 + H2, rate-constant: {A: 6.6e+05, b: 1.62,"
+        " Ea: 1.087e+04 cal/mol}, duplicate: true}");
+    kin->addReaction(newReaction(rxn, *kin));
+    EXPECT_EQ(kin->activeReactions().size(), nr + 1);
+    EXPECT_TRUE(kin->activeReactions()[nr]);
+
+    // an empty mask activates all reactions
+    kin->setActiveReactions({});
+    EXPECT_TRUE(kin->activeReactions().empty());
+    rop.resize(nr + 1);
+    kin->getNetRatesOfProgress(rop.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_NEAR(rop[i], rop0[i], 1e-12 * std::abs(rop0[i])) << i;
+    }
+}
+
+TEST(KineticsFromYaml, DirectedRelationGraph)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    size_t nsp = gas->nSpecies();
+    size_t nr = kin->nReactions();
+    gas->setState_TPX(1800, OneAtm, "CH4:1, O2:2, N2:7.52, H:0.005, OH:0.005, O:0.005");
+    vector_fp wdot0(nsp), wdot(nsp);
+    kin->getNetProductionRates(wdot0.data());
+
+    EXPECT_THROW(DirectedRelationGraph(*kin, "foo"), CanteraError);
+    for (std::string method : {"DRG", "DRGEP"}) {
+        DirectedRelationGraph drg(*kin, method);
+        EXPECT_THROW(drg.setTargets({"CH4", "XYZ"}), CanteraError);
+        drg.setTargets({"CH4", "O2"});
+        drg.update();
+        size_t kCH4 = gas->speciesIndex("CH4");
+        size_t kAR = gas->speciesIndex("AR");
+        EXPECT_DOUBLE_EQ(drg.importance(kCH4), 1.0);
+        EXPECT_DOUBLE_EQ(drg.importance(gas->speciesIndex("O2")), 1.0);
+        // inert species do not interact with the targets
+        EXPECT_EQ(drg.importance(kAR), 0.0);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_GE(drg.importance(k), 0.0);
+            EXPECT_LE(drg.importance(k), 1.0);
+            EXPECT_LE(drg.interactionCoefficient(kCH4, k), 1.0);
+        }
+
+        // importance of species decreases monotonically with the threshold
+        EXPECT_LE(drg.nActiveSpecies(0.1), drg.nActiveSpecies(0.01));
+        EXPECT_LT(drg.nActiveSpecies(0.1), nsp);
+
+        std::vector<bool> active;
+        drg.getActiveReactions(1e-4, active);
+        ASSERT_EQ(active.size(), nr);
+        size_t nActive = std::count(active.begin(), active.end(), true);
+        EXPECT_GT(nActive, 0u);
+        EXPECT_LT(nActive, nr);
+        kin->setActiveReactions(active);
+        kin->getNetProductionRates(wdot.data());
+        double wmax = 0, err = 0;
+        for (size_t k = 0; k < nsp; k++) {
+            wmax = std::max(wmax, std::abs(wdot0[k]));
+            err = std::max(err, std::abs(wdot[k] - wdot0[k]));
+        }
+        EXPECT_LT(err, 0.05 * wmax) << method;
+
+        // analysis uses the full mechanism and preserves the mask
+        drg.update();
+        EXPECT_EQ(kin->activeReactions(), active);
+        EXPECT_DOUBLE_EQ(drg.importance(kCH4), 1.0);
+        kin->setActiveReactions({});
+    }
+}
+
+TEST(KineticsFromYaml, QuasiSteadySpecies)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "None");
+    auto gas = sol->thermo();
+    auto kin = std::dynamic_pointer_cast<GasKinetics>(sol->kinetics());
+    size_t nsp = gas->nSpecies();
+    gas->setState_TPX(1500, OneAtm, "CH4:1, O2:2, N2:7.52, H:0.01, OH:0.01, CH3:0.01");
+    vector_fp wdot0(nsp), wdot(nsp), cdot(nsp), ddot(nsp);
+    kin->getNetProductionRates(wdot0.data());
+
+    EXPECT_THROW(kin->setQuasiSteadySpecies({"CH", "spam"}), CanteraError);
+    EXPECT_THROW(kin->setQuasiSteadySpecies({"CH", "CH"}), CanteraError);
+
+    std::vector<std::string> names{"C", "CH", "CH2", "CH2(S)", "HCO", "H2CN"};
+    kin->setQuasiSteadySpecies(names);
+    ASSERT_EQ(kin->quasiSteadySpecies().size(), names.size());
+    kin->getNetProductionRates(wdot.data());
+    kin->getCreationRates(cdot.data());
+    kin->getDestructionRates(ddot.data());
+    for (const auto& name : names) {
+        size_t k = gas->speciesIndex(name);
+        EXPECT_EQ(kin->quasiSteadySpecies()[&name - &names[0]], k);
+        EXPECT_GT(cdot[k], 0.0) << name;
+        EXPECT_NEAR(wdot[k], 0.0, 1e-8 * cdot[k]) << name;
+        EXPECT_NEAR(cdot[k], ddot[k], 1e-8 * cdot[k]) << name;
+    }
+    // Elimination of QSS species conserves elements
+    for (size_t m = 0; m < gas->nElements(); m++) {
+        double sum = 0, scale = 0;
+        for (size_t k = 0; k < nsp; k++) {
+            sum += gas->nAtoms(k, m) * wdot[k];
+            scale += gas->nAtoms(k, m) * std::abs(wdot[k]);
+        }
+        EXPECT_NEAR(sum, 0.0, 1e-10 * scale);
+    }
+
+    // warm start from the previous solution
+    gas->setState_TP(1510, OneAtm);
+    kin->getNetProductionRates(wdot.data());
+    EXPECT_LE(kin->quasiSteadyIterations(), 3u);
+
+    // disabling the QSS approximation restores the original rates
+    kin->setQuasiSteadySpecies({});
+    EXPECT_TRUE(kin->quasiSteadySpecies().empty());
+    gas->setState_TP(1500, OneAtm);
+    kin->getNetProductionRates(wdot.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot[k], wdot0[k], 1e-10 * std::abs(wdot0[k]) + 1e-300);
+    }
+}
+
+TEST(KineticsFromYaml, RateTable)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto gas = sol->thermo();
+    auto kin = std::dynamic_pointer_cast<GasKinetics>(sol->kinetics());
+    size_t nr = kin->nReactions();
+    vector_fp kf0(nr), kr0(nr), kf(nr), kr(nr);
+    gas->setState_TPX(1000, OneAtm, "CH4:1, O2:2, N2:7.52, H:0.01, OH:0.01");
+
+    EXPECT_THROW(kin->setRateTable(1000, 500, 10), CanteraError);
+    EXPECT_FALSE(kin->rateTableEnabled());
+    // table is too coarse to meet the tolerance
+    EXPECT_THROW(kin->setRateTable(300, 3000, 500, 1e-6), CanteraError);
+    EXPECT_FALSE(kin->rateTableEnabled());
+
+    for (double T : {305.7, 1234.5, 2999., 3500.}) {
+        kin->clearRateTable();
+        gas->setState_TP(T, 2 * OneAtm);
+        kin->getFwdRateConstants(kf0.data());
+        kin->getRevRateConstants(kr0.data());
+
+        kin->setRateTable(300, 3000, 5, 1e-3);
+        EXPECT_TRUE(kin->rateTableEnabled());
+        gas->setState_TP(T + 1, 2 * OneAtm);
+        kin->getFwdRateConstants(kf.data()); // update state
+        gas->setState_TP(T, 2 * OneAtm);
+        kin->getFwdRateConstants(kf.data());
+        kin->getRevRateConstants(kr.data());
+        double tol = (T > 3000) ? 1e-14 : 1e-3;
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_NEAR(kf[i], kf0[i], tol * std::abs(kf0[i])) << T << " " << i;
+            EXPECT_NEAR(kr[i], kr0[i], tol * std::abs(kr0[i])) << T << " " << i;
+        }
+    }
+
+    // rate constants are evaluated directly after the table is removed
+    kin->clearRateTable();
+    gas->setState_TP(1234.5, OneAtm);
+    kin->getFwdRateConstants(kf0.data());
+    kin->getRevRateConstants(kr0.data());
+    kin->setRateTable(300, 3000, 5, 1e-3);
+    kin->getFwdRateConstants(kf.data());
+    kin->clearRateTable();
+    EXPECT_FALSE(kin->rateTableEnabled());
+    kin->getFwdRateConstants(kf.data());
+    kin->getRevRateConstants(kr.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(kf[i], kf0[i]);
+        EXPECT_DOUBLE_EQ(kr[i], kr0[i]);
+    }
+}
+
+TEST(KineticsFromYaml, RateTableDerivatives)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto gas = sol->thermo();
+    auto kin = std::dynamic_pointer_cast<GasKinetics>(sol->kinetics());
+    size_t nr = kin->nReactions();
+    vector_fp dq0(nr), dq(nr), kr0(nr), kr(nr), kc(nr);
+    gas->setState_TPX(900, OneAtm, "CH4:1, O2:2, N2:7.52, H:0.01, OH:0.01");
+    kin->setRateTable(300, 3000, 5, 1e-3);
+    kin->getNetRatesOfProgress_ddT(dq.data());
+
+    for (double T : {1234.5, 1876.3}) {
+        // derivatives are evaluated for the current temperature, without
+        // replacing the interpolated equilibrium constants
+        gas->setState_TP(T, OneAtm);
+        kin->getRevRateConstants(kr0.data());
+        kin->getNetRatesOfProgress_ddT(dq.data());
+        kin->getEquilibriumConstants(kc.data());
+        kin->getRevRateConstants(kr.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_DOUBLE_EQ(kr[i], kr0[i]) << T << " " << i;
+        }
+
+        kin->clearRateTable();
+        gas->setState_TP(T, OneAtm);
+        kin->getNetRatesOfProgress_ddT(dq0.data());
+        kin->setRateTable(300, 3000, 5, 1e-3);
+        double scale = 0.0;
+        for (size_t i = 0; i < nr; i++) {
+            scale = std::max(scale, std::abs(dq0[i]));
+        }
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_NEAR(dq[i], dq0[i], 1e-2 * std::abs(dq0[i]) + 1e-8 * scale)
+                << T << " " << i;
+        }
+    }
+}
+
+TEST(KineticsFromYaml, NetProductionRatesBatch)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto gas = sol->thermo();
+    auto kin = std::dynamic_pointer_cast<GasKinetics>(sol->kinetics());
+    ASSERT_TRUE(kin);
+    size_t nsp = gas->nSpecies();
+
+    // mixtures at different temperatures, pressures and compositions
+    std::vector<std::string> X = {
+        "CH4:1, O2:2, N2:7.52", "H2:2, O2:1, AR:3, H:0.01, OH:0.02",
+        "CO2:1, H2O:2, N2:7, CO:0.1, O:0.01", "H2O:1, CH3:0.1, HO2:0.05, N2:1"};
+    vector_fp T = {1200., 900., 2400., 1600.};
+    vector_fp P = {OneAtm, 5 * OneAtm, 0.5 * OneAtm, 20 * OneAtm};
+    size_t nStates = T.size();
+    vector_fp conc(nsp * nStates), wdot(nsp * nStates), ref(nsp * nStates);
+    vector_fp c(nsp), w(nsp);
+    for (size_t m = 0; m < nStates; m++) {
+        gas->setState_TPX(T[m], P[m], X[m]);
+        gas->getConcentrations(c.data());
+        kin->getNetProductionRates(w.data());
+        for (size_t k = 0; k < nsp; k++) {
+            conc[k * nStates + m] = c[k];
+            ref[k * nStates + m] = w[k];
+        }
+    }
+
+    gas->setState_TPX(500, OneAtm, "N2:1");
+    int stateNum = gas->stateMFNumber();
+    kin->getNetProductionRatesBatch(nStates, T.data(), P.data(), conc.data(),
+                                    wdot.data());
+    for (size_t j = 0; j < nsp * nStates; j++) {
+        EXPECT_NEAR(wdot[j], ref[j], 1e-10 * std::abs(ref[j]) + 1e-20) << j;
+    }
+
+    // state of the phase is not changed
+    EXPECT_EQ(gas->stateMFNumber(), stateNum);
+    EXPECT_DOUBLE_EQ(gas->temperature(), 500);
+    EXPECT_NEAR(gas->pressure(), OneAtm, 1e-8 * OneAtm);
+    kin->getNetProductionRates(w.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_DOUBLE_EQ(w[k], 0.0);
+    }
+}
+
+TEST(KineticsFromYaml, NetProductionRatesBatchPressureDependent)
+{
+    // P-log, Chebyshev and falloff reactions
+    auto sol = newSolution("pdep-test.yaml", "gas");
+    auto gas = sol->thermo();
+    auto kin = std::dynamic_pointer_cast<GasKinetics>(sol->kinetics());
+    ASSERT_TRUE(kin);
+    size_t nsp = gas->nSpecies();
+
+    vector_fp T = {400., 900., 1500., 1800., 1100.};
+    vector_fp P = {0.01 * OneAtm, OneAtm, 3 * OneAtm, 50 * OneAtm, 150 * OneAtm};
+    size_t nStates = T.size();
+    vector_fp conc(nsp * nStates), wdot(nsp * nStates), ref(nsp * nStates);
+    vector_fp x(nsp), c(nsp), w(nsp);
+    for (size_t m = 0; m < nStates; m++) {
+        for (size_t k = 0; k < nsp; k++) {
+            x[k] = 1.0 + 0.1 * ((k + 3 * m) % 7);
+        }
+        gas->setState_TPX(T[m], P[m], x.data());
+        gas->getConcentrations(c.data());
+        kin->getNetProductionRates(w.data());
+        for (size_t k = 0; k < nsp; k++) {
+            conc[k * nStates + m] = c[k];
+            ref[k * nStates + m] = w[k];
+        }
+    }
+
+    int stateNum = gas->stateMFNumber();
+    kin->getNetProductionRatesBatch(nStates, T.data(), P.data(), conc.data(),
+                                    wdot.data());
+    for (size_t j = 0; j < nsp * nStates; j++) {
+        EXPECT_NEAR(wdot[j], ref[j], 1e-10 * std::abs(ref[j]) + 1e-20) << j;
+    }
+    EXPECT_EQ(gas->stateMFNumber(), stateNum);
+}
+
+TEST(KineticsFromYaml, Profiling)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    vector_fp wdot(kin->nTotalSpecies());
+    gas->setState_TPX(1000, OneAtm, "CH4:1, O2:2, N2:7.52");
+    EXPECT_FALSE(kin->profiling());
+    kin->getNetProductionRates(wdot.data());
+    AnyMap report = kin->profilingReport();
+    EXPECT_EQ(report["updateROP"]["calls"].asInt(), 0);
+
+    kin->setProfiling(true);
+    kin->getNetProductionRates(wdot.data());
+    kin->getNetProductionRates(wdot.data());
+    gas->setState_TP(1100, OneAtm);
+    kin->getNetProductionRates(wdot.data());
+    report = kin->profilingReport();
+    EXPECT_EQ(report["updateROP"]["calls"].asInt(), 3);
+    EXPECT_EQ(report["update_rates_T"]["calls"].asInt(), 3);
+    EXPECT_EQ(report["update_rates_T"]["cache-hits"].asInt(), 2);
+    EXPECT_EQ(report["MultiRate:Arrhenius"]["calls"].asInt(), 3);
+    EXPECT_GT(report["updateROP"]["time"].asDouble(), 0.0);
+    EXPECT_GE(report["updateROP"]["time"].asDouble(),
+              report["update_rates_T"]["time"].asDouble());
+
+    kin->resetProfiling();
+    report = kin->profilingReport();
+    EXPECT_EQ(report["updateROP"]["calls"].asInt(), 0);
+    EXPECT_EQ(report["updateROP"]["time"].asDouble(), 0.0);
+}
+
+TEST(KineticsFromYaml, LargeMechanism)
+{
+    // Mechanism containing several copies of each reaction of GRI 3.0, which
+    // is large enough for the reactions to be created concurrently
+    AnyMap root = AnyMap::fromYamlFile("gri30.yaml");
+    AnyMap phaseNode = root["phases"].getMapWhere("name", "gri30");
+    std::vector<AnyMap> original = root["reactions"].asVector<AnyMap>();
+    size_t nCopies = 8;
+    std::vector<AnyMap> reactions;
+    for (size_t n = 0; n < nCopies; n++) {
+        for (const auto& R : original) {
+            reactions.push_back(R);
+            reactions.back()["duplicate"] = true;
+        }
+    }
+    root["reactions"] = reactions;
+
+    shared_ptr<ThermoPhase> gas(newPhase(phaseNode, root));
+    auto kin = newKinetics({gas.get()}, phaseNode, root);
+    ASSERT_EQ(kin->nReactions(), nCopies * original.size());
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        EXPECT_EQ(kin->reaction(i)->equation(),
+                  kin->reaction(i % original.size())->equation());
+    }
+
+    // An undeclared duplicate among the copies is still detected
+    root["reactions"].asVector<AnyMap>()[5 * original.size() + 40].erase(
+        "duplicate");
+    EXPECT_THROW(newKinetics({gas.get()}, phaseNode, root), CanteraError);
+}
+
+TEST(KineticsFromYaml, FusedStoichiometry)
+{
+    auto compare = [](Kinetics& kin, const std::string& label) {
+        size_t nsp = kin.nTotalSpecies();
+        size_t nr = kin.nReactions();
+        vector_fp wdot(nsp), wdotFused(nsp), ropf(nr), ropfFused(nr),
+            ropr(nr), roprFused(nr);
+        for (double T : {500., 1500.}) {
+            kin.thermo().setState_TP(T, OneAtm);
+            kin.setFusedStoichiometry(false);
+            kin.getNetProductionRates(wdot.data());
+            kin.getFwdRatesOfProgress(ropf.data());
+            kin.getRevRatesOfProgress(ropr.data());
+            kin.setFusedStoichiometry(true);
+            kin.getNetProductionRates(wdotFused.data());
+            kin.getFwdRatesOfProgress(ropfFused.data());
+            kin.getRevRatesOfProgress(roprFused.data());
+            double scale = 0.0;
+            for (size_t i = 0; i < nr; i++) {
+                EXPECT_NEAR(ropfFused[i], ropf[i], 1e-12 * fabs(ropf[i]))
+                    << label << ": " << i;
+                EXPECT_NEAR(roprFused[i], ropr[i], 1e-12 * fabs(ropr[i]))
+                    << label << ": " << i;
+                scale = std::max(scale, fabs(ropf[i]) + fabs(ropr[i]));
+            }
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(wdotFused[k], wdot[k], 1e-12 * scale)
+                    << label << ": " << k;
+            }
+        }
+    };
+
+    // mechanisms with unit, integer, fractional, and non-reactant orders
+    for (const auto& name : {"gri30.yaml", "frac.yaml", "reaction-orders.yaml"}) {
+        auto sol = newSolution(name, "", "None");
+        compare(*sol->kinetics(), name);
+    }
+    auto surf = newInterface("ptcombust.yaml", "Pt_surf");
+    compare(*surf->kinetics(), "ptcombust.yaml");
+}
+
+TEST(KineticsFromYaml, BatchSurfaceRates)
+{
+    auto soln = newInterface("methane_pox_on_pt.yaml", "Pt_surf");
+    auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(soln->kinetics());
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(soln->thermo());
+    // add a reaction with all three types of coverage dependencies
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: H(S) + O(S) => OH(S) + PT(S),"
+        " rate-constant: {A: 3.7e+21, b: 0.5, Ea: 11500},"
+        " coverage-dependencies: {O(S): {a: 0.5, m: -1.0, E: 8000},"
+        "                         H(S): {a: -0.25, m: 0.5, E: -3000}}}");
+    kin->addReaction(newReaction(rxn, *kin));
+    surf->setCoveragesByName("PT(S):0.4, H(S):0.2, O(S):0.15, CO(S):0.1, OH(S):0.05,"
+                       " C(S):0.0, CH3(S):0.1");
+    surf->setState_TP(900, OneAtm);
+
+    size_t nr = kin->nReactions();
+    vector_fp kf(nr), theta(surf->nSpecies());
+    kin->getFwdRateConstants(kf.data());
+    surf->getCoverages(theta.data());
+    double T = surf->temperature();
+    size_t nChecked = 0;
+    for (size_t i = 0; i < nr; i++) {
+        auto R = std::dynamic_pointer_cast<InterfaceReaction>(kin->reaction(i));
+        if (R->is_sticking_coefficient) {
+            continue;
+        }
+        SurfaceArrhenius rate(R->rate.preExponentialFactor(),
+                              R->rate.temperatureExponent(),
+                              R->rate.activationEnergy_R());
+        for (const auto& dep : R->coverage_deps) {
+            rate.addCoverageDependence(surf->speciesIndex(dep.first),
+                                       dep.second.a, dep.second.m, dep.second.E);
+        }
+        rate.update_C(theta.data());
+        double expected = rate.updateRC(std::log(T), 1.0 / T);
+        EXPECT_NEAR(kf[i], expected, 1e-12 * expected) << i;
+        nChecked++;
+    }
+    EXPECT_GT(nChecked, (size_t) 10);
+
+    // changing the coverages only updates the coverage-dependent terms
+    surf->setCoveragesByName("PT(S):0.8, O(S):0.1, H(S):0.1");
+    vector_fp kf2(nr);
+    kin->getFwdRateConstants(kf2.data());
+    surf->getCoverages(theta.data());
+    auto R = std::dynamic_pointer_cast<InterfaceReaction>(kin->reaction(nr - 1));
+    SurfaceArrhenius rate(R->rate.preExponentialFactor(),
+                          R->rate.temperatureExponent(),
+                          R->rate.activationEnergy_R());
+    for (const auto& dep : R->coverage_deps) {
+        rate.addCoverageDependence(surf->speciesIndex(dep.first),
+                                   dep.second.a, dep.second.m, dep.second.E);
+    }
+    rate.update_C(theta.data());
+    double expected = rate.updateRC(std::log(T), 1.0 / T);
+    EXPECT_NEAR(kf2[nr - 1], expected, 1e-12 * expected);
+    double Aeff = R->rate.preExponentialFactor() * pow(10.0, 0.5 * 0.1 - 0.25 * 0.1)
+                  * pow(0.1, -1.0) * pow(0.1, 0.5);
+    EXPECT_NEAR(kin->effectivePreExponentialFactor(nr - 1), Aeff, 1e-12 * Aeff);
+}
+
+TEST(KineticsFromYaml, InterfacePhaseExistence)
+{
+    auto soln = newInterface("methane_pox_on_pt.yaml", "Pt_surf");
+    auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(soln->kinetics());
+    auto surf = soln->thermo();
+    surf->setState_TP(900, OneAtm);
+    size_t nr = kin->nReactions();
+    vector_fp ropf(nr), ropr(nr), ropnet(nr);
+    kin->getFwdRatesOfProgress(ropf.data());
+    kin->getRevRatesOfProgress(ropr.data());
+    size_t igas = kin->phaseIndex("gas");
+
+    // A phase which doesn't exist can neither be consumed nor produced
+    kin->setPhaseExistence(igas, false);
+    EXPECT_FALSE(kin->phaseExistence(igas));
+    EXPECT_FALSE(kin->phaseStability(igas));
+    vector_fp ropf2(nr), ropr2(nr);
+    kin->getFwdRatesOfProgress(ropf2.data());
+    kin->getRevRatesOfProgress(ropr2.data());
+    kin->getNetRatesOfProgress(ropnet.data());
+    size_t nSuppressed = 0;
+    for (size_t i = 0; i < nr; i++) {
+        auto R = kin->reaction(i);
+        bool gasSpecies = false;
+        for (const auto& sp : R->reactants) {
+            gasSpecies |= kin->speciesPhaseIndex(kin->kineticsSpeciesIndex(sp.first)) == igas;
+        }
+        for (const auto& sp : R->products) {
+            gasSpecies |= kin->speciesPhaseIndex(kin->kineticsSpeciesIndex(sp.first)) == igas;
+        }
+        if (gasSpecies && ropf[i] > ropr[i]) {
+            EXPECT_DOUBLE_EQ(ropf2[i], ropr2[i]) << i;
+            EXPECT_DOUBLE_EQ(ropnet[i], 0.0) << i;
+            nSuppressed++;
+        } else if (!gasSpecies) {
+            EXPECT_DOUBLE_EQ(ropf2[i], ropf[i]) << i;
+            EXPECT_DOUBLE_EQ(ropr2[i], ropr[i]) << i;
+        }
+    }
+    EXPECT_GT(nSuppressed, (size_t) 0);
+
+    kin->setPhaseExistence(igas, true);
+    kin->getFwdRatesOfProgress(ropf2.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(ropf2[i], ropf[i]) << i;
+    }
+}
+
+TEST(KineticsFromYaml, EquilibriumConstants_ddT)
+{
+    auto soln = newSolution("h2o2.yaml", "", "None");
+    auto& gas = *soln->thermo();
+    auto& kin = *soln->kinetics();
+    double T = 1200;
+    gas.setState_TPX(T, OneAtm, "H2:0.3, O2:0.2, H2O:0.2, H:0.05, O:0.05, "
+                     "OH:0.05, HO2:0.05, H2O2:0.05");
+    size_t nr = kin.nReactions();
+    vector_fp ropf(nr), ropr(nr), dropf(nr), dropr(nr), Kc1(nr), Kc2(nr);
+    kin.getFwdRatesOfProgress(ropf.data());
+    kin.getRevRatesOfProgress(ropr.data());
+    kin.getFwdRatesOfProgress_ddT(dropf.data());
+    kin.getRevRatesOfProgress_ddT(dropr.data());
+
+    double dT = 1e-4 * T;
+    gas.setState_TP(T - dT, OneAtm);
+    kin.getEquilibriumConstants(Kc1.data());
+    gas.setState_TP(T + dT, OneAtm);
+    kin.getEquilibriumConstants(Kc2.data());
+    for (size_t i = 0; i < nr; i++) {
+        if (ropr[i] == 0) {
+            continue;
+        }
+        // derivative of the logarithm of the inverse equilibrium constant
+        double dlnrkc = dropr[i] / ropr[i] - dropf[i] / ropf[i];
+        double expected = - (log(Kc2[i]) - log(Kc1[i])) / (2 * dT);
+        EXPECT_NEAR(dlnrkc, expected, 1e-7 * std::abs(expected) + 1e-12) << i;
+    }
+}
+
 class ReactionToYaml : public testing::Test
 {
 public:
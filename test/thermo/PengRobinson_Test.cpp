@@ -382,6 +382,59 @@ TEST_F(PengRobinson_Test, partialMolarPropertyIdentities)
     }
 }
 
+TEST_F(PengRobinson_Test, setBinaryCoeffs)
+{
+    // Changing the coefficients should take effect at the next state update,
+    // even if the temperature and composition are unchanged
+    test_phase->setState_TPX(350, 50 * OneAtm, "CO2: 0.6, H2O: 0.1, H2: 0.3");
+    double rho0 = test_phase->density();
+    dynamic_cast<PengRobinson&>(*test_phase).setBinaryCoeffs("CO2", "H2O", 3e5);
+    test_phase->setState_TP(350, 50 * OneAtm);
+    EXPECT_GT(std::abs(test_phase->density() - rho0), 1e-4 * rho0);
+
+    unique_ptr<ThermoPhase> ref(newPhase("../data/thermo-models.yaml", "CO2-PR"));
+    dynamic_cast<PengRobinson&>(*ref).setBinaryCoeffs("CO2", "H2O", 3e5);
+    ref->setState_TPX(350, 50 * OneAtm, "CO2: 0.6, H2O: 0.1, H2: 0.3");
+    EXPECT_NEAR(test_phase->density(), ref->density(), 1e-12 * ref->density());
+    EXPECT_NEAR(test_phase->enthalpy_mole(), ref->enthalpy_mole(),
+                1e-12 * std::abs(ref->enthalpy_mole()));
+    EXPECT_NEAR(test_phase->cp_mole(), ref->cp_mole(), 1e-12 * ref->cp_mole());
+}
+
+TEST_F(PengRobinson_Test, getPropertiesBatch)
+{
+    size_t nsp = test_phase->nSpecies();
+    size_t nStates = 12;
+    vector_fp T(nStates), P(nStates), Y(nsp * nStates);
+    for (size_t m = 0; m < nStates; m++) {
+        T[m] = 320 + 25 * m;
+        P[m] = OneAtm * (10 + 15 * (m % 4));
+        Y[m] = 0.5 + 0.04 * m; // CO2
+        Y[nStates + m] = 0.05; // H2O
+        Y[2 * nStates + m] = 0.1 / (m + 1); // H2
+    }
+
+    vector_fp h(nStates), cp(nStates), rho(nStates), mw(nStates);
+    test_phase->setState_TPX(400, OneAtm, "H2: 1.0");
+    test_phase->getPropertiesBatch(nStates, T.data(), P.data(), Y.data(),
+                                   h.data(), cp.data(), rho.data(), mw.data());
+    EXPECT_DOUBLE_EQ(test_phase->temperature(), 400);
+    EXPECT_DOUBLE_EQ(test_phase->moleFraction("H2"), 1.0);
+
+    vector_fp y(nsp);
+    for (size_t m = 0; m < nStates; m++) {
+        for (size_t k = 0; k < nsp; k++) {
+            y[k] = Y[k * nStates + m];
+        }
+        test_phase->setState_TPY(T[m], P[m], y.data());
+        EXPECT_NEAR(h[m], test_phase->enthalpy_mass(),
+                    1e-10 * std::abs(test_phase->enthalpy_mass()));
+        EXPECT_NEAR(cp[m], test_phase->cp_mass(), 1e-10 * test_phase->cp_mass());
+        EXPECT_NEAR(rho[m], test_phase->density(), 1e-10 * test_phase->density());
+        EXPECT_DOUBLE_EQ(mw[m], test_phase->meanMolecularWeight());
+    }
+}
+
 TEST(PengRobinson, lookupSpeciesProperties)
 {
     AnyMap phase_def = AnyMap::fromYamlString(
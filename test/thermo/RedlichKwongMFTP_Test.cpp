@@ -167,6 +167,38 @@ TEST_F(RedlichKwongMFTP_Test, setTP)
     }
 }
 
+TEST_F(RedlichKwongMFTP_Test, getPropertiesBatch)
+{
+    // Supercritical CO2-H2 mixtures, including states that differ only in
+    // temperature or only in composition
+    size_t nsp = test_phase->nSpecies();
+    size_t nStates = 10;
+    vector_fp T(nStates), P(nStates), Y(nsp * nStates, 0.0);
+    for (size_t m = 0; m < nStates; m++) {
+        T[m] = 310 + 20 * (m / 2);
+        P[m] = 9236712.5 - 1e6 * (m % 3);
+        Y[m] = 0.9 + 0.01 * (m % 2); // CO2
+        Y[2 * nStates + m] = 0.002 * (m + 1); // H2
+    }
+
+    vector_fp h(nStates), cp(nStates), rho(nStates), mw(nStates);
+    test_phase->getPropertiesBatch(nStates, T.data(), P.data(), Y.data(),
+                                   h.data(), cp.data(), rho.data(), mw.data());
+
+    vector_fp y(nsp);
+    for (size_t m = 0; m < nStates; m++) {
+        for (size_t k = 0; k < nsp; k++) {
+            y[k] = Y[k * nStates + m];
+        }
+        test_phase->setState_TPY(T[m], P[m], y.data());
+        EXPECT_NEAR(h[m], test_phase->enthalpy_mass(),
+                    1e-10 * std::abs(test_phase->enthalpy_mass()));
+        EXPECT_NEAR(cp[m], test_phase->cp_mass(), 1e-10 * test_phase->cp_mass());
+        EXPECT_NEAR(rho[m], test_phase->density(), 1e-10 * test_phase->density());
+        EXPECT_DOUBLE_EQ(mw[m], test_phase->meanMolecularWeight());
+    }
+}
+
 TEST_F(RedlichKwongMFTP_Test, critPropLookup)
 {
     // Check to make sure that RedlichKwongMFTP is able to properly calculate a and b
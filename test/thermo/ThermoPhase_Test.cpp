@@ -58,6 +58,206 @@ TEST_F(TestThermoMethods, setState_nan)
     EXPECT_THROW(thermo->setState_TR(555, nan), CanteraError);
 }
 
+TEST_F(TestThermoMethods, saveState_restoreState)
+{
+    thermo->setState_TPY(500, 2 * OneAtm, "H2:0.1, O2:0.4, AR:0.5");
+    vector_fp state;
+    thermo->saveState(state);
+    ASSERT_EQ(state.size(), thermo->stateSize());
+
+    // restoring an unchanged composition keeps the state counter
+    int num = thermo->stateMFNumber();
+    thermo->setState_TP(800, OneAtm);
+    thermo->restoreState(state);
+    EXPECT_EQ(thermo->stateMFNumber(), num);
+    EXPECT_DOUBLE_EQ(thermo->temperature(), 500);
+    EXPECT_DOUBLE_EQ(thermo->pressure(), 2 * OneAtm);
+
+    // changing the composition increments the state counter
+    thermo->setMassFractionsByName("H2:1.0");
+    num = thermo->stateMFNumber();
+    thermo->restoreState(state);
+    EXPECT_GT(thermo->stateMFNumber(), num);
+    EXPECT_DOUBLE_EQ(thermo->massFraction("O2"), 0.4);
+    EXPECT_DOUBLE_EQ(thermo->temperature(), 500);
+    EXPECT_DOUBLE_EQ(thermo->pressure(), 2 * OneAtm);
+}
+
+TEST(ThermoPhase, restoreState_nativeMoleFractions)
+{
+    // LatticePhase uses mole fractions as native state variables
+    auto sol = newSolution("sofc.yaml", "oxide_bulk", "None");
+    auto& phase = *sol->thermo();
+    phase.setState_TPX(1000, OneAtm, "Ox:0.9, VO**:0.1");
+    vector_fp state;
+    phase.saveState(state);
+    int num = phase.stateMFNumber();
+    phase.restoreState(state);
+    EXPECT_EQ(phase.stateMFNumber(), num);
+
+    phase.setState_TPX(900, OneAtm, "Ox:0.5, VO**:0.5");
+    phase.restoreState(state);
+    EXPECT_DOUBLE_EQ(phase.temperature(), 1000);
+    EXPECT_DOUBLE_EQ(phase.moleFraction("Ox"), 0.9);
+}
+
+TEST_F(TestThermoMethods, standardProperties_ddT)
+{
+    size_t nsp = thermo->nSpecies();
+    vector_fp dcp(nsp), dh(nsp), ds(nsp), dg(nsp);
+    vector_fp cp1(nsp), h1(nsp), s1(nsp), g1(nsp);
+    vector_fp cp2(nsp), h2(nsp), s2(nsp), g2(nsp);
+    for (double T : {500.0, 1500.0, 3000.0}) {
+        double dT = 1e-4 * T;
+        thermo->setState_TPX(T - dT, OneAtm, "O2:0.2, H2:0.3, AR:0.5");
+        thermo->getCp_R(cp1.data());
+        thermo->getEnthalpy_RT(h1.data());
+        thermo->getEntropy_R(s1.data());
+        thermo->getGibbs_RT(g1.data());
+        thermo->setState_TP(T + dT, OneAtm);
+        thermo->getCp_R(cp2.data());
+        thermo->getEnthalpy_RT(h2.data());
+        thermo->getEntropy_R(s2.data());
+        thermo->getGibbs_RT(g2.data());
+        thermo->setState_TP(T, OneAtm);
+        thermo->getCp_R_ddT(dcp.data());
+        thermo->getEnthalpy_RT_ddT(dh.data());
+        thermo->getEntropy_R_ddT(ds.data());
+        thermo->getGibbs_RT_ddT(dg.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(dcp[k], (cp2[k] - cp1[k]) / (2 * dT),
+                        1e-7 * std::abs(dcp[k]) + 1e-10) << k << " " << T;
+            EXPECT_NEAR(dh[k], (h2[k] - h1[k]) / (2 * dT),
+                        1e-7 * std::abs(dh[k]) + 1e-10) << k << " " << T;
+            EXPECT_NEAR(ds[k], (s2[k] - s1[k]) / (2 * dT),
+                        1e-7 * std::abs(ds[k]) + 1e-10) << k << " " << T;
+            EXPECT_NEAR(dg[k], (g2[k] - g1[k]) / (2 * dT),
+                        1e-7 * std::abs(dg[k]) + 1e-10) << k << " " << T;
+        }
+    }
+}
+
+TEST_F(TestThermoMethods, getPropertiesBatch)
+{
+    size_t nsp = thermo->nSpecies();
+    size_t nStates = 5000;
+    vector_fp T(nStates), P(nStates), Y(nsp * nStates);
+    for (size_t m = 0; m < nStates; m++) {
+        T[m] = 300 + 2500.0 * m / nStates;
+        P[m] = OneAtm * (1 + m % 7);
+        for (size_t k = 0; k < nsp; k++) {
+            Y[k * nStates + m] = 1.0 + (m * (k + 3)) % 11;
+        }
+    }
+    Y[nStates + 1] = -0.1; // negative mass fractions are ignored
+
+    thermo->setState_TPX(500, OneAtm, "O2:0.2, H2:0.3, AR:0.5");
+    vector_fp h1(nStates), cp1(nStates), rho1(nStates), mw1(nStates);
+    thermo->ThermoPhase::getPropertiesBatch(nStates, T.data(), P.data(), Y.data(),
+        h1.data(), cp1.data(), rho1.data(), mw1.data());
+    EXPECT_DOUBLE_EQ(thermo->temperature(), 500);
+    EXPECT_DOUBLE_EQ(thermo->moleFraction("AR"), 0.5);
+
+    int stateNum = thermo->stateMFNumber();
+    vector_fp h2(nStates), cp2(nStates), rho2(nStates), mw2(nStates);
+    for (size_t nThreads : {1, 4}) {
+        thermo->setBatchThreads(nThreads);
+        thermo->getPropertiesBatch(nStates, T.data(), P.data(), Y.data(),
+            h2.data(), cp2.data(), rho2.data(), mw2.data());
+        for (size_t m = 0; m < nStates; m++) {
+            EXPECT_NEAR(h2[m], h1[m], 1e-12 * std::abs(h1[m]) + 1e-6) << m;
+            EXPECT_NEAR(cp2[m], cp1[m], 1e-12 * cp1[m]) << m;
+            EXPECT_NEAR(rho2[m], rho1[m], 1e-12 * rho1[m]) << m;
+            EXPECT_NEAR(mw2[m], mw1[m], 1e-12 * mw1[m]) << m;
+        }
+    }
+    // the state of the phase is not used or modified
+    EXPECT_EQ(thermo->stateMFNumber(), stateNum);
+
+    // unneeded outputs may be skipped
+    thermo->getPropertiesBatch(nStates, T.data(), P.data(), Y.data(),
+                               nullptr, nullptr, rho2.data(), nullptr);
+    EXPECT_NEAR(rho2[10], rho1[10], 1e-12 * rho1[10]);
+}
+
+TEST_F(TestThermoMethods, setState_HP_UV_SP_SV)
+{
+    for (double T0 : {250.0, 999.0, 1234.5, 3456.7}) {
+        thermo->setState_TPX(T0, 3 * OneAtm, "O2:0.2, H2:0.3, H2O:0.1, AR:0.4");
+        double h = thermo->enthalpy_mass();
+        double u = thermo->intEnergy_mass();
+        double s = thermo->entropy_mass();
+        double v = 1.0 / thermo->density();
+        double p = thermo->pressure();
+        for (double T1 : {300.0, 1500.0, 4000.0}) {
+            thermo->setState_TP(T1, OneAtm);
+            thermo->setState_HP(h, p);
+            EXPECT_NEAR(thermo->temperature(), T0, 1e-12 * T0);
+            EXPECT_NEAR(thermo->pressure(), p, 1e-12 * p);
+
+            thermo->setState_TP(T1, OneAtm);
+            thermo->setState_UV(u, v);
+            EXPECT_NEAR(thermo->temperature(), T0, 1e-12 * T0);
+            EXPECT_NEAR(thermo->density(), 1.0 / v, 1e-12 / v);
+
+            thermo->setState_TP(T1, OneAtm);
+            thermo->setState_SP(s, p);
+            EXPECT_NEAR(thermo->temperature(), T0, 1e-12 * T0);
+
+            thermo->setState_TP(T1, OneAtm);
+            thermo->setState_SV(s, v);
+            EXPECT_NEAR(thermo->temperature(), T0, 1e-12 * T0);
+            EXPECT_NEAR(thermo->pressure(), p, 1e-11 * p);
+        }
+    }
+    EXPECT_DOUBLE_EQ(thermo->moleFraction("AR"), 0.4);
+}
+
+TEST_F(TestThermoMethods, solveTemperatureBatch_HP)
+{
+    size_t nsp = thermo->nSpecies();
+    size_t nStates = 3000;
+    vector_fp T(nStates), P(nStates), Y(nsp * nStates), h(nStates);
+    for (size_t m = 0; m < nStates; m++) {
+        T[m] = 300 + 2500.0 * (m + 0.5) / nStates;
+        P[m] = OneAtm * (1 + m % 7);
+        for (size_t k = 0; k < nsp; k++) {
+            Y[k * nStates + m] = (m * (k + 3) + 1) % 11;
+        }
+    }
+    thermo->getPropertiesBatch(nStates, T.data(), P.data(), Y.data(),
+                               h.data(), nullptr, nullptr, nullptr);
+
+    thermo->setState_TPX(500, OneAtm, "O2:0.2, H2:0.3, AR:0.5");
+    int stateNum = thermo->stateMFNumber();
+    for (size_t nThreads : {1, 3}) {
+        thermo->setBatchThreads(nThreads);
+        vector_fp T2(nStates);
+        for (size_t m = 0; m < nStates; m++) {
+            // initial estimates as from a previous time step
+            T2[m] = T[m] + ((m % 2) ? 50.0 : -120.0);
+        }
+        thermo->solveTemperatureBatch_HP(nStates, h.data(), P.data(), Y.data(),
+                                         T2.data());
+        for (size_t m = 0; m < nStates; m++) {
+            EXPECT_NEAR(T2[m], T[m], 1e-12 * T[m]) << m;
+        }
+    }
+    EXPECT_EQ(thermo->stateMFNumber(), stateNum);
+
+    // compare with the general implementation, which does not use the
+    // specialized solver of IdealGasPhase
+    vector_fp y(nsp);
+    for (size_t m = 0; m < 10; m++) {
+        for (size_t k = 0; k < nsp; k++) {
+            y[k] = Y[k * nStates + m];
+        }
+        thermo->setState_TPY(1000.0, P[m], y.data());
+        thermo->ThermoPhase::setState_HP(h[m], P[m], 1e-14);
+        EXPECT_NEAR(thermo->temperature(), T[m], 1e-9 * T[m]) << m;
+    }
+}
+
 TEST_F(TestThermoMethods, setState_AnyMap)
 {
     AnyMap state;
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/speciesThermoTypes.h"
 #include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/MultiSpeciesThermo.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/ConstCpPoly.h"
@@ -206,6 +207,101 @@ TEST(SpeciesThermo, Nasa9PolyFromYaml) {
     EXPECT_DOUBLE_EQ(s_R, 30.31743870437559);
 }
 
+// Parameterizations which are handled by PolyThermoBatchEvaluator, and one
+// which is not
+std::vector<std::string> polyThermoInputs = {
+    // NASA7, two regions
+    "{model: NASA7, temperature-ranges: [200, 1000, 6000], data:"
+    " [[3.944031200E+00, -1.585429000E-03, 1.665781200E-05, -2.047542600E-08,"
+    " 7.835056400E-12, 2.896617900E+03, 6.311991700E+00],"
+    " [4.884754200E+00, 2.172395600E-03, -8.280690600E-07, 1.574751000E-10,"
+    " -1.051089500E-14, 2.316498300E+03, -1.174169500E-01]]}",
+    // Shomate, two regions
+    "{model: Shomate, temperature-ranges: [298, 1300, 6000], data:"
+    " [[25.56759, 6.096130, 4.054656, -2.671301, 0.131021, -118.0089, 227.3665],"
+    " [35.15070, 1.300095, -0.205921, 0.013550, -3.282780, -127.8375, 231.7120]]}",
+    // NASA9, three regions
+    "{model: NASA9, temperature-ranges: [200.00, 1000.00, 6000.0, 20000], data:"
+    " [[2.210371497E+04, -3.818461820E+02, 6.082738360E+00, -8.530914410E-03,"
+    " 1.384646189E-05, -9.625793620E-09, 2.519705809E-12, 7.108460860E+02,"
+    " -1.076003744E+01],"
+    " [5.877124060E+05, -2.239249073E+03, 6.066949220E+00, -6.139685500E-04,"
+    " 1.491806679E-07,  -1.923105485E-11, 1.061954386E-15, 1.283210415E+04,"
+    " -1.586640027E+01],"
+    " [8.310139160E+08, -6.420733540E+05, 2.020264635E+02, -3.065092046E-02,"
+    " 2.486903333E-06, -9.705954110E-11, 1.437538881E-15, 4.938707040E+06,"
+    " -1.672099740E+03]]}",
+    // NASA9, one region
+    "{model: NASA9, temperature-ranges: [200.00, 1000.00], data:"
+    " [[2.210371497E+04, -3.818461820E+02, 6.082738360E+00, -8.530914410E-03,"
+    " 1.384646189E-05, -9.625793620E-09, 2.519705809E-12, 7.108460860E+02,"
+    " -1.076003744E+01]]}",
+    // Not handled by the packed evaluator
+    "{model: constant-cp, T0: 1000 K, h0: 9.22 kcal/mol,"
+    " s0: -3.02 cal/mol/K, cp0: 5.95 cal/mol/K}"
+};
+
+TEST(SpeciesThermo, PackedPolynomials) {
+    const auto& inputs = polyThermoInputs;
+    MultiSpeciesThermo spthermo;
+    for (size_t k = 0; k < inputs.size(); k++) {
+        spthermo.install_STIT(k, newSpeciesThermo(AnyMap::fromYamlString(inputs[k])));
+    }
+    size_t nsp = inputs.size();
+    vector_fp cp(nsp), h(nsp), s(nsp);
+    for (double T : {300.0, 999.0, 1000.0, 1001.0, 1300.0, 1500.0, 6000.0, 8000.0}) {
+        spthermo.update(T, cp.data(), h.data(), s.data());
+        for (size_t k = 0; k < nsp; k++) {
+            double cp1, h1, s1;
+            spthermo.update_single(k, T, &cp1, &h1, &s1);
+            EXPECT_NEAR(cp[k], cp1, 1e-13 * std::abs(cp1)) << k << " " << T;
+            EXPECT_NEAR(h[k], h1, 1e-12 * std::abs(h1)) << k << " " << T;
+            EXPECT_NEAR(s[k], s1, 1e-13 * std::abs(s1)) << k << " " << T;
+        }
+    }
+
+    // Modified heats of formation are used by the packed evaluator
+    for (size_t k = 0; k < 2; k++) {
+        spthermo.modifyOneHf298(k, -1e8);
+    }
+    spthermo.update(298.15, cp.data(), h.data(), s.data());
+    for (size_t k = 0; k < 2; k++) {
+        EXPECT_NEAR(h[k] * GasConstant * 298.15, -1e8, 1e-5) << k;
+    }
+    spthermo.resetHf298(0);
+    spthermo.update(300, cp.data(), h.data(), s.data());
+    EXPECT_DOUBLE_EQ(h[0], 13.735827875868003);
+}
+
+TEST(SpeciesThermo, PropertiesTemp_ddT) {
+    const auto& inputs = polyThermoInputs;
+    MultiSpeciesThermo spthermo;
+    std::vector<shared_ptr<SpeciesThermoInterpType>> stit;
+    for (size_t k = 0; k < inputs.size(); k++) {
+        stit.push_back(newSpeciesThermo(AnyMap::fromYamlString(inputs[k])));
+        spthermo.install_STIT(k, stit.back());
+    }
+    size_t nsp = inputs.size();
+    vector_fp cp(nsp), h(nsp), s(nsp), dcp(nsp);
+    for (double T : {300.0, 999.0, 1500.0, 8000.0}) {
+        spthermo.update_ddT(T, cp.data(), h.data(), s.data(), dcp.data());
+        double dT = 1e-4 * T;
+        for (size_t k = 0; k < nsp; k++) {
+            double cp1, h1, s1, cp2, h2, s2, dcp3;
+            spthermo.update_single(k, T, &cp1, &h1, &s1);
+            EXPECT_NEAR(cp[k], cp1, 1e-13 * std::abs(cp1)) << k << " " << T;
+            EXPECT_NEAR(h[k], h1, 1e-12 * std::abs(h1)) << k << " " << T;
+            EXPECT_NEAR(s[k], s1, 1e-13 * std::abs(s1)) << k << " " << T;
+            spthermo.update_single(k, T - dT, &cp1, &h1, &s1);
+            spthermo.update_single(k, T + dT, &cp2, &h2, &s2);
+            EXPECT_NEAR(dcp[k], (cp2 - cp1) / (2 * dT), 1e-7 * std::abs(dcp[k]) + 1e-10)
+                << k << " " << T;
+            stit[k]->updatePropertiesTemp_ddT(T, &cp1, &h1, &s1, &dcp3);
+            EXPECT_NEAR(dcp3, dcp[k], 1e-12) << k << " " << T;
+        }
+    }
+}
+
 TEST(SpeciesThermo, ConstCpPolyFromYaml) {
     AnyMap data = AnyMap::fromYamlString(
         "model: constant-cp # was 'const_cp'\n"
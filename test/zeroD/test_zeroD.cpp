@@ -4,6 +4,7 @@
 #include "cantera/thermo.h"
 #include "cantera/kinetics.h"
 #include "cantera/zerodim.h"
+#include "cantera/base/Array.h"
 
 using namespace Cantera;
 
@@ -50,6 +51,667 @@ TEST(ZeroDim, test_individual_reactor_initialization)
     }
 }
 
+// Compare the analytic Jacobian of the reactor governing equations with
+// central finite differences of the right-hand side. Terms which are neglected
+// by the analytic Jacobian to preserve its sparsity can be given as
+// *neglected*, which is added to the analytic Jacobian before the comparison.
+void checkJacobian(ReactorNet& net, size_t iT,
+                   const Eigen::MatrixXd& neglected=Eigen::MatrixXd())
+{
+    net.initialize();
+    size_t nv = net.neq();
+    vector_fp y(nv), ydot_p(nv), ydot_m(nv);
+    net.getState(y.data());
+    Eigen::SparseMatrix<double> jac;
+    net.evalSparseJacobian(0.0, y.data(), jac);
+    ASSERT_EQ(jac.rows(), static_cast<int>(nv));
+    Eigen::MatrixXd analytic = jac;
+    if (neglected.size()) {
+        analytic += neglected;
+    }
+
+    // species columns, followed by the temperature column
+    for (size_t j = iT; j < nv; j++) {
+        double ysave = y[j];
+        double dy = 1e-6 * std::max(std::abs(ysave), 1e-2);
+        y[j] = ysave + dy;
+        net.eval(0.0, y.data(), ydot_p.data(), nullptr);
+        y[j] = ysave - dy;
+        net.eval(0.0, y.data(), ydot_m.data(), nullptr);
+        y[j] = ysave;
+        for (size_t i = iT; i < nv; i++) {
+            double fd = (ydot_p[i] - ydot_m[i]) / (2 * dy);
+            double scale = std::max(std::abs(fd), std::abs(analytic(i, j)));
+            // the temperature dependence of the heat capacity is neglected
+            double rtol = (i == iT && j == iT) ? 0.05 : 1e-3;
+            EXPECT_NEAR(analytic(i, j), fd, rtol * scale + 1e-8)
+                << "row " << net.componentName(i)
+                << ", column " << net.componentName(j);
+        }
+    }
+}
+
+TEST(ZeroDim, IdealGasReactor_jacobian)
+{
+    auto sol = newSolution("h2o2.yaml");
+    sol->thermo()->setState_TPX(1200.0, OneAtm,
+        "H2:1.0, O2:0.5, H:0.01, O:0.01, OH:0.02, HO2:1e-4, H2O:0.1, AR:8.0");
+    IdealGasReactor reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    checkJacobian(net, 2);
+}
+
+TEST(ZeroDim, IdealGasConstPressureReactor_jacobian)
+{
+    auto sol = newSolution("h2o2.yaml");
+    auto& gas = *sol->thermo();
+    auto& kin = *sol->kinetics();
+    gas.setState_TPX(1200.0, OneAtm,
+        "H2:1.0, O2:0.5, H:0.01, O:0.01, OH:0.02, HO2:1e-4, H2O:0.1, AR:8.0");
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    net.initialize();
+
+    // The species rows of the analytic Jacobian neglect the dependence of the
+    // density on composition. At constant T and P, perturbing Y_j changes
+    // 1/rho by 1/(ctot W_j) and all concentrations C_i by -C_i W_mix / W_j,
+    // giving a contribution of W_k / W_j * (wdot_k / ctot - dwdot_k/dC) to
+    // d(dY_k/dt)/dY_j, where dwdot_k/dC is evaluated at constant mole
+    // fractions.
+    size_t nsp = gas.nSpecies();
+    vector_fp wdot(nsp), dwdot_dC(nsp);
+    kin.getNetProductionRates(wdot.data());
+    kin.getNetProductionRates_ddC(dwdot_dC.data());
+    double ctot = gas.molarDensity();
+    const vector_fp& mw = gas.molecularWeights();
+    Eigen::MatrixXd neglected = Eigen::MatrixXd::Zero(net.neq(), net.neq());
+    for (size_t k = 0; k < nsp; k++) {
+        for (size_t j = 0; j < nsp; j++) {
+            neglected(2 + k, 2 + j) = mw[k] / mw[j]
+                * (wdot[k] / ctot - dwdot_dC[k]);
+        }
+    }
+    checkJacobian(net, 1, neglected);
+}
+
+TEST(ZeroDim, linear_solvers)
+{
+    double T0 = 1000.0;
+    double P0 = OneAtm;
+    std::string X0 = "CH4:1.0, O2:2.0, N2:7.52";
+    vector_fp states[3];
+    int n = 0;
+    for (auto solver : {"DENSE", "SPARSE", "GMRES"}) {
+        auto sol = newSolution("gri30.yaml");
+        sol->thermo()->setState_TPX(T0, P0, X0);
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setLinearSolverType(solver);
+        EXPECT_EQ(net.linearSolverType(), solver);
+        net.setTolerances(1e-8, 1e-15);
+        net.advance(1.0);
+        states[n].resize(reactor.neq());
+        reactor.getState(states[n].data());
+        n++;
+    }
+    EXPECT_GT(states[0][1], 2000.0); // ignition occurred
+    for (n = 1; n < 3; n++) {
+        for (size_t i = 0; i < states[0].size(); i++) {
+            EXPECT_NEAR(states[0][i], states[n][i],
+                        1e-5 * std::abs(states[0][i]) + 1e-10);
+        }
+    }
+    ReactorNet net;
+    EXPECT_THROW(net.setLinearSolverType("spam"), CanteraError);
+
+    // reactor types without an analytic Jacobian are rejected
+    auto sol = newSolution("h2o2.yaml");
+    Reactor reactor;
+    reactor.insert(sol);
+    net.addReactor(reactor);
+    net.setLinearSolverType("SPARSE");
+    EXPECT_THROW(net.initialize(), CanteraError);
+    net.setLinearSolverType("DENSE");
+    net.initialize();
+}
+
+TEST(ZeroDim, integrator_types)
+{
+    double T0 = 1200.0;
+    double P0 = OneAtm;
+    std::string X0 = "H2:2.0, O2:1.0, AR:4.0";
+    std::vector<std::pair<std::string, std::string>> cases = {
+        {"CVODE", "DENSE"}, {"ROS4", "DENSE"}, {"RODAS3", "DENSE"},
+        {"RKC", "DENSE"}, {"ROS4", "SPARSE"}};
+    vector_fp states[5];
+    int n = 0;
+    for (const auto& c : cases) {
+        auto sol = newSolution("h2o2.yaml");
+        sol->thermo()->setState_TPX(T0, P0, X0);
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setIntegratorType(c.first);
+        net.setLinearSolverType(c.second);
+        EXPECT_EQ(net.integratorType(), c.first);
+        if (c.second == "SPARSE") {
+            // Reactor::jacobian() is approximate, which limits the accuracy
+            // achieved efficiently by Rosenbrock methods
+            net.setTolerances(1e-7, 1e-13);
+        } else {
+            net.setTolerances(1e-9, 1e-15);
+        }
+        net.advance(1e-4);
+        // individual steps may pass the final time, which then requires
+        // interpolation
+        net.step();
+        net.advance(2e-4);
+        states[n].resize(reactor.neq());
+        reactor.getState(states[n].data());
+        n++;
+    }
+    EXPECT_GT(states[0][1], 2500.0); // ignition occurred
+    for (n = 1; n < 5; n++) {
+        for (size_t i = 0; i < states[0].size(); i++) {
+            EXPECT_NEAR(states[0][i], states[n][i],
+                        1e-4 * std::abs(states[0][i]) + 1e-9) << cases[n].first;
+        }
+    }
+    ReactorNet net;
+    EXPECT_THROW(net.setIntegratorType("spam"), CanteraError);
+    net.setLinearSolverType("GMRES");
+    EXPECT_THROW(net.setIntegratorType("ROS4"), CanteraError);
+    EXPECT_EQ(net.integratorType(), "CVODE");
+}
+
+TEST(ZeroDim, events_and_outputs)
+{
+    double T0 = 1200.0;
+    double P0 = OneAtm;
+    std::string X0 = "H2:2.0, O2:1.0, AR:4.0";
+    vector_fp times = {1e-5, 2e-5, 5e-5, 1e-4, 2e-4};
+    for (std::string integrator : {"CVODE", "ROS4"}) {
+        auto sol = newSolution("h2o2.yaml");
+        sol->thermo()->setState_TPX(T0, P0, X0);
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setIntegratorType(integrator);
+        size_t iT = net.addEvent(reactor, "temperature", "threshold", 1500.0,
+                                 true);
+        size_t iRate = net.addEvent(reactor, "temperature", "max-rate", 1e4);
+        size_t iPeak = net.addEvent(reactor, "HO2", "peak", 1e-6);
+        EXPECT_THROW(net.addEvent(reactor, "temperature", "spam"), CanteraError);
+        net.setOutputTimes(times);
+        size_t ncalls = 0;
+        net.setOutputCallback([&](double t, const double* y) {
+            EXPECT_DOUBLE_EQ(t, times[ncalls]);
+            ncalls++;
+        });
+
+        // integration stops at the terminal event
+        net.advance(1.0);
+        double tIgn = net.time();
+        EXPECT_LT(tIgn, 1e-4) << integrator;
+        EXPECT_NEAR(sol->thermo()->temperature(), 1500.0, 1e-6) << integrator;
+        EXPECT_EQ(net.lastEvent(), iT);
+        ASSERT_EQ(net.eventTimes(iT).size(), 1u);
+        EXPECT_DOUBLE_EQ(net.eventTimes(iT)[0], tIgn);
+        EXPECT_EQ(net.nOutputs(), ncalls);
+
+        net.advance(2e-4);
+        EXPECT_DOUBLE_EQ(net.time(), 2e-4);
+        EXPECT_GT(sol->thermo()->temperature(), 2500.0);
+        EXPECT_EQ(net.eventTimes(iT).size(), 1u);
+        ASSERT_EQ(net.eventTimes(iRate).size(), 1u) << integrator;
+        ASSERT_EQ(net.eventTimes(iPeak).size(), 1u) << integrator;
+        EXPECT_EQ(net.nOutputs(), times.size());
+        EXPECT_EQ(ncalls, times.size());
+
+        // The temperature rate is maximal near the threshold temperature, and
+        // HO2 peaks before the thermal runaway
+        double tRate = net.eventTimes(iRate)[0];
+        EXPECT_NEAR(tRate, tIgn, 0.05 * tIgn);
+        EXPECT_LT(net.eventTimes(iPeak)[0], tRate);
+        Array2D states = net.outputStates();
+
+        // Compare with the maximum rate determined from finely spaced outputs,
+        // and with the states at the output times from separate integrations
+        sol->thermo()->setState_TPX(T0, P0, X0);
+        reactor.setInitialVolume(1.0);
+        reactor.syncState();
+        net.setInitialTime(0.0);
+        EXPECT_EQ(net.nOutputs(), 0u);
+        EXPECT_EQ(net.eventTimes(iRate).size(), 0u);
+        net.clearEvents();
+        EXPECT_EQ(net.nEvents(), 0u);
+        vector_fp fine(1001);
+        for (size_t j = 0; j < fine.size(); j++) {
+            fine[j] = tIgn * (0.9 + 0.2 * j / (fine.size() - 1.0));
+        }
+        net.setOutputTimes(fine);
+        ncalls = 0;
+        net.setOutputCallback(nullptr);
+        net.advance(2e-4);
+        ASSERT_EQ(net.nOutputs(), fine.size());
+        size_t iT0 = reactor.componentIndex("temperature");
+        size_t jmax = 0;
+        double rateMax = 0.0;
+        for (size_t j = 0; j + 1 < fine.size(); j++) {
+            const Array2D& out = net.outputStates();
+            double rate = (out(iT0, j+1) - out(iT0, j)) / (fine[j+1] - fine[j]);
+            if (rate > rateMax) {
+                rateMax = rate;
+                jmax = j;
+            }
+        }
+        EXPECT_NEAR(tRate, 0.5 * (fine[jmax] + fine[jmax+1]),
+                    2 * (fine[1] - fine[0])) << integrator;
+
+        for (size_t j = 0; j < times.size(); j++) {
+            sol->thermo()->setState_TPX(T0, P0, X0);
+            reactor.setInitialVolume(1.0);
+            reactor.syncState();
+            net.setInitialTime(0.0);
+            net.setOutputTimes({});
+            net.advance(times[j]);
+            vector_fp y(reactor.neq());
+            reactor.getState(y.data());
+            for (size_t k = 0; k < reactor.neq(); k++) {
+                EXPECT_NEAR(states(k, j), y[k], 1e-5 * std::abs(y[k]) + 1e-12)
+                    << integrator << ", t = " << times[j];
+            }
+        }
+    }
+}
+
+TEST(ZeroDim, adaptive_chemistry)
+{
+    double T0 = 1200.0;
+    double P0 = OneAtm;
+    std::string X0 = "CH4:1.0, O2:2.0, N2:7.52";
+    double tIgn[2];
+    vector_fp states[2];
+    for (int n = 0; n < 2; n++) {
+        auto sol = newSolution("gri30.yaml", "gri30", "None");
+        sol->thermo()->setState_TPX(T0, P0, X0);
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setTolerances(1e-8, 1e-15);
+        if (n == 1) {
+            // target species are required
+            AnyMap settings = AnyMap::fromYamlString("{interval: 5}");
+            EXPECT_THROW(net.setAdaptiveChemistry(settings), CanteraError);
+            settings = AnyMap::fromYamlString(
+                "{targets: [CH4, O2, CO2, H2O, CO], threshold: 0.01,"
+                " tolerance: 0.02, interval: 5}");
+            net.setAdaptiveChemistry(settings);
+            EXPECT_TRUE(net.adaptiveChemistry());
+            EXPECT_TRUE(reactor.adaptiveChemistry());
+        }
+        tIgn[n] = 0;
+        double t = 0;
+        while (t < 0.5) {
+            t += 1e-3;
+            net.advance(t);
+            if (tIgn[n] == 0 && reactor.temperature() > T0 + 400) {
+                tIgn[n] = t;
+            }
+        }
+        states[n].resize(reactor.neq());
+        reactor.getState(states[n].data());
+        if (n == 1) {
+            AnyMap stats = net.adaptiveChemistryStats();
+            EXPECT_GT(stats["updates"].asInt(), 0);
+            EXPECT_GT(stats["switches"].asInt(), 0);
+            EXPECT_LE(stats["max-error"].asDouble(), 0.02);
+            EXPECT_LT(stats["mean-active-reactions"].asDouble(),
+                      sol->kinetics()->nReactions());
+            net.setAdaptiveChemistry(AnyMap());
+            EXPECT_FALSE(reactor.adaptiveChemistry());
+            EXPECT_TRUE(sol->kinetics()->activeReactions().empty());
+        }
+    }
+    EXPECT_GT(tIgn[0], 0.0); // ignition occurred
+    EXPECT_NEAR(tIgn[1], tIgn[0], 0.1 * tIgn[0]);
+    EXPECT_NEAR(states[1][1], states[0][1], 0.01 * states[0][1]); // temperature
+}
+
+TEST(ZeroDim, quasi_steady_species)
+{
+    double T0 = 1500.0;
+    double P0 = OneAtm;
+    std::string X0 = "CH4:1.0, O2:2.0, N2:7.52";
+    std::vector<std::string> qss{"C", "CH", "CH2", "CH2(S)", "HCCOH", "H2CN"};
+    double tIgn[2];
+    size_t neq[2];
+    for (int n = 0; n < 2; n++) {
+        auto sol = newSolution("gri30.yaml", "gri30", "None");
+        sol->thermo()->setState_TPX(T0, P0, X0);
+        if (n == 1) {
+            sol->kinetics()->setQuasiSteadySpecies(qss);
+        }
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(sol);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setLinearSolverType("SPARSE");
+        tIgn[n] = 0;
+        double t = 0;
+        while (t < 0.01) {
+            t += 2e-5;
+            net.advance(t);
+            if (tIgn[n] == 0 && reactor.temperature() > T0 + 400) {
+                tIgn[n] = t;
+            }
+        }
+        neq[n] = reactor.neq();
+        if (n == 1) {
+            EXPECT_EQ(reactor.componentIndex("CH2"), npos);
+            size_t iOH = reactor.componentIndex("OH");
+            EXPECT_EQ(reactor.componentName(iOH), "OH");
+            EXPECT_EQ(reactor.jacobian().rows(), static_cast<int>(neq[1]));
+        }
+    }
+    EXPECT_EQ(neq[1], neq[0] - qss.size());
+    EXPECT_GT(tIgn[0], 0.0); // ignition occurred
+    EXPECT_NEAR(tIgn[1], tIgn[0], 0.1 * tIgn[0]);
+}
+
+TEST(ZeroDim, isat_cache)
+{
+    double T0 = 1200.0;
+    double P0 = OneAtm;
+    double dt = 2e-5;
+    double tol = 1e-4;
+    std::string X0 = "H2:2.0, O2:1.0, AR:4.0, H:0.001";
+    auto sol = newSolution("h2o2.yaml");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    gas->setState_TPX(T0, P0, X0);
+    ISATCache isat(sol, dt, tol);
+
+    // reference solution by direct integration
+    auto ref = newSolution("h2o2.yaml");
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(ref);
+    ReactorNet net;
+    net.addReactor(reactor);
+    auto direct = [&](double T, vector_fp& Y) {
+        ref->thermo()->setState_TPX(T, P0, X0);
+        reactor.syncState();
+        net.setInitialTime(0.0);
+        net.advance(dt);
+        Y.resize(nsp);
+        ref->thermo()->getMassFractions(Y.data());
+        return ref->thermo()->temperature();
+    };
+
+    vector_fp Yref, Y1(nsp), Y2(nsp);
+    double Tref = direct(T0, Yref);
+    isat.advance();
+    EXPECT_EQ(isat.nRecords(), 1u);
+    EXPECT_NEAR(gas->temperature(), Tref, 1e-3 * tol * 1000);
+    gas->getMassFractions(Y1.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(Y1[k], Yref[k], 1e-3 * tol);
+    }
+
+    // same initial state is retrieved from the table
+    gas->setState_TPX(T0, P0, X0);
+    isat.advance();
+    EXPECT_EQ(isat.stats()["retrieves"].asInt(), 1);
+    EXPECT_DOUBLE_EQ(gas->temperature(), Tref);
+    gas->getMassFractions(Y2.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(Y2[k], Y1[k], 1e-12);
+    }
+
+    // nearby states are retrieved or grow the EOA, within the tolerance
+    for (double dT : {0.01, 0.1, 1.0}) {
+        Tref = direct(T0 + dT, Yref);
+        gas->setState_TPX(T0 + dT, P0, X0);
+        isat.advance();
+        EXPECT_NEAR(gas->temperature(), Tref, tol * 1000) << dT;
+        gas->getMassFractions(Y1.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(Y1[k], Yref[k], tol) << dT;
+        }
+    }
+
+    // a distant state is added as a new record
+    size_t nRecords = isat.nRecords();
+    Tref = direct(T0 + 300, Yref);
+    gas->setState_TPX(T0 + 300, P0, X0);
+    isat.advance();
+    EXPECT_EQ(isat.nRecords(), nRecords + 1);
+    EXPECT_NEAR(gas->temperature(), Tref, 1e-3 * tol * 1000);
+
+    // least recently used records are evicted
+    isat.setMaxRecords(1);
+    EXPECT_EQ(isat.nRecords(), 1u);
+    gas->setState_TPX(T0 + 300, P0, X0);
+    isat.advance();
+    AnyMap stats = isat.stats();
+    EXPECT_EQ(stats["retrieves"].asInt() + stats["grows"].asInt()
+              + stats["adds"].asInt(), stats["queries"].asInt());
+    EXPECT_EQ(stats["evictions"].asInt(), static_cast<long int>(nRecords));
+    EXPECT_EQ(isat.nRecords(), 1u);
+    EXPECT_NEAR(gas->temperature(), Tref, 1e-3 * tol * 1000);
+
+    gas->setState_TPX(T0, 2 * P0, X0);
+    EXPECT_THROW(isat.advance(), CanteraError);
+    isat.clear();
+    EXPECT_EQ(isat.nRecords(), 0u);
+}
+
+TEST(ZeroDim, preconditioner)
+{
+    auto sol = newSolution("gri30.yaml");
+    sol->thermo()->setState_TPX(1500.0, OneAtm,
+        "CH4:1.0, O2:2.0, N2:7.52, H:0.01, OH:0.01, CH3:0.01, H2O:0.1");
+    IdealGasConstPressureReactor reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    EXPECT_EQ(net.preconditionerType(), "LU");
+    net.initialize();
+    size_t nv = net.neq();
+    vector_fp y(nv), z(nv);
+    net.getState(y.data());
+    double gamma = 1e-6;
+    EXPECT_TRUE(net.preconditionerSetup(0.0, y.data(), gamma, true));
+
+    // the preconditioner solve should invert the Newton matrix I - gamma*J
+    Eigen::SparseMatrix<double> jac;
+    net.evalSparseJacobian(0.0, y.data(), jac);
+    Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(nv, 1.0, 2.0);
+    Eigen::VectorXd r = x - gamma * (jac * x);
+    net.preconditionerSolve(r.data(), z.data());
+    for (size_t i = 0; i < nv; i++) {
+        EXPECT_NEAR(z[i], x[i], 1e-6 * std::abs(x[i]));
+    }
+
+    // reusing the Jacobian for a new value of gamma, even if the state changed
+    double gamma2 = 3e-6;
+    vector_fp y2 = y;
+    y2[0] *= 1.1;
+    EXPECT_FALSE(net.preconditionerSetup(0.0, y2.data(), gamma2, true));
+    r = x - gamma2 * (jac * x);
+    net.preconditionerSolve(r.data(), z.data());
+    for (size_t i = 0; i < nv; i++) {
+        EXPECT_NEAR(z[i], x[i], 1e-6 * std::abs(x[i]));
+    }
+    EXPECT_TRUE(net.preconditionerSetup(0.0, y.data(), gamma, false));
+
+    // the incomplete factorization gives an approximate inverse
+    net.setPreconditionerType("ILUT");
+    net.preconditionerSetup(0.0, y.data(), gamma);
+    net.preconditionerSolve(r.data(), z.data());
+    for (size_t i = 0; i < nv; i++) {
+        EXPECT_TRUE(std::isfinite(z[i]));
+    }
+
+    // skipping third body terms changes the approximate Jacobian
+    AnyMap settings;
+    settings["skip-third-bodies"] = true;
+    net.setDerivativeSettings(settings);
+    Eigen::SparseMatrix<double> jac2;
+    net.evalSparseJacobian(0.0, y.data(), jac2);
+    EXPECT_GT((Eigen::MatrixXd(jac) - Eigen::MatrixXd(jac2)).norm(), 0.0);
+    EXPECT_THROW(net.setPreconditionerOptions(-1.0, 10), CanteraError);
+    EXPECT_THROW(net.setPreconditionerType("spam"), CanteraError);
+}
+
+TEST(ZeroDim, colored_jacobian)
+{
+    // chain of reactors connected by walls and valves, with a pressure
+    // controller coupling the last reactor to the first valve
+    size_t nr = 5;
+    std::vector<std::shared_ptr<Solution>> sols;
+    std::vector<std::unique_ptr<IdealGasReactor>> reactors;
+    ReactorNet net;
+    for (size_t i = 0; i < nr; i++) {
+        sols.push_back(newSolution("h2o2.yaml"));
+        sols.back()->thermo()->setState_TPX(1000 + 50 * i, OneAtm * (1 + 0.1 * i),
+                                            "H2:2, O2:1, OH:0.01, H:0.02, AR:5");
+        reactors.emplace_back(new IdealGasReactor());
+        reactors.back()->insert(sols.back());
+        net.addReactor(*reactors.back());
+    }
+    Wall w1, w2;
+    w1.install(*reactors[0], *reactors[1]);
+    w1.setHeatTransferCoeff(100);
+    w1.setExpansionRateCoeff(1e-6);
+    w2.install(*reactors[2], *reactors[3]);
+    w2.setHeatTransferCoeff(100);
+    Valve v1, v2;
+    v1.install(*reactors[1], *reactors[2]);
+    v1.setValveCoeff(1e-6);
+    v2.install(*reactors[3], *reactors[4]);
+    v2.setValveCoeff(1e-6);
+
+    net.initialize();
+    size_t nv = net.neq();
+    size_t neq = reactors[0]->neq();
+    // a chain of reactors can be perturbed using three groups
+    EXPECT_EQ(net.nJacobianColors(), 3 * neq);
+
+    vector_fp y(nv), ydot(nv), ydot1(nv);
+    net.getState(y.data());
+    Array2D jac(nv, nv);
+    net.evalJacobian(0.0, y.data(), ydot.data(), nullptr, &jac);
+
+    // compare with perturbing one state variable at a time
+    for (size_t n = 0; n < nv; n++) {
+        double ysave = y[n];
+        double dy = net.atol() + std::abs(ysave) * net.rtol();
+        y[n] = ysave + dy;
+        dy = y[n] - ysave;
+        net.eval(0.0, y.data(), ydot1.data(), nullptr);
+        y[n] = ysave;
+        for (size_t m = 0; m < nv; m++) {
+            double ref = (ydot1[m] - ydot[m]) / dy;
+            EXPECT_NEAR(jac(m, n), ref, 1e-8 * std::abs(ref) + 1e-14)
+                << "m = " << m << ", n = " << n;
+        }
+    }
+
+    // the same Jacobian is provided to the integrator
+    vector_fp jac2(nv * nv, -1.0);
+    net.evalDenseJacobian(0.0, y.data(), ydot.data(), jac2.data());
+    for (size_t n = 0; n < nv; n++) {
+        for (size_t m = 0; m < nv; m++) {
+            EXPECT_DOUBLE_EQ(jac2[n * nv + m], jac(m, n));
+        }
+    }
+
+    // A pressure controller couples all reactors connected to its master
+    PressureController pc;
+    pc.install(*reactors[4], *reactors[0]);
+    pc.setMaster(&v1);
+    pc.setPressureCoeff(1e-6);
+    net.setNeedsReinit();
+    net.initialize();
+    EXPECT_EQ(net.nJacobianColors(), nr * neq);
+}
+
+TEST(ZeroDim, ensemble)
+{
+    auto sol = newSolution("h2o2.yaml");
+    ReactorEnsemble ensemble(sol);
+    ensemble.setThreads(3);
+    ensemble.setTolerances(1e-9, 1e-15);
+    ensemble.setTimeHorizon(0.1);
+    ensemble.setTemperatureRise(400);
+    ensemble.setPeakSpecies("OH");
+    std::string X0 = "H2:2.0, O2:1.0, AR:8.0";
+    for (int i = 0; i < 8; i++) {
+        ensemble.addCase(1000 + 50 * i, OneAtm, X0);
+    }
+    ensemble.addCase(300, OneAtm, X0); // does not ignite
+    ensemble.run();
+
+    // compare with serial integration of the same cases
+    for (size_t i = 0; i < 8; i++) {
+        const EnsembleResult& res = ensemble.result(i);
+        ASSERT_TRUE(res.success) << res.message;
+        EXPECT_GT(res.finalTemperature, 1400 + 50 * i);
+        EXPECT_GE(res.peakTime, res.ignitionTime);
+        EXPECT_GT(res.peakValue, 0.0);
+
+        auto gas = newSolution("h2o2.yaml");
+        gas->thermo()->setState_TPX(1000 + 50 * i, OneAtm, X0);
+        IdealGasConstPressureReactor reactor;
+        reactor.insert(gas);
+        ReactorNet net;
+        net.addReactor(reactor);
+        net.setTolerances(1e-9, 1e-15);
+        double t = 0, tPrev = 0, TPrev = 1000 + 50 * i;
+        while (reactor.temperature() < 1400 + 50 * i) {
+            tPrev = t;
+            TPrev = reactor.temperature();
+            t = net.step();
+        }
+        double tIgn = tPrev + (t - tPrev) * (1400 + 50 * i - TPrev)
+                      / (reactor.temperature() - TPrev);
+        EXPECT_NEAR(res.ignitionTime, tIgn, 1e-8 * tIgn);
+    }
+    const EnsembleResult& cold = ensemble.result(8);
+    EXPECT_TRUE(cold.success);
+    EXPECT_TRUE(std::isnan(cold.ignitionTime));
+    EXPECT_DOUBLE_EQ(cold.finalTime, 0.1);
+
+    // results are unchanged when workers are reused
+    double tIgn = ensemble.result(3).ignitionTime;
+    ensemble.setThreads(2);
+    ensemble.run();
+    EXPECT_DOUBLE_EQ(ensemble.result(3).ignitionTime, tIgn);
+}
+
+TEST(ZeroDim, ensemble_setup)
+{
+    auto sol = newSolution("h2o2.yaml");
+    EXPECT_THROW(ReactorEnsemble(sol, "Reservoir"), CanteraError);
+    ReactorEnsemble ensemble(sol);
+    EXPECT_THROW(ensemble.setPeakSpecies("CH4"), CanteraError);
+    EXPECT_THROW(ensemble.setTimeHorizon(-1), CanteraError);
+    EXPECT_THROW(ensemble.addCase(1000, OneAtm, vector_fp(3, 1.0)), CanteraError);
+    EXPECT_EQ(ensemble.addCase(1000, OneAtm, "H2:2, O2:1"), 0u);
+    EXPECT_EQ(ensemble.nCases(), 1u);
+    EXPECT_THROW(ensemble.result(0), IndexError);
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from test_zeroD.cpp\n");